@@ -800,28 +800,83 @@ namespace storm {
             });
         }
         
+        template <typename ValueType>
+        std::unique_ptr<storm::modelchecker::CheckResult> mapSparseResultToOriginalModel(std::unique_ptr<storm::modelchecker::CheckResult>&& result, std::vector<uint64_t> const& newToOldStateIndexMapping) {
+            if (result->isExplicitQuantitativeCheckResult()) {
+                auto const& quantitativeResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+                std::unique_ptr<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>> mappedResult;
+                if (quantitativeResult.isResultForAllStates()) {
+                    mappedResult = std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>>(storm::transformer::mapStateValuesToOriginalModel(quantitativeResult.getValueVector(), newToOldStateIndexMapping));
+                } else {
+                    typename storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>::map_type values;
+                    for (auto const& stateValuePair : quantitativeResult.getValueMap()) {
+                        values.emplace(newToOldStateIndexMapping[stateValuePair.first], stateValuePair.second);
+                    }
+                    mappedResult = std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>>(std::move(values));
+                }
+                if (quantitativeResult.hasScheduler()) {
+                    mappedResult->setScheduler(std::make_unique<storm::storage::Scheduler<ValueType>>(storm::transformer::mapSchedulerToOriginalModel(quantitativeResult.getScheduler(), newToOldStateIndexMapping)));
+                }
+                return mappedResult;
+            } else if (result->isExplicitQualitativeCheckResult()) {
+                auto const& qualitativeResult = result->asExplicitQualitativeCheckResult();
+                if (qualitativeResult.isResultForAllStates()) {
+                    storm::storage::BitVector truthValues(newToOldStateIndexMapping.size());
+                    for (auto newState : qualitativeResult.getTruthValuesVector()) {
+                        truthValues.set(newToOldStateIndexMapping[newState]);
+                    }
+                    return std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(std::move(truthValues));
+                } else {
+                    storm::modelchecker::ExplicitQualitativeCheckResult::map_type truthValues;
+                    for (auto const& stateValuePair : qualitativeResult.getTruthValuesMap()) {
+                        truthValues.emplace(newToOldStateIndexMapping[stateValuePair.first], stateValuePair.second);
+                    }
+                    return std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(std::move(truthValues));
+                }
+            }
+            // The remaining results (e.g., Pareto curves) do not refer to individual states.
+            return std::move(result);
+        }
+        
         template <typename ValueType>
         void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input) {
             auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
             auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+            
+            // If requested, the properties are checked on a renumbered copy of the model. The labeling is renumbered
+            // as well, so properties refer to the same states as before, and the results are mapped back to the
+            // states of the original model, which is also the one that is exported.
+            std::shared_ptr<storm::models::sparse::Model<ValueType>> verificationModel = sparseModel;
+            boost::optional<std::vector<uint64_t>> newToOldStateIndexMapping;
+            if (transformationSettings.isStateReorderingSet()) {
+                STORM_LOG_INFO("Reordering the states of the model...");
+                auto reorderingResult = storm::api::reorderStates<ValueType>(sparseModel, transformationSettings.getStateReorderingMethod());
+                verificationModel = reorderingResult.model;
+                newToOldStateIndexMapping = std::move(reorderingResult.newToOldStateIndexMapping);
+            }
+            
             verifyProperties<ValueType>(input,
-                                        [&sparseModel,&ioSettings] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+                                        [&verificationModel,&newToOldStateIndexMapping,&ioSettings] (std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
                                             bool filterForInitialStates = states->isInitialFormula();
                                             auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
                                             if (ioSettings.isExportSchedulerSet()) {
                                                 task.setProduceSchedulers(true);
                                             }
-                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, task);
+                                            std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(verificationModel, task);
                                             
                                             std::unique_ptr<storm::modelchecker::CheckResult> filter;
                                             if (filterForInitialStates) {
-                                                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
+                                                filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(verificationModel->getInitialStates());
                                             } else {
-                                                filter = storm::api::verifyWithSparseEngine<ValueType>(sparseModel, storm::api::createTask<ValueType>(states, false));
+                                                filter = storm::api::verifyWithSparseEngine<ValueType>(verificationModel, storm::api::createTask<ValueType>(states, false));
                                             }
                                             if (result && filter) {
                                                 result->filter(filter->asQualitativeCheckResult());
                                             }
+                                            if (result && newToOldStateIndexMapping) {
+                                                result = mapSparseResultToOriginalModel<ValueType>(std::move(result), newToOldStateIndexMapping.get());
+                                            }
                                             return result;
                                         },
                                         [&sparseModel,&ioSettings] (std::unique_ptr<storm::modelchecker::CheckResult> const& result) {
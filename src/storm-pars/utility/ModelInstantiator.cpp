@@ -150,6 +150,9 @@ namespace storm {
                     *(entryValuePair.first)=*(entryValuePair.second);
                 }
                 
+                // The matrix was modified in place, so results of previous graph analyses may no longer be valid.
+                this->instantiatedModel->invalidateAnalysisCache();
+                
                 return *this->instantiatedModel;
             }
         
@@ -3,6 +3,7 @@
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
 #include "storm/transformer/NonMarkovianChainTransformer.h"
+#include "storm/transformer/StateReordering.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/builder.h"
@@ -128,5 +129,15 @@ namespace storm {
             }
         }
 
+        /*!
+         * Renumbers the states of the given model such that the transition matrix has a better memory locality.
+         * The resulting model is isomorphic to the given one. The returned mappings translate between the state
+         * indices of both models.
+         */
+        template <typename ValueType>
+        storm::transformer::StateReorderingReturnType<ValueType> reorderStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::transformer::StateReorderingMethod method) {
+            return storm::transformer::reorderStates(*model, method);
+        }
+
     }
 }
@@ -178,6 +178,58 @@ namespace storm {
             return verifyWithSparseEngine(env, dtmc, task);
         }
 
+        /*!
+         * Checks the given tasks on the given DTMC. The probabilities of unbounded until and eventually formulas are
+         * computed together, such that formulas with the same maybe states share their equation system. All other tasks
+         * are checked one after another.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
+                for (uint64_t index = 0; index < tasks.size(); ++index) {
+                    results[index] = verifyWithSparseEngine(env, dtmc, tasks[index]);
+                }
+                return results;
+            }
+            
+            storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+            std::vector<std::shared_ptr<storm::logic::UntilFormula const>> untilFormulas;
+            std::vector<storm::modelchecker::CheckTask<storm::logic::UntilFormula, ValueType>> untilTasks;
+            std::vector<uint64_t> untilTaskIndices;
+            for (uint64_t index = 0; index < tasks.size(); ++index) {
+                auto const& task = tasks[index];
+                storm::logic::Formula const& formula = task.getFormula();
+                // Operators with a bound yield a qualitative result, so only queries for the probability are batched.
+                if (formula.isProbabilityOperatorFormula() && !formula.asProbabilityOperatorFormula().hasBound() && modelchecker.canHandle(task)) {
+                    storm::logic::Formula const& pathFormula = formula.asProbabilityOperatorFormula().getSubformula();
+                    if (pathFormula.isUntilFormula()) {
+                        untilFormulas.push_back(std::static_pointer_cast<storm::logic::UntilFormula const>(pathFormula.asSharedPointer()));
+                    } else if (pathFormula.isEventuallyFormula() && pathFormula.asEventuallyFormula().isReachabilityProbabilityFormula()) {
+                        untilFormulas.push_back(std::make_shared<storm::logic::UntilFormula const>(storm::logic::Formula::getTrueFormula(), pathFormula.asEventuallyFormula().getSubformula().asSharedPointer()));
+                    }
+                    if (untilFormulas.size() > untilTasks.size()) {
+                        untilTasks.push_back(task.substituteFormula(*untilFormulas.back()));
+                        untilTaskIndices.push_back(index);
+                        continue;
+                    }
+                }
+                results[index] = verifyWithSparseEngine(env, dtmc, task);
+            }
+            
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> untilResults = modelchecker.computeUntilProbabilitiesBatch(env, untilTasks);
+            for (uint64_t index = 0; index < untilTaskIndices.size(); ++index) {
+                results[untilTaskIndices[index]] = std::move(untilResults[index]);
+            }
+            return results;
+        }
+
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks) {
+            Environment env;
+            return verifyWithSparseEngine(env, dtmc, tasks);
+        }
+
         template<typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
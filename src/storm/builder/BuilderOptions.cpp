@@ -38,7 +38,7 @@ namespace storm {
         }
         
 
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), applyMaximalProgressAssumption(false), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), scaleAndLiftTransitionRewards(true), explorationChecks(false), compiledExpressions(false), partialOrderReduction(false), symmetryReduction(false), inferObservationsFromActions(false), addOverlappingGuardsLabel(false), addOutOfBoundsState(false), reservedBitsForUnboundedVariables(32), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -62,6 +62,9 @@ namespace storm {
                 this->setApplyMaximalProgressAssumption(modelDescription.getModelType() == storm::storage::SymbolicModelDescription::ModelType::MA);
             }
             explorationChecks = buildSettings.isExplorationChecksSet();
+            compiledExpressions = buildSettings.isCompiledExpressionsSet();
+            partialOrderReduction = buildSettings.isPartialOrderReductionSet();
+            symmetryReduction = buildSettings.isSymmetryReductionSet();
             reservedBitsForUnboundedVariables = buildSettings.getBitsForUnboundedVariables();
             showProgress = generalSettings.isVerboseSet();
             showProgressDelay = generalSettings.getShowProgressDelay();
@@ -239,6 +242,33 @@ namespace storm {
             return *this;
         }
         
+        bool BuilderOptions::isCompiledExpressionsSet() const {
+            return compiledExpressions;
+        }
+        
+        BuilderOptions& BuilderOptions::setCompiledExpressions(bool newValue) {
+            compiledExpressions = newValue;
+            return *this;
+        }
+        
+        bool BuilderOptions::isPartialOrderReductionSet() const {
+            return partialOrderReduction;
+        }
+        
+        BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+            partialOrderReduction = newValue;
+            return *this;
+        }
+        
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return symmetryReduction;
+        }
+        
+        BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+            symmetryReduction = newValue;
+            return *this;
+        }
+        
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
             rewardModelNames.emplace(rewardModelName);
@@ -110,6 +110,9 @@ namespace storm {
             bool isBuildAllRewardModelsSet() const;
             bool isBuildAllLabelsSet() const;
             bool isExplorationChecksSet() const;
+            bool isCompiledExpressionsSet() const;
+            bool isPartialOrderReductionSet() const;
+            bool isSymmetryReductionSet() const;
             bool isInferObservationsFromActionsSet() const;
             bool isShowProgressSet() const;
             bool isScaleAndLiftTransitionRewardsSet() const;
@@ -171,6 +174,25 @@ namespace storm {
              * @return this
              */
             BuilderOptions& setExplorationChecks(bool newValue = true);
+            /**
+             * Should guards, probabilities and assignments be evaluated via compiled expressions (if supported)?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setCompiledExpressions(bool newValue = true);
+            /**
+             * Should partial-order reduction be applied (if supported)? The reduced model preserves the minimal and
+             * maximal probabilities of properties over the labels and terminal states of these options.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setPartialOrderReduction(bool newValue = true);
+            /**
+             * Should states that only differ in a permutation of symmetric modules be identified (if supported)?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setSymmetryReduction(bool newValue = true);
 
 
 
@@ -247,6 +269,15 @@ namespace storm {
             /// A flag that stores whether exploration checks are to be performed.
             bool explorationChecks;
 
+            /// A flag that stores whether expressions are to be evaluated via compiled expressions.
+            bool compiledExpressions;
+
+            /// A flag that stores whether partial-order reduction is to be applied.
+            bool partialOrderReduction;
+
+            /// A flag that stores whether symmetry reduction is to be applied.
+            bool symmetryReduction;
+
             /// For POMDPs, should we allow inference of observation classes from different enabled actions.
             bool inferObservationsFromActions;
 
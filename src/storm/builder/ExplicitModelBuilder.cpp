@@ -1,6 +1,13 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
 #include <map>
+#include <unordered_map>
+
+#include <boost/filesystem.hpp>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -8,9 +15,12 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+#include "storm/storage/ExternalBitVectorMap.h"
 #include "storm/storage/expressions/ExpressionManager.h"
 
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/builder/RewardModelBuilder.h"
 #include "storm/builder/ChoiceInformationBuilder.h"
@@ -33,6 +43,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/builder.h"
+#include "storm/utility/ThreadPool.h"
 
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -40,15 +51,89 @@
 
 namespace storm {
     namespace builder {
-                        
+        
+        namespace detail {
+            // The number of states of a layer that a thread expands before fetching further work during parallel exploration.
+            static const uint64_t parallelExplorationChunkSize = 256;
+            
+            // The minimal initial capacity of the map that stores the states discovered while expanding a layer.
+            static const uint64_t minimalDiscoveredStatesMapSize = 1024;
+            
+            // The estimated memory that is required for each transition of a state that is explored while storing the
+            // states and transitions on disk.
+            static const uint64_t estimatedBytesPerExternalTransition = 64;
+            
+            // The information that is kept about a state while merging states on the fly. It is only kept for states
+            // that represent their block (including the states that were discovered but not yet explored).
+            template <typename ValueType, typename StateType>
+            struct LumpingStateInformation {
+                // The successors of the state with their probabilities (or rates). Each successor stands for its block.
+                // This is empty if the state was not yet explored.
+                std::vector<std::pair<StateType, ValueType>> successors;
+                
+                // The labels of the state, one for each label expression of the generator.
+                storm::storage::BitVector labels;
+                
+                // The state rewards of the state followed by the rewards of its choice.
+                std::vector<ValueType> rewards;
+                
+                // The states that had a transition to (the block of) this state when they were explored.
+                std::vector<StateType> predecessors;
+                
+                // The hash under which the state is stored as the representative of its block (if it is stored).
+                std::size_t hash = 0;
+                
+                bool explored = false;
+                bool deadlock = false;
+                bool indexed = false;
+                bool queued = false;
+            };
+            
+            /*!
+             * Sorts the given distribution by the states and adds up the values of equal states.
+             */
+            template <typename ValueType, typename StateType>
+            void sortAndCombine(std::vector<std::pair<StateType, ValueType>>& distribution) {
+                if (distribution.empty()) {
+                    return;
+                }
+                std::sort(distribution.begin(), distribution.end(), [] (std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                auto last = distribution.begin();
+                for (auto it = distribution.begin() + 1; it != distribution.end(); ++it) {
+                    if (it->first == last->first) {
+                        last->second += it->second;
+                    } else {
+                        ++last;
+                        *last = std::move(*it);
+                    }
+                }
+                distribution.erase(last + 1, distribution.end());
+            }
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), numberOfThreads(1), memoryLimit(0), externalDirectory(), compressStates(false), lumpStates(false) {
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (buildSettings.isParallelExplorationSet()) {
+                numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+            }
+            if (buildSettings.isExplorationMemoryLimitSet()) {
+                memoryLimit = buildSettings.getExplorationMemoryLimit() * 1024 * 1024;
+            }
+            if (buildSettings.isExternalExplorationDirectorySet()) {
+                externalDirectory = buildSettings.getExternalExplorationDirectory();
+            }
+            compressStates = buildSettings.isStateCompressionSet();
+            lumpStates = buildSettings.isLumpingOnTheFlySet();
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
-            // Intentionally left empty.
+            // States of at most 64 bits cannot be compressed further.
+            if (options.compressStates && generator->getStateSize() > 64) {
+                auto compression = std::make_shared<storm::storage::BitVectorTreeCompression>(generator->getStateSize(), generator->getStateSegmentOffsets());
+                stateStorage.stateToId = storm::storage::BitVectorHashMap<StateType>(generator->getStateSize(), 100000, 0.75, compression);
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
@@ -109,7 +194,7 @@ namespace storm {
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::ChunkedSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
             
             // Create markovian states bit vector, if required.
             if (generator->getModelType() == storm::generator::ModelType::MA) {
@@ -140,6 +225,32 @@ namespace storm {
             uint64_t numberOfExploredStates = 0;
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
+            // Determine whether the exploration can be performed in parallel. For this, we need one generator per thread.
+            std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> generators;
+            if (options.numberOfThreads > 1) {
+                if (options.explorationOrder != ExplorationOrder::Bfs) {
+                    STORM_LOG_WARN("Parallel exploration requires breadth-first exploration order. Exploring sequentially.");
+                } else if (!std::is_same<ValueType, double>::value) {
+                    STORM_LOG_WARN("Parallel exploration is only supported for models with double precision values. Exploring sequentially.");
+                } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                    STORM_LOG_WARN("Parallel exploration does not support detecting overlapping guards. Exploring sequentially.");
+                } else {
+                    generators.push_back(generator);
+                    while (generators.size() < options.numberOfThreads && generators.back()) {
+                        generators.push_back(generator->clone());
+                    }
+                    if (!generators.back()) {
+                        STORM_LOG_WARN("Parallel exploration is not supported by the next-state generator. Exploring sequentially.");
+                        generators.clear();
+                    }
+                }
+            }
+            
+            if (!generators.empty()) {
+                STORM_LOG_DEBUG("Exploring the state space with " << generators.size() << " threads.");
+                exploreStatesInParallel(generators, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
+            }
+            
             // Perform a search through the model.
             while (!statesToExplore.empty()) {
                 // Get the first state in the queue.
@@ -160,91 +271,7 @@ namespace storm {
                 generator->load(currentState);
                 storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
                 
-                // If there is no behavior, we might have to introduce a self-loop.
-                if (behavior.empty()) {
-                    if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
-                        // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
-                        if (behavior.wasExpanded()) {
-                            this->stateStorage.deadlockStateIndices.push_back(currentIndex);
-                        }
-                        
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
-                    }
-                } else {
-                    // Add the state rewards to the corresponding reward models.
-                    auto stateRewardIt = behavior.getStateRewards().begin();
-                    for (auto& rewardModelBuilder : rewardModelBuilders) {
-                        if (rewardModelBuilder.hasStateRewards()) {
-                            rewardModelBuilder.addStateReward(*stateRewardIt);
-                        }
-                        ++stateRewardIt;
-                    }
-                    
-                    // If the model is nondeterministic, we need to open a row group.
-                    if (!generator->isDeterministicModel()) {
-                        transitionMatrixBuilder.newRowGroup(currentRow);
-                    }
-                    
-                    // Now add all choices.
-                    for (auto const& choice : behavior) {
-                        
-                        // add the generated choice information
-                        if (choice.hasLabels()) {
-                            for (auto const& label : choice.getLabels()) {
-                                choiceInformationBuilder.addLabel(label, currentRow);
-                            }
-                        }
-                        if (choice.hasOriginData()) {
-                            choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
-                        }
-                        
-                        // If we keep track of the Markovian choices, store whether the current one is Markovian.
-                        if (markovianStates && choice.isMarkovian()) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        // Add the probabilistic behavior to the matrix.
-                        for (auto const& stateProbabilityPair : choice) {
-                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
-                        }
-                        
-                        // Add the rewards to the reward models.
-                        auto choiceRewardIt = choice.getRewards().begin();
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(*choiceRewardIt);
-                            }
-                            ++choiceRewardIt;
-                        }
-                        ++currentRow;
-                    }
-                    ++currentRowGroup;
-                }
+                addStateBehaviorToMatrices(currentState, currentIndex, behavior, std::function<StateType (StateType const&)>(), transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
                 
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
@@ -295,6 +322,725 @@ namespace storm {
             }
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::exploreStatesInParallel(std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& generators, storm::storage::ChunkedSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow) {
+            storm::utility::ThreadPool threadPool(generators.size());
+            StateType const noIndex = std::numeric_limits<StateType>::max();
+            
+            // The states discovered while expanding a layer are stored in a map that all threads extend concurrently.
+            // Until the layer is completely expanded, these states are identified by preliminary indices that depend
+            // on the order in which the threads happened to discover them.
+            std::unique_ptr<storm::storage::ConcurrentBitVectorHashMap<StateType>> stateToPreliminaryIndex;
+            
+            // Since we explore breadth-first, the queue contains states with consecutive indices.
+            std::vector<CompressedState> currentLayer;
+            currentLayer.reserve(statesToExplore.size());
+            StateType firstLayerIndex = statesToExplore.empty() ? 0 : statesToExplore.front().second;
+            for (auto& stateIndexPair : statesToExplore) {
+                STORM_LOG_ASSERT(stateIndexPair.second == firstLayerIndex + currentLayer.size(), "Expected consecutive state indices in the exploration queue.");
+                currentLayer.push_back(std::move(stateIndexPair.first));
+            }
+            statesToExplore.clear();
+            
+            // For each state of the current layer, we store its behavior. Moreover, for each chunk of the layer, we
+            // store the (preliminary) indices of newly discovered states in the order in which they were requested.
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+            std::vector<std::vector<StateType>> discoveredStates;
+            
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStates = 0;
+            uint64_t numberOfExploredStatesSinceLastMessage = 0;
+            
+            while (!currentLayer.empty()) {
+                StateType firstNewIndex = firstLayerIndex + currentLayer.size();
+                STORM_LOG_ASSERT(firstNewIndex == stateStorage.getNumberOfStates(), "Unexpected number of known states.");
+                
+                // We expect the next layer to have a similar size as the current one.
+                stateToPreliminaryIndex.reset(new storm::storage::ConcurrentBitVectorHashMap<StateType>(generators.front()->getStateSize(), std::max<uint64_t>(currentLayer.size(), detail::minimalDiscoveredStatesMapSize)));
+                std::atomic<StateType> numberOfPreliminaryIndices(0);
+                behaviors.resize(currentLayer.size());
+                discoveredStates.resize((currentLayer.size() + detail::parallelExplorationChunkSize - 1) / detail::parallelExplorationChunkSize);
+                
+                // Expand all states of the current layer.
+                std::atomic<uint64_t> nextChunk(0);
+                std::function<void (uint64_t)> expandLayer = [&] (uint64_t threadIndex) {
+                    storm::generator::NextStateGenerator<ValueType, StateType>& threadGenerator = *generators[threadIndex];
+                    std::vector<StateType>* currentDiscoveredStates = nullptr;
+                    
+                    // Each thread reserves a preliminary index that it offers for the next state it cannot find. Only
+                    // if the state is actually added with this index, the thread reserves another one.
+                    StateType reservedIndex = noIndex;
+                    
+                    std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                        // The map of all known states is not modified during the expansion of a layer, so it can be
+                        // read concurrently.
+                        if (stateStorage.stateToId.contains(state)) {
+                            return stateStorage.stateToId.getValue(state);
+                        }
+                        
+                        if (reservedIndex == noIndex) {
+                            reservedIndex = firstNewIndex + numberOfPreliminaryIndices++;
+                        }
+                        StateType preliminaryIndex = stateToPreliminaryIndex->findOrAdd(state, reservedIndex);
+                        if (preliminaryIndex == reservedIndex) {
+                            reservedIndex = noIndex;
+                        }
+                        currentDiscoveredStates->push_back(preliminaryIndex);
+                        return preliminaryIndex;
+                    };
+                    
+                    uint64_t chunk;
+                    while ((chunk = nextChunk++) * detail::parallelExplorationChunkSize < currentLayer.size()) {
+                        currentDiscoveredStates = &discoveredStates[chunk];
+                        currentDiscoveredStates->clear();
+                        uint64_t chunkEnd = std::min<uint64_t>((chunk + 1) * detail::parallelExplorationChunkSize, currentLayer.size());
+                        for (uint64_t position = chunk * detail::parallelExplorationChunkSize; position < chunkEnd; ++position) {
+                            threadGenerator.load(currentLayer[position]);
+                            behaviors[position] = threadGenerator.expand(stateToIdCallback);
+                        }
+                    }
+                };
+                
+                // Small layers (which typically occur at the beginning of the search) are not worth distributing.
+                if (currentLayer.size() <= detail::parallelExplorationChunkSize) {
+                    expandLayer(0);
+                } else {
+                    threadPool.execute(expandLayer);
+                }
+                
+                // Number the new states in the order in which a sequential breadth-first search discovers them, i.e.,
+                // in the order of the states that were expanded and the order of the requests of the generator. Note
+                // that the preliminary indices that were reserved but not used do not get a final index.
+                std::vector<StateType> preliminaryToFinalIndex(numberOfPreliminaryIndices.load(), noIndex);
+                StateType nextIndex = firstNewIndex;
+                for (auto const& preliminaryIndices : discoveredStates) {
+                    for (auto const& preliminaryIndex : preliminaryIndices) {
+                        StateType& finalIndex = preliminaryToFinalIndex[preliminaryIndex - firstNewIndex];
+                        if (finalIndex == noIndex) {
+                            finalIndex = nextIndex++;
+                        }
+                    }
+                }
+                STORM_LOG_ASSERT(nextIndex == firstNewIndex + stateToPreliminaryIndex->size(), "Not all discovered states were numbered.");
+                
+                // Register the new states and assemble the next layer.
+                std::vector<CompressedState> nextLayer(stateToPreliminaryIndex->size());
+                for (auto const& stateIndexPair : *stateToPreliminaryIndex) {
+                    nextLayer[preliminaryToFinalIndex[stateIndexPair.second - firstNewIndex] - firstNewIndex] = stateIndexPair.first;
+                }
+                for (uint64_t position = 0; position < nextLayer.size(); ++position) {
+                    stateStorage.stateToId.findOrAdd(nextLayer[position], firstNewIndex + position);
+                }
+                
+                // Add the behaviors of the current layer to the matrices.
+                std::function<StateType (StateType const&)> stateIndexRemapping = [&] (StateType const& index) {
+                    return index < firstNewIndex ? index : preliminaryToFinalIndex[index - firstNewIndex];
+                };
+                for (uint64_t position = 0; position < currentLayer.size(); ++position) {
+                    addStateBehaviorToMatrices(currentLayer[position], firstLayerIndex + position, behaviors[position], stateIndexRemapping, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
+                }
+                
+                if (generators.front()->getOptions().isShowProgressSet()) {
+                    numberOfExploredStatesSinceLastMessage += currentLayer.size();
+                    numberOfExploredStates += currentLayer.size();
+                    
+                    auto now = std::chrono::high_resolution_clock::now();
+                    auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                    if (durationSinceLastMessage > 0 && static_cast<uint64_t>(durationSinceLastMessage) >= generators.front()->getOptions().getShowProgressDelay()) {
+                        auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                        auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                        std::cout << "Explored " << numberOfExploredStates << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                        numberOfExploredStatesSinceLastMessage = 0;
+                    }
+                }
+                
+                currentLayer = std::move(nextLayer);
+                firstLayerIndex = firstNewIndex;
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isExternalExplorationEnabled() const {
+            if (options.memoryLimit == 0) {
+                return false;
+            }
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                STORM_LOG_WARN("Storing the explored states on disk requires breadth-first exploration order. Exploring in memory.");
+            } else if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Storing the explored states on disk is only supported for models with double precision values. Exploring in memory.");
+            } else if (generator->getOptions().isAddOverlappingGuardLabelSet()) {
+                STORM_LOG_WARN("Storing the explored states on disk does not support detecting overlapping guards. Exploring in memory.");
+            } else if (generator->getOptions().isPartialOrderReductionSet()) {
+                STORM_LOG_WARN("Storing the explored states on disk does not support partial-order reduction. Exploring in memory.");
+            } else if (generator->isPartiallyObservable()) {
+                STORM_LOG_WARN("Storing the explored states on disk does not support partially observable models. Exploring in memory.");
+            } else if (generator->getStateSize() == 0) {
+                // Models without variables have a single state, so there is nothing to gain.
+                return false;
+            } else {
+                return true;
+            }
+            return false;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::isLumpingOnTheFlyEnabled() const {
+            if (!options.lumpStates) {
+                return false;
+            }
+            auto const& generatorOptions = generator->getOptions();
+            if (!generator->isDeterministicModel()) {
+                STORM_LOG_WARN("Merging states while exploring them is only supported for deterministic models. Building the full model.");
+            } else if (generatorOptions.isBuildChoiceLabelsSet() || generatorOptions.isBuildChoiceOriginsSet() || generatorOptions.isBuildStateValuationsSet()) {
+                STORM_LOG_WARN("Merging states while exploring them does not support choice labels, choice origins or state valuations. Building the full model.");
+            } else if (generatorOptions.isAddOverlappingGuardLabelSet() || generatorOptions.isAddOutOfBoundsStateSet()) {
+                STORM_LOG_WARN("Merging states while exploring them does not support labeling overlapping guards or out-of-bounds states. Building the full model.");
+            } else {
+                STORM_LOG_WARN_COND(options.numberOfThreads <= 1 && options.memoryLimit == 0, "Merging states while exploring them is performed sequentially and in memory.");
+                return true;
+            }
+            return false;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        storm::storage::SparseMatrix<ValueType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildLumpedMatrices(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders) {
+            typedef detail::LumpingStateInformation<ValueType, StateType> StateInformation;
+            
+            // Create a callback for the next-state generator to enable it to request the index of states.
+            std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
+            
+            // The row groups do not correspond to the states here, but the mapping is required to discover states depth-first.
+            if (options.explorationOrder != ExplorationOrder::Bfs) {
+                stateRemapping = std::vector<uint_fast64_t>();
+            }
+            
+            // Let the generator create all initial states.
+            this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+            STORM_LOG_THROW(!this->stateStorage.initialStateIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+            storm::storage::BitVector initialStates(stateStorage.getNumberOfStates());
+            for (auto const& state : this->stateStorage.initialStateIndices) {
+                initialStates.set(state);
+            }
+            auto isInitialState = [&initialStates] (StateType state) { return state < initialStates.size() && initialStates.get(state); };
+            
+            std::vector<std::pair<std::string, storm::expressions::Expression>> labelExpressions = generator->getLabelExpressions();
+            bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+            
+            // For each state, we store the state it was merged into or the state itself if it represents its block.
+            // Further information is only stored for the representatives, as merged states are never looked at again.
+            std::vector<StateType> representatives;
+            std::unordered_map<StateType, StateInformation> states;
+            auto updateNumberOfStates = [&] () {
+                for (StateType state = static_cast<StateType>(representatives.size()); state < stateStorage.getNumberOfStates(); ++state) {
+                    representatives.push_back(state);
+                }
+            };
+            auto getInformation = [&states] (StateType state) -> StateInformation& {
+                auto it = states.find(state);
+                STORM_LOG_ASSERT(it != states.end(), "No information is stored about state " << state << ".");
+                return it->second;
+            };
+            auto findRepresentative = [&representatives] (StateType state) {
+                while (representatives[state] != state) {
+                    representatives[state] = representatives[representatives[state]];
+                    state = representatives[state];
+                }
+                return state;
+            };
+            
+            // Computes the distribution of the given state over the current blocks (identified by their representatives).
+            auto computeBlockDistribution = [&] (StateType state) {
+                std::vector<std::pair<StateType, ValueType>> result;
+                StateInformation const& information = getInformation(state);
+                result.reserve(information.successors.size());
+                for (auto const& successor : information.successors) {
+                    result.emplace_back(findRepresentative(successor.first), successor.second);
+                }
+                detail::sortAndCombine(result);
+                return result;
+            };
+            
+            // Computes the given distribution over the blocks that results from merging the block of the first given
+            // representative into the block of the second one.
+            auto mergeBlocks = [] (std::vector<std::pair<StateType, ValueType>> distribution, StateType mergedRepresentative, StateType representative) {
+                for (auto& entry : distribution) {
+                    if (entry.first == mergedRepresentative) {
+                        entry.first = representative;
+                    }
+                }
+                detail::sortAndCombine(distribution);
+                return distribution;
+            };
+            
+            // The representatives of the blocks are stored by the hashes of their labels and successor blocks. Since the
+            // blocks only grow, states that once had equal successors keep having equal successors. Hence, the stored
+            // hash of a representative may be outdated only if the representative is queued to be checked again.
+            std::unordered_multimap<std::size_t, StateType> blockIndex;
+            std::deque<StateType> statesToCheck;
+            
+            // Merges the given state into a block whose representative has the same labels, rewards and successor
+            // blocks. If there is no such block, the state is stored as the representative of its block.
+            auto mergeState = [&] (StateType state) {
+                StateInformation& information = getInformation(state);
+                if (information.indexed) {
+                    auto range = blockIndex.equal_range(information.hash);
+                    for (auto it = range.first; it != range.second; ++it) {
+                        if (it->second == state) {
+                            blockIndex.erase(it);
+                            break;
+                        }
+                    }
+                    information.indexed = false;
+                }
+                
+                // Transitions into the own block (e.g. self-loops) do not contribute to the hash, as they lead into
+                // the block of the candidate once the state is merged into it.
+                std::vector<std::pair<StateType, ValueType>> distribution = computeBlockDistribution(state);
+                std::size_t hash = std::hash<storm::storage::BitVector>()(information.labels);
+                boost::hash_combine(hash, information.deadlock);
+                for (auto const& entry : distribution) {
+                    if (entry.first != state) {
+                        boost::hash_combine(hash, entry.first);
+                    }
+                }
+                
+                auto range = blockIndex.equal_range(hash);
+                for (auto it = range.first; it != range.second; ++it) {
+                    StateType candidate = it->second;
+                    StateInformation& candidateInformation = getInformation(candidate);
+                    // The distributions are compared with respect to the blocks after the merge, so that, e.g., two
+                    // absorbing states with the same labels are merged.
+                    if (candidateInformation.deadlock == information.deadlock && candidateInformation.labels == information.labels && candidateInformation.rewards == information.rewards && mergeBlocks(computeBlockDistribution(candidate), state, candidate) == mergeBlocks(distribution, state, candidate)) {
+                        representatives[state] = candidate;
+                        
+                        // The predecessors of the merged state now have a successor in the block of the candidate.
+                        for (auto const& predecessor : information.predecessors) {
+                            StateType representative = findRepresentative(predecessor);
+                            StateInformation& predecessorInformation = getInformation(representative);
+                            if (!predecessorInformation.queued) {
+                                predecessorInformation.queued = true;
+                                statesToCheck.push_back(representative);
+                            }
+                        }
+                        std::vector<StateType>& predecessors = candidateInformation.predecessors;
+                        predecessors.insert(predecessors.end(), information.predecessors.begin(), information.predecessors.end());
+                        for (auto& predecessor : predecessors) {
+                            predecessor = findRepresentative(predecessor);
+                        }
+                        std::sort(predecessors.begin(), predecessors.end());
+                        predecessors.erase(std::unique(predecessors.begin(), predecessors.end()), predecessors.end());
+                        
+                        // Discard everything we know about the merged state.
+                        states.erase(state);
+                        return;
+                    }
+                }
+                
+                information.successors = std::move(distribution);
+                information.hash = hash;
+                information.indexed = true;
+                blockIndex.emplace(hash, state);
+            };
+            
+            updateNumberOfStates();
+            while (!statesToExplore.empty()) {
+                // Get the first state in the queue.
+                CompressedState currentState = statesToExplore.front().first;
+                StateType currentIndex = statesToExplore.front().second;
+                statesToExplore.pop_front();
+                
+                if (currentIndex % 100000 == 0) {
+                    STORM_LOG_TRACE("Exploring state with id " << currentIndex << ".");
+                }
+                
+                // The labels are evaluated before the state is expanded, as expanding may modify the evaluator.
+                generator->load(currentState);
+                storm::storage::BitVector labels(labelExpressions.size());
+                for (uint64_t labelIndex = 0; labelIndex < labelExpressions.size(); ++labelIndex) {
+                    if (generator->satisfies(labelExpressions[labelIndex].second)) {
+                        labels.set(labelIndex);
+                    }
+                }
+                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+                updateNumberOfStates();
+                
+                // The state may already be known as a successor of another state.
+                StateInformation& information = states[currentIndex];
+                information.explored = true;
+                information.labels = std::move(labels);
+                if (behavior.empty()) {
+                    // If there is no behavior, we might have to introduce a self-loop.
+                    STORM_LOG_THROW(!dontFixDeadlocks || !behavior.wasExpanded(), storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
+                    if (behavior.wasExpanded()) {
+                        information.deadlock = true;
+                        this->stateStorage.deadlockStateIndices.push_back(currentIndex);
+                    }
+                    information.successors.emplace_back(currentIndex, storm::utility::one<ValueType>());
+                    for (auto const& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            information.rewards.push_back(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    for (auto const& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            information.rewards.push_back(storm::utility::zero<ValueType>());
+                        }
+                    }
+                } else {
+                    STORM_LOG_ASSERT(behavior.getNumberOfChoices() == 1, "Expected exactly one choice for a state of a deterministic model.");
+                    auto const& choice = behavior.getChoices().front();
+                    for (auto const& stateProbabilityPair : choice) {
+                        information.successors.emplace_back(stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+                        if (rewardModelBuilders[rewardModelIndex].hasStateRewards()) {
+                            information.rewards.push_back(behavior.getStateRewards()[rewardModelIndex]);
+                        }
+                    }
+                    for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewardModelBuilders.size(); ++rewardModelIndex) {
+                        if (rewardModelBuilders[rewardModelIndex].hasStateActionRewards()) {
+                            information.rewards.push_back(choice.getRewards()[rewardModelIndex]);
+                        }
+                    }
+                }
+                for (auto const& successor : information.successors) {
+                    // The information about successors that were not explored yet is created here.
+                    std::vector<StateType>& predecessors = states[findRepresentative(successor.first)].predecessors;
+                    if (predecessors.empty() || predecessors.back() != currentIndex) {
+                        predecessors.push_back(currentIndex);
+                    }
+                }
+                
+                // Merge the state and all states whose successor blocks changed as a consequence.
+                if (!isInitialState(currentIndex)) {
+                    mergeState(currentIndex);
+                }
+                while (!statesToCheck.empty()) {
+                    StateType state = statesToCheck.front();
+                    statesToCheck.pop_front();
+                    // The state may have been merged into another one since it was queued.
+                    auto stateIt = states.find(state);
+                    if (stateIt != states.end()) {
+                        stateIt->second.queued = false;
+                    }
+                    state = findRepresentative(state);
+                    if (getInformation(state).explored && !isInitialState(state)) {
+                        mergeState(state);
+                    }
+                }
+            }
+            
+            // Number the blocks in the order of their representatives.
+            StateType numberOfStates = static_cast<StateType>(stateStorage.getNumberOfStates());
+            representativeStates = storm::storage::BitVector(numberOfStates);
+            std::vector<StateType> blockIndices(numberOfStates);
+            StateType numberOfBlocks = 0;
+            for (StateType state = 0; state < numberOfStates; ++state) {
+                if (findRepresentative(state) == state) {
+                    representativeStates->set(state);
+                    blockIndices[state] = numberOfBlocks;
+                    ++numberOfBlocks;
+                }
+            }
+            for (StateType state = 0; state < numberOfStates; ++state) {
+                blockIndices[state] = blockIndices[findRepresentative(state)];
+            }
+            STORM_LOG_INFO("Merged the " << numberOfStates << " explored states into " << numberOfBlocks << " blocks.");
+            
+            // Build the quotient from the representatives.
+            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(numberOfBlocks, numberOfBlocks, 0, true, false);
+            std::vector<std::pair<StateType, ValueType>> row;
+            for (auto state : representativeStates.get()) {
+                StateInformation& information = getInformation(state);
+                row.clear();
+                for (auto const& successor : information.successors) {
+                    row.emplace_back(blockIndices[successor.first], successor.second);
+                }
+                detail::sortAndCombine(row);
+                for (auto const& entry : row) {
+                    transitionMatrixBuilder.addNextValue(blockIndices[state], entry.first, entry.second);
+                }
+                
+                auto rewardIt = information.rewards.begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*rewardIt);
+                        ++rewardIt;
+                    }
+                }
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateActionRewards()) {
+                        rewardModelBuilder.addStateActionReward(*rewardIt);
+                        ++rewardIt;
+                    }
+                }
+                states.erase(state);
+            }
+            return transitionMatrixBuilder.build();
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatricesExternally(storm::storage::ExternalSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
+            // Create markovian states bit vector, if required.
+            if (generator->getModelType() == storm::generator::ModelType::MA) {
+                // The bit vector will be resized when the correct size is known.
+                markovianStates = storm::storage::BitVector(1000);
+            }
+            
+            std::string directory = options.externalDirectory.empty() ? boost::filesystem::temp_directory_path().string() : options.externalDirectory;
+            uint64_t stateSize = generator->getStateSize();
+            uint64_t wordsPerState = stateSize / 64;
+            StateType const noIndex = std::numeric_limits<StateType>::max();
+            uint64_t const bytesPerDiscoveredState = stateSize / 8 + sizeof(StateType);
+            STORM_LOG_DEBUG("Exploring the state space with a memory limit of " << options.memoryLimit << " bytes in directory '" << directory << "'.");
+            
+            // The known states are stored on disk. The states that are discovered while expanding a chunk of states
+            // are first collected in memory together with preliminary indices that reflect the order of the requests.
+            externalStateToIndex.reset(new storm::storage::ExternalBitVectorMap<StateType>(stateSize, directory));
+            storm::storage::ExternalBitVectorMap<StateType>& stateToIndex = *externalStateToIndex;
+            storm::storage::BitVectorHashMap<StateType> stateToPreliminaryIndex(stateSize, detail::minimalDiscoveredStatesMapSize);
+            uint64_t numberOfRequests = 0;
+            std::function<StateType (CompressedState const&)> stateToIdCallback = [&] (CompressedState const& state) {
+                ++numberOfRequests;
+                return stateToPreliminaryIndex.findOrAdd(state, static_cast<StateType>(stateToPreliminaryIndex.size()));
+            };
+            
+            // Since we explore breadth-first, the states of each layer have consecutive indices. The layers are
+            // stored on disk as well.
+            std::unique_ptr<storm::storage::ExternalBitVectorList> currentLayer;
+            std::unique_ptr<storm::storage::ExternalBitVectorList> nextLayer(new storm::storage::ExternalBitVectorList(stateSize, directory));
+            uint64_t numberOfStates = 0;
+            
+            // Determines the final indices of the discovered states (adding the new ones to the known states and the
+            // next layer) and returns the mapping from preliminary to final indices.
+            auto resolveDiscoveredStates = [&] () {
+                std::vector<uint64_t> keyWords;
+                keyWords.reserve(stateToPreliminaryIndex.size() * wordsPerState);
+                std::vector<StateType> preliminaryIndices;
+                preliminaryIndices.reserve(stateToPreliminaryIndex.size());
+                for (auto const& stateIndexPair : stateToPreliminaryIndex) {
+                    for (uint64_t word = 0; word < wordsPerState; ++word) {
+                        keyWords.push_back(stateIndexPair.first.getAsInt(word * 64, 64));
+                    }
+                    preliminaryIndices.push_back(stateIndexPair.second);
+                }
+                stateToPreliminaryIndex = storm::storage::BitVectorHashMap<StateType>(stateSize, detail::minimalDiscoveredStatesMapSize);
+                numberOfRequests = 0;
+                
+                stateToIndex.sort(keyWords, preliminaryIndices);
+                std::vector<StateType> finalIndices;
+                stateToIndex.find(keyWords, finalIndices, noIndex);
+                
+                std::vector<StateType> preliminaryToFinalIndex(preliminaryIndices.size(), noIndex);
+                std::vector<uint64_t> preliminaryToPosition(preliminaryIndices.size(), std::numeric_limits<uint64_t>::max());
+                for (uint64_t position = 0; position < preliminaryIndices.size(); ++position) {
+                    if (finalIndices[position] == noIndex) {
+                        preliminaryToPosition[preliminaryIndices[position]] = position;
+                    } else {
+                        preliminaryToFinalIndex[preliminaryIndices[position]] = finalIndices[position];
+                    }
+                }
+                
+                // Number the new states in the order in which they were requested, which is the order in which a
+                // sequential breadth-first search discovers them.
+                CompressedState state(stateSize);
+                for (uint64_t preliminaryIndex = 0; preliminaryIndex < preliminaryIndices.size(); ++preliminaryIndex) {
+                    uint64_t position = preliminaryToPosition[preliminaryIndex];
+                    if (position != std::numeric_limits<uint64_t>::max()) {
+                        STORM_LOG_THROW(numberOfStates < noIndex, storm::exceptions::InvalidOperationException, "The number of states exceeds the range of the state indices.");
+                        finalIndices[position] = preliminaryToFinalIndex[preliminaryIndex] = static_cast<StateType>(numberOfStates++);
+                        for (uint64_t word = 0; word < wordsPerState; ++word) {
+                            state.setFromInt(word * 64, 64, keyWords[position * wordsPerState + word]);
+                        }
+                        nextLayer->push_back(state);
+                    }
+                }
+                
+                // Add the new states (which are still sorted) to the known states.
+                std::vector<uint64_t> newKeyWords;
+                std::vector<StateType> newIndices;
+                for (uint64_t position = 0; position < preliminaryIndices.size(); ++position) {
+                    if (preliminaryToPosition[preliminaryIndices[position]] != std::numeric_limits<uint64_t>::max()) {
+                        newKeyWords.insert(newKeyWords.end(), keyWords.begin() + position * wordsPerState, keyWords.begin() + (position + 1) * wordsPerState);
+                        newIndices.push_back(finalIndices[position]);
+                    }
+                }
+                stateToIndex.add(newKeyWords, newIndices);
+                return preliminaryToFinalIndex;
+            };
+            
+            // Let the generator create all initial states.
+            std::vector<StateType> initialStatePreliminaryIndices = generator->getInitialStates(stateToIdCallback);
+            STORM_LOG_THROW(!initialStatePreliminaryIndices.empty(), storm::exceptions::WrongFormatException, "The model does not have a single initial state.");
+            std::vector<StateType> initialStateIndices = resolveDiscoveredStates();
+            for (auto const& preliminaryIndex : initialStatePreliminaryIndices) {
+                this->stateStorage.initialStateIndices.push_back(initialStateIndices[preliminaryIndex]);
+            }
+            
+            uint_fast64_t currentRowGroup = 0;
+            uint_fast64_t currentRow = 0;
+            
+            auto timeOfStart = std::chrono::high_resolution_clock::now();
+            auto timeOfLastMessage = std::chrono::high_resolution_clock::now();
+            uint64_t numberOfExploredStatesSinceLastMessage = 0;
+            
+            std::vector<CompressedState> chunk;
+            std::vector<storm::generator::StateBehavior<ValueType, StateType>> behaviors;
+            CompressedState state(stateSize);
+            while (!nextLayer->empty()) {
+                currentLayer = std::move(nextLayer);
+                nextLayer.reset(new storm::storage::ExternalBitVectorList(stateSize, directory));
+                
+                bool hasState = currentLayer->readNext(state);
+                while (hasState) {
+                    // Expand states of the layer until the memory that is (estimated to be) required for the
+                    // discovered states and the behaviors exceeds the limit.
+                    do {
+                        generator->load(state);
+                        behaviors.push_back(generator->expand(stateToIdCallback));
+                        chunk.push_back(state);
+                        hasState = currentLayer->readNext(state);
+                    } while (hasState && stateToPreliminaryIndex.capacity() * bytesPerDiscoveredState + numberOfRequests * detail::estimatedBytesPerExternalTransition + chunk.size() * bytesPerDiscoveredState < options.memoryLimit);
+                    
+                    std::vector<StateType> preliminaryToFinalIndex = resolveDiscoveredStates();
+                    std::function<StateType (StateType const&)> stateIndexRemapping = [&preliminaryToFinalIndex] (StateType const& index) {
+                        return preliminaryToFinalIndex[index];
+                    };
+                    for (uint64_t position = 0; position < chunk.size(); ++position) {
+                        addStateBehaviorToMatrices(chunk[position], static_cast<StateType>(currentRowGroup), behaviors[position], stateIndexRemapping, transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates, currentRowGroup, currentRow);
+                    }
+                    
+                    if (generator->getOptions().isShowProgressSet()) {
+                        numberOfExploredStatesSinceLastMessage += chunk.size();
+                        
+                        auto now = std::chrono::high_resolution_clock::now();
+                        auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                        if (durationSinceLastMessage > 0 && static_cast<uint64_t>(durationSinceLastMessage) >= generator->getOptions().getShowProgressDelay()) {
+                            auto statesPerSecond = numberOfExploredStatesSinceLastMessage / durationSinceLastMessage;
+                            auto durationSinceStart = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfStart).count();
+                            std::cout << "Explored " << currentRowGroup << " states in " << durationSinceStart << " seconds (currently " << statesPerSecond << " states per second)." << std::endl;
+                            timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                            numberOfExploredStatesSinceLastMessage = 0;
+                        }
+                    }
+                    
+                    chunk.clear();
+                    behaviors.clear();
+                }
+            }
+            STORM_LOG_ASSERT(currentRowGroup == numberOfStates, "Not all discovered states were explored.");
+            
+            if (markovianStates) {
+                // Since we now know the correct size, cut the bit vector to the correct length.
+                markovianStates->resize(currentRowGroup, false);
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        template <typename MatrixBuilderType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateBehaviorToMatrices(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::function<StateType (StateType const&)> const& stateIndexRemapping, MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow) {
+            // If there is no behavior, we might have to introduce a self-loop.
+            if (behavior.empty()) {
+                if (!storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet() || !behavior.wasExpanded()) {
+                    // If the behavior was actually expanded and yet there are no transitions, then we have a deadlock state.
+                    if (behavior.wasExpanded()) {
+                        this->stateStorage.deadlockStateIndices.push_back(stateIndex);
+                    }
+                    
+                    if (markovianStates) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    if (!generator->isDeterministicModel()) {
+                        transitionMatrixBuilder.newRowGroup(currentRow);
+                    }
+                    
+                    transitionMatrixBuilder.addNextValue(currentRow, stateIndex, storm::utility::one<ValueType>());
+                    
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateRewards()) {
+                            rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                        }
+                        
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                        }
+                    }
+                    
+                    ++currentRow;
+                    ++currentRowGroup;
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(state).toString(true) << "). For fixing these, please provide the appropriate option.");
+                }
+            } else {
+                // Add the state rewards to the corresponding reward models.
+                auto stateRewardIt = behavior.getStateRewards().begin();
+                for (auto& rewardModelBuilder : rewardModelBuilders) {
+                    if (rewardModelBuilder.hasStateRewards()) {
+                        rewardModelBuilder.addStateReward(*stateRewardIt);
+                    }
+                    ++stateRewardIt;
+                }
+                
+                // If the model is nondeterministic, we need to open a row group.
+                if (!generator->isDeterministicModel()) {
+                    transitionMatrixBuilder.newRowGroup(currentRow);
+                }
+                
+                // Now add all choices.
+                for (auto const& choice : behavior) {
+                    
+                    // add the generated choice information
+                    if (choice.hasLabels()) {
+                        for (auto const& label : choice.getLabels()) {
+                            choiceInformationBuilder.addLabel(label, currentRow);
+                        }
+                    }
+                    if (choice.hasOriginData()) {
+                        choiceInformationBuilder.addOriginData(choice.getOriginData(), currentRow);
+                    }
+                    
+                    // If we keep track of the Markovian choices, store whether the current one is Markovian.
+                    if (markovianStates && choice.isMarkovian()) {
+                        markovianStates.get().grow(currentRowGroup + 1, false);
+                        markovianStates.get().set(currentRowGroup);
+                    }
+                    
+                    // Add the probabilistic behavior to the matrix.
+                    if (stateIndexRemapping) {
+                        // The remapping does not preserve the order of the successors, so we need to sort them again.
+                        std::vector<std::pair<StateType, ValueType>> remappedDistribution;
+                        remappedDistribution.reserve(choice.size());
+                        for (auto const& stateProbabilityPair : choice) {
+                            remappedDistribution.emplace_back(stateIndexRemapping(stateProbabilityPair.first), stateProbabilityPair.second);
+                        }
+                        std::sort(remappedDistribution.begin(), remappedDistribution.end(), [] (std::pair<StateType, ValueType> const& a, std::pair<StateType, ValueType> const& b) { return a.first < b.first; });
+                        for (auto const& stateProbabilityPair : remappedDistribution) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    } else {
+                        for (auto const& stateProbabilityPair : choice) {
+                            transitionMatrixBuilder.addNextValue(currentRow, stateProbabilityPair.first, stateProbabilityPair.second);
+                        }
+                    }
+                    
+                    // Add the rewards to the reward models.
+                    auto choiceRewardIt = choice.getRewards().begin();
+                    for (auto& rewardModelBuilder : rewardModelBuilders) {
+                        if (rewardModelBuilder.hasStateActionRewards()) {
+                            rewardModelBuilder.addStateActionReward(*choiceRewardIt);
+                        }
+                        ++choiceRewardIt;
+                    }
+                    ++currentRow;
+                }
+                ++currentRowGroup;
+            }
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::storage::sparse::ModelComponents<ValueType, RewardModelType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildModelComponents() {
             
@@ -303,7 +1049,6 @@ namespace storm {
             bool deterministicModel = generator->isDeterministicModel();
             
             // Prepare the component builders
-            storm::storage::SparseMatrixBuilder<ValueType> transitionMatrixBuilder(0, 0, 0, false, !deterministicModel, 0);
             std::vector<RewardModelBuilder<typename RewardModelType::ValueType>> rewardModelBuilders;
             for (uint64_t i = 0; i < generator->getNumberOfRewardModels(); ++i) {
                 rewardModelBuilders.emplace_back(generator->getRewardModelInformation(i));
@@ -311,10 +1056,22 @@ namespace storm {
             ChoiceInformationBuilder choiceInformationBuilder;
             boost::optional<storm::storage::BitVector> markovianStates;
             
-            buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+            storm::storage::SparseMatrix<ValueType> transitionMatrix;
+            if (isLumpingOnTheFlyEnabled()) {
+                transitionMatrix = buildLumpedMatrices(rewardModelBuilders);
+            } else if (isExternalExplorationEnabled()) {
+                std::string directory = options.externalDirectory.empty() ? boost::filesystem::temp_directory_path().string() : options.externalDirectory;
+                storm::storage::ExternalSparseMatrixBuilder<ValueType> transitionMatrixBuilder(directory, !deterministicModel);
+                buildMatricesExternally(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+            } else {
+                storm::storage::ChunkedSparseMatrixBuilder<ValueType> transitionMatrixBuilder(!deterministicModel);
+                buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
+                transitionMatrix = transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount());
+            }
             
             // Initialize the model components with the obtained information.
-            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(std::move(transitionMatrix), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
             
             // Now finalize all reward models.
             for (auto& rewardModelBuilder : rewardModelBuilders) {
@@ -326,9 +1083,9 @@ namespace storm {
             // If requested, build the state valuations and choice origins
             if (generator->getOptions().isBuildStateValuationsSet()) {
                 std::vector<storm::expressions::SimpleValuation> valuations(modelComponents.transitionMatrix.getRowGroupCount());
-                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-                    valuations[bitVectorIndexPair.second] = generator->toValuation(bitVectorIndexPair.first);
-                }
+                forEachExploredState([&] (CompressedState const& state, StateType const& index) {
+                    valuations[index] = generator->toValuation(state);
+                });
                 modelComponents.stateValuations = storm::storage::sparse::StateValuations(std::move(valuations));
             }
             if (generator->getOptions().isBuildChoiceOriginsSet()) {
@@ -401,12 +1158,37 @@ namespace storm {
                 }
                 modelComponents.observabilityClasses = classes;
             }
+            
+            // The states stored on disk are no longer needed.
+            externalStateToIndex.reset();
             return modelComponents;
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
         storm::models::sparse::StateLabeling ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildStateLabeling() {
-            return generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+            storm::models::sparse::StateLabeling result;
+            if (externalStateToIndex) {
+                // The states are streamed from disk rather than loaded into the state storage.
+                result = generator->label(externalStateToIndex->size(), [this] (std::function<void (CompressedState const&, StateType const&)> const& function) { forEachExploredState(function); }, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+            } else {
+                result = generator->label(stateStorage, stateStorage.initialStateIndices, stateStorage.deadlockStateIndices);
+            }
+            if (representativeStates) {
+                // As the labels of merged states coincide, the labels of the blocks are the ones of their representatives.
+                return result.getSubLabeling(representativeStates.get());
+            }
+            return result;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::forEachExploredState(std::function<void (CompressedState const&, StateType const&)> const& function) const {
+            if (externalStateToIndex) {
+                externalStateToIndex->forEach(function);
+            } else {
+                for (auto const& stateIndexPair : stateStorage.stateToId) {
+                    function(stateIndexPair.first, stateIndexPair.second);
+                }
+            }
         }
         
         // Explicitly instantiate the class.
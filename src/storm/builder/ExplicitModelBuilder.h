@@ -19,6 +19,9 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+#include "storm/storage/ExternalBitVectorMap.h"
+#include "storm/storage/ExternalSparseMatrixBuilder.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
 #include "storm/settings/SettingsManager.h"
@@ -57,6 +60,29 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // The number of threads used to explore the model. Using more than one thread requires breadth-first
+                // exploration and a generator that can be cloned. The resulting model does not depend on this number.
+                uint64_t numberOfThreads;
+                
+                // If non-zero, the explored states and the transitions are stored on disk and this number of bytes
+                // bounds the memory used for exploring the states in between. This requires breadth-first exploration.
+                uint64_t memoryLimit;
+                
+                // The directory in which the files are stored if a memory limit is given. If empty, the directory for
+                // temporary files is used.
+                std::string externalDirectory;
+
+                // If set, the explored states are stored in compressed form (see BitVectorTreeCompression). This only
+                // has an effect if the states have more than 64 bits.
+                bool compressStates;
+
+                // If set, a state of a deterministic model is merged into a previously explored state as soon as both
+                // have the same labels and rewards and their successors coincide up to the states merged so far (where
+                // transitions into the blocks of the two states, e.g. self-loops, are treated alike). The
+                // transitions of merged states are discarded right away. The result is a bisimulation quotient of the
+                // model, which is, however, not necessarily the coarsest one.
+                bool lumpStates;
             };
             
             /*!
@@ -109,7 +135,69 @@ namespace storm {
              * @param choiceInformationBuilder The builder for the requested information of the choices
              * @param markovianChoices is set to a bit vector storing whether a choice is markovian (is only set if the model type requires this information).
              */
-            void buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
+            void buildMatrices(storm::storage::ChunkedSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
+            
+            /*!
+             * Explores the states in the exploration queue (and all states reachable from them) breadth-first using
+             * the given number of threads. Each layer of the search is expanded concurrently and the newly discovered
+             * states are then numbered in the order in which a sequential breadth-first search discovers them. Hence,
+             * the result coincides with the one obtained by sequential exploration.
+             *
+             * @param generators The generators to use, one for each thread.
+             * @param currentRowGroup The next row group of the transition matrix. Is updated accordingly.
+             * @param currentRow The next row of the transition matrix. Is updated accordingly.
+             * The remaining parameters are as in buildMatrices.
+             */
+            void exploreStatesInParallel(std::vector<std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>>> const& generators, storm::storage::ChunkedSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow);
+            
+            /*!
+             * Builds the transition matrix and the transition reward matrix like buildMatrices, but stores the explored
+             * states and the transitions on disk. The states are explored breadth-first in chunks whose size is bounded
+             * by the memory limit. The successors of a chunk are looked up in the (sorted) files of known states at
+             * once (delayed duplicate detection) and the new states are numbered in the order in which a sequential
+             * breadth-first search discovers them. Hence, the result coincides with the one obtained by exploring the
+             * states in memory. The known states remain on disk (see externalStateToIndex) and are never loaded into
+             * the state storage.
+             *
+             * The parameters are as in buildMatrices.
+             */
+            void buildMatricesExternally(storm::storage::ExternalSparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices);
+            
+            /*!
+             * Retrieves whether the states and transitions are to be stored on disk while exploring the model.
+             */
+            bool isExternalExplorationEnabled() const;
+            
+            /*!
+             * Explores the model like buildMatrices, but merges states while exploring them (see Options::lumpStates).
+             * Only the transitions of the states that represent a block are kept. Whenever a state is merged, its
+             * predecessors are checked again, as their successors may now coincide with the ones of other states.
+             * Initial states are never merged.
+             *
+             * @param rewardModelBuilders The builders for the selected reward models.
+             * @return The transition matrix of the quotient. The states that represent the blocks are stored in
+             * representativeStates.
+             */
+            storm::storage::SparseMatrix<ValueType> buildLumpedMatrices(std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders);
+            
+            /*!
+             * Retrieves whether states are to be merged while exploring the model.
+             */
+            bool isLumpingOnTheFlyEnabled() const;
+            
+            /*!
+             * Adds the given behavior of the given state to the matrices (and fixes deadlocks, if necessary).
+             *
+             * @param state The state whose behavior is added.
+             * @param stateIndex The index of the state.
+             * @param behavior The behavior of the state.
+             * @param stateIndexRemapping If given, this function is applied to all successor indices of the behavior.
+             * @param currentRowGroup The next row group of the transition matrix. Is updated accordingly.
+             * @param currentRow The next row of the transition matrix. Is updated accordingly.
+             * The remaining parameters are as in buildMatrices.
+             */
+            template<typename MatrixBuilderType>
+            void addStateBehaviorToMatrices(CompressedState const& state, StateType const& stateIndex, storm::generator::StateBehavior<ValueType, StateType> const& behavior, std::function<StateType (StateType const&)> const& stateIndexRemapping, MatrixBuilderType& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianChoices, uint_fast64_t& currentRowGroup, uint_fast64_t& currentRow);
             
             /*!
              * Explores the state space of the given program and returns the components of the model as a result.
@@ -125,6 +213,12 @@ namespace storm {
              */
             storm::models::sparse::StateLabeling buildStateLabeling();
             
+            /*!
+             * Calls the given function for each explored state (together with its index), regardless of whether the
+             * states are kept in the state storage or on disk.
+             */
+            void forEachExploredState(std::function<void (CompressedState const&, StateType const&)> const& function) const;
+            
             /// The generator to use for the building process.
             std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
             
@@ -140,6 +234,12 @@ namespace storm {
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
             /// built in case the exploration order is not BFS.
             boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+            
+            /// If states were merged while exploring the model, the (explored) states that represent the blocks.
+            boost::optional<storm::storage::BitVector> representativeStates;
+            
+            /// If the states were stored on disk while exploring the model, the map from the states to their indices.
+            std::unique_ptr<storm::storage::ExternalBitVectorMap<StateType>> externalStateToIndex;
 
         };
         
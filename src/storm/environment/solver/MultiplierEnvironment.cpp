@@ -2,8 +2,10 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/MultiplierSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     
@@ -11,6 +13,10 @@ namespace storm {
         auto const& multiplierSettings = storm::settings::getModule<storm::settings::modules::MultiplierSettings>();
         type = multiplierSettings.getMultiplierType();
         typeSetFromDefault = multiplierSettings.isMultiplierTypeSetFromDefaultValue();
+        splitStorage = multiplierSettings.isSplitStorageSet();
+        mixedPrecision = multiplierSettings.isMixedPrecisionSet();
+        mixedPrecisionRefinement = multiplierSettings.isMixedPrecisionRefinementSet();
+        numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
     }
     
     MultiplierEnvironment::~MultiplierEnvironment() {
@@ -30,4 +36,37 @@ namespace storm {
         typeSetFromDefault = isSetFromDefault;
     }
     
+    bool const& MultiplierEnvironment::isSplitStorageSet() const {
+        return splitStorage;
+    }
+    
+    void MultiplierEnvironment::setSplitStorage(bool value) {
+        splitStorage = value;
+    }
+    
+    bool const& MultiplierEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+    
+    void MultiplierEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+    
+    bool const& MultiplierEnvironment::isMixedPrecisionRefinementSet() const {
+        return mixedPrecisionRefinement;
+    }
+    
+    void MultiplierEnvironment::setMixedPrecisionRefinement(bool value) {
+        mixedPrecisionRefinement = value;
+    }
+    
+    uint64_t const& MultiplierEnvironment::getNumberOfThreads() const {
+        return numberOfThreads;
+    }
+    
+    void MultiplierEnvironment::setNumberOfThreads(uint64_t value) {
+        STORM_LOG_THROW(value > 0, storm::exceptions::InvalidArgumentException, "The number of threads must be positive.");
+        numberOfThreads = value;
+    }
+    
 }
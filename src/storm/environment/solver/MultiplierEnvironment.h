@@ -14,10 +14,22 @@ namespace storm {
         storm::solver::MultiplierType const& getType() const;
         bool const& isTypeSetFromDefault() const;
         void setType(storm::solver::MultiplierType value, bool isSetFromDefault = false);
+        bool const& isSplitStorageSet() const;
+        void setSplitStorage(bool value);
+        bool const& isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        bool const& isMixedPrecisionRefinementSet() const;
+        void setMixedPrecisionRefinement(bool value);
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
         
     private:
         storm::solver::MultiplierType type;
         bool typeSetFromDefault;
+        bool splitStorage;
+        bool mixedPrecision;
+        bool mixedPrecisionRefinement;
+        uint64_t numberOfThreads;
     };
 }
 
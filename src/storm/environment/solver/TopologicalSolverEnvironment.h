@@ -20,12 +20,18 @@ namespace storm {
         bool const& isUnderlyingMinMaxMethodSetFromDefault() const;
         void setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod value);
         
+        uint64_t const& getNumberOfThreads() const;
+        void setNumberOfThreads(uint64_t value);
+        
     private:
         storm::solver::EquationSolverType underlyingEquationSolverType;
         bool underlyingEquationSolverTypeSetFromDefault;
         
         storm::solver::MinMaxMethod underlyingMinMaxMethod;
         bool underlyingMinMaxMethodSetFromDefault;
+        
+        // The number of threads used for the SCC decomposition and for solving independent SCCs concurrently.
+        uint64_t numberOfThreads;
     };
 }
 
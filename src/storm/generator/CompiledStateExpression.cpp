@@ -0,0 +1,267 @@
+#include "storm/generator/CompiledStateExpression.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace detail {
+            // Expressions whose evaluation needs at most this many stack entries are evaluated without allocating memory.
+            static const uint64_t maximalLocalStackSize = 32;
+
+            // The tolerance that ExprTk uses when comparing two numbers for equality.
+            static const double equalityTolerance = 0.0000000001;
+
+            static inline bool isEqual(double first, double second) {
+                return std::abs(first - second) <= std::max(1.0, std::max(std::abs(first), std::abs(second))) * equalityTolerance;
+            }
+        }
+
+        bool CompiledStateExpression::evaluateAsBool(CompressedState const& state) const {
+            return evaluate(state) == 1.0;
+        }
+
+        int_fast64_t CompiledStateExpression::evaluateAsInt(CompressedState const& state) const {
+            return static_cast<int_fast64_t>(evaluate(state));
+        }
+
+        double CompiledStateExpression::evaluateAsDouble(CompressedState const& state) const {
+            return evaluate(state);
+        }
+
+        double CompiledStateExpression::evaluate(CompressedState const& state) const {
+            STORM_LOG_ASSERT(!instructions.empty(), "Cannot evaluate empty expression.");
+
+            double localStack[detail::maximalLocalStackSize];
+            std::vector<double> allocatedStack;
+            double* stack = localStack;
+            if (maximalStackSize > detail::maximalLocalStackSize) {
+                allocatedStack.resize(maximalStackSize);
+                stack = allocatedStack.data();
+            }
+
+            // The top of the stack.
+            double* top = stack - 1;
+            for (uint64_t position = 0, end = instructions.size(); position < end; ++position) {
+                Instruction const& instruction = instructions[position];
+                switch (instruction.opCode) {
+                    case OpCode::LoadConstant: *++top = instruction.constant; break;
+                    case OpCode::LoadBoolean: *++top = state.get(instruction.bitOffset) ? 1.0 : 0.0; break;
+                    case OpCode::LoadInteger: *++top = static_cast<double>(static_cast<int_fast64_t>(state.getAsInt(instruction.bitOffset, instruction.bitWidth)) + instruction.integerOperand); break;
+                    case OpCode::Plus: --top; *top = *top + top[1]; break;
+                    case OpCode::Minus: --top; *top = *top - top[1]; break;
+                    case OpCode::Times: --top; *top = *top * top[1]; break;
+                    case OpCode::Divide: --top; *top = *top / top[1]; break;
+                    case OpCode::Power: --top; *top = std::pow(*top, top[1]); break;
+                    case OpCode::Modulo: --top; *top = std::fmod(*top, top[1]); break;
+                    case OpCode::Max: --top; *top = std::max(*top, top[1]); break;
+                    case OpCode::Min: --top; *top = std::min(*top, top[1]); break;
+                    case OpCode::Negate: *top = -*top; break;
+                    case OpCode::Floor: *top = std::floor(*top); break;
+                    case OpCode::Ceil: *top = std::ceil(*top); break;
+                    case OpCode::Equal: --top; *top = detail::isEqual(*top, top[1]) ? 1.0 : 0.0; break;
+                    case OpCode::NotEqual: --top; *top = detail::isEqual(*top, top[1]) ? 0.0 : 1.0; break;
+                    case OpCode::Less: --top; *top = *top < top[1] ? 1.0 : 0.0; break;
+                    case OpCode::LessOrEqual: --top; *top = *top <= top[1] ? 1.0 : 0.0; break;
+                    case OpCode::Greater: --top; *top = *top > top[1] ? 1.0 : 0.0; break;
+                    case OpCode::GreaterOrEqual: --top; *top = *top >= top[1] ? 1.0 : 0.0; break;
+                    case OpCode::Not: *top = *top == 0.0 ? 1.0 : 0.0; break;
+                    case OpCode::Xor: --top; *top = (*top == 0.0) != (top[1] == 0.0) ? 1.0 : 0.0; break;
+                    case OpCode::JumpIfFalse:
+                        if (*top-- == 0.0) {
+                            position = instruction.integerOperand - 1;
+                        }
+                        break;
+                    case OpCode::JumpIfFalseOrPop:
+                        if (*top == 0.0) {
+                            position = instruction.integerOperand - 1;
+                        } else {
+                            --top;
+                        }
+                        break;
+                    case OpCode::JumpIfTrueOrPop:
+                        if (*top != 0.0) {
+                            *top = 1.0;
+                            position = instruction.integerOperand - 1;
+                        } else {
+                            --top;
+                        }
+                        break;
+                    case OpCode::Jump: position = instruction.integerOperand - 1; break;
+                }
+            }
+            STORM_LOG_ASSERT(top == stack, "Expected exactly one value on the stack.");
+            return *top;
+        }
+
+        StateExpressionCompiler::StateExpressionCompiler(VariableInformation const& variableInformation) : currentExpression(nullptr), currentStackSize(0) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                if (locationVariable.bitWidth != 0) {
+                    variableToLoadInstruction[locationVariable.variable] = Instruction{OpCode::LoadInteger, locationVariable.bitOffset, locationVariable.bitWidth, 0, 0.0};
+                } else {
+                    variableToLoadInstruction[locationVariable.variable] = Instruction{OpCode::LoadConstant, 0, 0, 0, 0.0};
+                }
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToLoadInstruction[booleanVariable.variable] = Instruction{OpCode::LoadBoolean, booleanVariable.bitOffset, 1, 0, 0.0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableToLoadInstruction[integerVariable.variable] = Instruction{OpCode::LoadInteger, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, 0.0};
+            }
+        }
+
+        CompiledStateExpression StateExpressionCompiler::compile(storm::expressions::Expression const& expression) {
+            CompiledStateExpression result;
+            currentExpression = &result;
+            currentStackSize = 0;
+            expression.getBaseExpression().accept(*this, boost::none);
+            STORM_LOG_ASSERT(currentStackSize == 1, "Compiled expression leaves " << currentStackSize << " values on the stack.");
+            currentExpression = nullptr;
+            return result;
+        }
+
+        uint64_t StateExpressionCompiler::emit(Instruction const& instruction, int_fast64_t stackSizeDifference) {
+            currentExpression->instructions.push_back(instruction);
+            currentStackSize += stackSizeDifference;
+            currentExpression->maximalStackSize = std::max(currentExpression->maximalStackSize, currentStackSize);
+            return currentExpression->instructions.size() - 1;
+        }
+
+        uint64_t StateExpressionCompiler::emit(OpCode opCode, int_fast64_t stackSizeDifference) {
+            return emit(Instruction{opCode, 0, 0, 0, 0.0}, stackSizeDifference);
+        }
+
+        void StateExpressionCompiler::setJumpTargetToNextInstruction(uint64_t jumpPosition) {
+            currentExpression->instructions[jumpPosition].integerOperand = currentExpression->instructions.size();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) {
+            expression.getCondition()->accept(*this, data);
+            uint64_t jumpToElse = emit(OpCode::JumpIfFalse, -1);
+            expression.getThenExpression()->accept(*this, data);
+            uint64_t jumpToEnd = emit(OpCode::Jump, 0);
+
+            // Only one of the branches is executed, so the else branch starts with the stack size before the then branch.
+            --currentStackSize;
+            setJumpTargetToNextInstruction(jumpToElse);
+            expression.getElseExpression()->accept(*this, data);
+            setJumpTargetToNextInstruction(jumpToEnd);
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            // Conjunctions, disjunctions and implications only evaluate their second operand if necessary.
+            uint64_t jump;
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And:
+                    expression.getFirstOperand()->accept(*this, data);
+                    jump = emit(OpCode::JumpIfFalseOrPop, -1);
+                    expression.getSecondOperand()->accept(*this, data);
+                    setJumpTargetToNextInstruction(jump);
+                    break;
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or:
+                    expression.getFirstOperand()->accept(*this, data);
+                    jump = emit(OpCode::JumpIfTrueOrPop, -1);
+                    expression.getSecondOperand()->accept(*this, data);
+                    setJumpTargetToNextInstruction(jump);
+                    break;
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies:
+                    expression.getFirstOperand()->accept(*this, data);
+                    emit(OpCode::Not, 0);
+                    jump = emit(OpCode::JumpIfTrueOrPop, -1);
+                    expression.getSecondOperand()->accept(*this, data);
+                    setJumpTargetToNextInstruction(jump);
+                    break;
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor:
+                    expression.getFirstOperand()->accept(*this, data);
+                    expression.getSecondOperand()->accept(*this, data);
+                    emit(OpCode::Xor, -1);
+                    break;
+                case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff:
+                    expression.getFirstOperand()->accept(*this, data);
+                    expression.getSecondOperand()->accept(*this, data);
+                    emit(OpCode::Equal, -1);
+                    break;
+            }
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            expression.getFirstOperand()->accept(*this, data);
+            expression.getSecondOperand()->accept(*this, data);
+            switch (expression.getOperatorType()) {
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: emit(OpCode::Plus, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: emit(OpCode::Minus, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: emit(OpCode::Times, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: emit(OpCode::Divide, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: emit(OpCode::Power, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Modulo: emit(OpCode::Modulo, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: emit(OpCode::Max, -1); break;
+                case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: emit(OpCode::Min, -1); break;
+            }
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) {
+            expression.getFirstOperand()->accept(*this, data);
+            expression.getSecondOperand()->accept(*this, data);
+            switch (expression.getRelationType()) {
+                case storm::expressions::BinaryRelationExpression::RelationType::Equal: emit(OpCode::Equal, -1); break;
+                case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: emit(OpCode::NotEqual, -1); break;
+                case storm::expressions::BinaryRelationExpression::RelationType::Less: emit(OpCode::Less, -1); break;
+                case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: emit(OpCode::LessOrEqual, -1); break;
+                case storm::expressions::BinaryRelationExpression::RelationType::Greater: emit(OpCode::Greater, -1); break;
+                case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: emit(OpCode::GreaterOrEqual, -1); break;
+            }
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::VariableExpression const& expression, boost::any const&) {
+            auto loadInstructionIt = variableToLoadInstruction.find(expression.getVariable());
+            STORM_LOG_THROW(loadInstructionIt != variableToLoadInstruction.end(), storm::exceptions::NotSupportedException, "Cannot compile expression referring to variable '" << expression.getVariableName() << "', because it is not part of the state.");
+            emit(loadInstructionIt->second, 1);
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) {
+            expression.getOperand()->accept(*this, data);
+            switch (expression.getOperatorType()) {
+                case storm::expressions::UnaryBooleanFunctionExpression::OperatorType::Not: emit(OpCode::Not, 0); break;
+            }
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) {
+            expression.getOperand()->accept(*this, data);
+            switch (expression.getOperatorType()) {
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus: emit(OpCode::Negate, 0); break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor: emit(OpCode::Floor, 0); break;
+                case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil: emit(OpCode::Ceil, 0); break;
+            }
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) {
+            emit(Instruction{OpCode::LoadConstant, 0, 0, 0, expression.getValue() ? 1.0 : 0.0}, 1);
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) {
+            emit(Instruction{OpCode::LoadConstant, 0, 0, 0, static_cast<double>(expression.getValue())}, 1);
+            return boost::any();
+        }
+
+        boost::any StateExpressionCompiler::visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) {
+            emit(Instruction{OpCode::LoadConstant, 0, 0, 0, expression.getValueAsDouble()}, 1);
+            return boost::any();
+        }
+
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace generator {
+
+        struct VariableInformation;
+        class StateExpressionCompiler;
+
+        /*!
+         * An expression that was compiled into a compact bytecode that reads the values of the variables directly from
+         * a compressed state. Evaluating such an expression does not require to unpack the state into an evaluator.
+         *
+         * All values are represented as doubles and all operations behave as they do in ExprTk, so the results coincide
+         * with the ones of ExpressionEvaluator<double>.
+         */
+        class CompiledStateExpression {
+        public:
+            /*!
+             * Creates an empty expression that must not be evaluated.
+             */
+            CompiledStateExpression() = default;
+
+            /*!
+             * Evaluates the expression in the given state and interprets the result as a boolean.
+             */
+            bool evaluateAsBool(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the expression in the given state and interprets the result as an integer.
+             */
+            int_fast64_t evaluateAsInt(CompressedState const& state) const;
+
+            /*!
+             * Evaluates the expression in the given state and interprets the result as a rational number.
+             */
+            double evaluateAsDouble(CompressedState const& state) const;
+
+        private:
+            friend class StateExpressionCompiler;
+
+            enum class OpCode : uint8_t {
+                LoadConstant, LoadBoolean, LoadInteger,
+                Plus, Minus, Times, Divide, Power, Modulo, Max, Min, Negate, Floor, Ceil,
+                Equal, NotEqual, Less, LessOrEqual, Greater, GreaterOrEqual,
+                Not, Xor,
+                // Pops the top of the stack and jumps if it is false.
+                JumpIfFalse,
+                // Jumps if the top of the stack is false (or true, respectively) and pops it otherwise.
+                JumpIfFalseOrPop, JumpIfTrueOrPop,
+                Jump
+            };
+
+            struct Instruction {
+                OpCode opCode;
+
+                // The position of the variable in the compressed state (for loads).
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+
+                // The offset of integer variables (for loads of integers) or the target of a jump.
+                int_fast64_t integerOperand;
+
+                // The value of a constant.
+                double constant;
+            };
+
+            /*!
+             * Evaluates the expression in the given state.
+             */
+            double evaluate(CompressedState const& state) const;
+
+            // The instructions of the expression.
+            std::vector<Instruction> instructions;
+
+            // The maximal number of values on the stack during the evaluation.
+            uint64_t maximalStackSize = 0;
+        };
+
+        /*!
+         * Compiles expressions over the variables of a compressed state.
+         */
+        class StateExpressionCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            /*!
+             * Creates a compiler for expressions over the variables with the given information.
+             */
+            StateExpressionCompiler(VariableInformation const& variableInformation);
+
+            /*!
+             * Compiles the given expression. If the expression refers to variables that are not part of the compressed
+             * state, a NotSupportedException is thrown.
+             */
+            CompiledStateExpression compile(storm::expressions::Expression const& expression);
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const& data) override;
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const& data) override;
+
+        private:
+            typedef CompiledStateExpression::OpCode OpCode;
+            typedef CompiledStateExpression::Instruction Instruction;
+
+            /*!
+             * Appends an instruction that changes the stack size by the given difference and returns its position.
+             */
+            uint64_t emit(Instruction const& instruction, int_fast64_t stackSizeDifference);
+            uint64_t emit(OpCode opCode, int_fast64_t stackSizeDifference);
+
+            /*!
+             * Lets the jump at the given position point to the next instruction that is emitted.
+             */
+            void setJumpTargetToNextInstruction(uint64_t jumpPosition);
+
+            // The load instructions for all variables of the compressed state.
+            std::unordered_map<storm::expressions::Variable, Instruction> variableToLoadInstruction;
+
+            // The expression that is currently compiled.
+            CompiledStateExpression* currentExpression;
+
+            // The size of the stack after executing the instructions emitted so far.
+            uint64_t currentStackSize;
+        };
+
+    }
+}
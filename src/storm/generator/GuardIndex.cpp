@@ -0,0 +1,205 @@
+#include "storm/generator/GuardIndex.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace detail {
+            // Variables with more values are not considered for indexing.
+            static const uint64_t maximalNumberOfBuckets = 1ull << 16;
+
+            // Variables whose buckets would store more entries than this are not considered for indexing.
+            static const uint64_t maximalNumberOfBucketEntries = 1ull << 22;
+
+            // A variable of the state that may be used for indexing.
+            struct IndexVariable {
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                int_fast64_t lowerBound;
+                int_fast64_t upperBound;
+            };
+
+            typedef std::pair<int_fast64_t, int_fast64_t> Range;
+
+            static void restrictRange(Range& range, storm::expressions::OperatorType relation, int_fast64_t constant) {
+                switch (relation) {
+                    case storm::expressions::OperatorType::Equal:
+                        range.first = std::max(range.first, constant);
+                        range.second = std::min(range.second, constant);
+                        break;
+                    case storm::expressions::OperatorType::Less: range.second = std::min(range.second, constant - 1); break;
+                    case storm::expressions::OperatorType::LessOrEqual: range.second = std::min(range.second, constant); break;
+                    case storm::expressions::OperatorType::Greater: range.first = std::max(range.first, constant + 1); break;
+                    case storm::expressions::OperatorType::GreaterOrEqual: range.first = std::max(range.first, constant); break;
+                    default: break;
+                }
+            }
+
+            static storm::expressions::OperatorType mirrorRelation(storm::expressions::OperatorType relation) {
+                switch (relation) {
+                    case storm::expressions::OperatorType::Less: return storm::expressions::OperatorType::Greater;
+                    case storm::expressions::OperatorType::LessOrEqual: return storm::expressions::OperatorType::GreaterOrEqual;
+                    case storm::expressions::OperatorType::Greater: return storm::expressions::OperatorType::Less;
+                    case storm::expressions::OperatorType::GreaterOrEqual: return storm::expressions::OperatorType::LessOrEqual;
+                    default: return relation;
+                }
+            }
+
+            static bool isIntegerConstant(storm::expressions::Expression const& expression) {
+                return expression.hasIntegerType() && !expression.containsVariables();
+            }
+
+            /*!
+             * Restricts the ranges of the index variables to the values for which the given conjunction may hold.
+             * Conjuncts that are not of the form variable-relation-constant (or a possibly negated boolean variable)
+             * are ignored.
+             */
+            static void restrictRanges(storm::expressions::Expression const& conjunction, std::unordered_map<storm::expressions::Variable, uint64_t> const& variableToIndex, std::vector<Range>& ranges) {
+                if (conjunction.isVariable()) {
+                    auto indexIt = variableToIndex.find(conjunction.getBaseExpression().asVariableExpression().getVariable());
+                    if (indexIt != variableToIndex.end() && conjunction.hasBooleanType()) {
+                        restrictRange(ranges[indexIt->second], storm::expressions::OperatorType::Equal, 1);
+                    }
+                    return;
+                }
+                if (!conjunction.isFunctionApplication()) {
+                    return;
+                }
+
+                storm::expressions::OperatorType operatorType = conjunction.getOperator();
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::And:
+                        restrictRanges(conjunction.getOperand(0), variableToIndex, ranges);
+                        restrictRanges(conjunction.getOperand(1), variableToIndex, ranges);
+                        break;
+                    case storm::expressions::OperatorType::Not: {
+                        storm::expressions::Expression operand = conjunction.getOperand(0);
+                        if (operand.isVariable()) {
+                            auto indexIt = variableToIndex.find(operand.getBaseExpression().asVariableExpression().getVariable());
+                            if (indexIt != variableToIndex.end()) {
+                                restrictRange(ranges[indexIt->second], storm::expressions::OperatorType::Equal, 0);
+                            }
+                        }
+                        break;
+                    }
+                    case storm::expressions::OperatorType::Equal:
+                    case storm::expressions::OperatorType::Less:
+                    case storm::expressions::OperatorType::LessOrEqual:
+                    case storm::expressions::OperatorType::Greater:
+                    case storm::expressions::OperatorType::GreaterOrEqual: {
+                        storm::expressions::Expression variableOperand = conjunction.getOperand(0);
+                        storm::expressions::Expression constantOperand = conjunction.getOperand(1);
+                        if (constantOperand.isVariable()) {
+                            std::swap(variableOperand, constantOperand);
+                            operatorType = mirrorRelation(operatorType);
+                        }
+                        if (variableOperand.isVariable() && variableOperand.hasIntegerType() && isIntegerConstant(constantOperand)) {
+                            auto indexIt = variableToIndex.find(variableOperand.getBaseExpression().asVariableExpression().getVariable());
+                            if (indexIt != variableToIndex.end()) {
+                                restrictRange(ranges[indexIt->second], operatorType, constantOperand.evaluateAsInt());
+                            }
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+
+        GuardIndex::GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards) {
+            allGuards.resize(guards.size());
+            for (uint64_t position = 0; position < guards.size(); ++position) {
+                allGuards[position] = position;
+            }
+
+            // Gather the variables that may be used for indexing.
+            std::vector<detail::IndexVariable> indexVariables;
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableToIndex[booleanVariable.variable] = indexVariables.size();
+                indexVariables.push_back(detail::IndexVariable{booleanVariable.bitOffset, 1, 0, 1});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                // Variables with a single value do not occupy bits in the state (and do not discriminate any guards).
+                if (integerVariable.bitWidth > 0 && static_cast<uint64_t>(integerVariable.upperBound - integerVariable.lowerBound) < detail::maximalNumberOfBuckets) {
+                    variableToIndex[integerVariable.variable] = indexVariables.size();
+                    indexVariables.push_back(detail::IndexVariable{integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, integerVariable.upperBound});
+                }
+            }
+            if (indexVariables.empty() || guards.size() < 2) {
+                return;
+            }
+
+            // Determine the values of the variables for which the guards may hold.
+            std::vector<std::vector<detail::Range>> guardRanges;
+            guardRanges.reserve(guards.size());
+            for (auto const& guard : guards) {
+                std::vector<detail::Range> ranges;
+                ranges.reserve(indexVariables.size());
+                for (auto const& indexVariable : indexVariables) {
+                    ranges.emplace_back(indexVariable.lowerBound, indexVariable.upperBound);
+                }
+                detail::restrictRanges(guard, variableToIndex, ranges);
+                guardRanges.push_back(std::move(ranges));
+            }
+
+            // Pick the variable that minimizes the average number of candidates.
+            uint64_t bestVariable = indexVariables.size();
+            double bestAverageNumberOfCandidates = static_cast<double>(guards.size());
+            for (uint64_t variable = 0; variable < indexVariables.size(); ++variable) {
+                uint64_t numberOfEntries = 0;
+                for (auto const& ranges : guardRanges) {
+                    if (ranges[variable].first <= ranges[variable].second) {
+                        numberOfEntries += ranges[variable].second - ranges[variable].first + 1;
+                    }
+                }
+                uint64_t numberOfValues = indexVariables[variable].upperBound - indexVariables[variable].lowerBound + 1;
+                double averageNumberOfCandidates = static_cast<double>(numberOfEntries) / static_cast<double>(numberOfValues);
+                if (numberOfEntries <= detail::maximalNumberOfBucketEntries && averageNumberOfCandidates < bestAverageNumberOfCandidates) {
+                    bestVariable = variable;
+                    bestAverageNumberOfCandidates = averageNumberOfCandidates;
+                }
+            }
+            if (bestVariable == indexVariables.size()) {
+                return;
+            }
+
+            detail::IndexVariable const& indexVariable = indexVariables[bestVariable];
+            bitOffset = indexVariable.bitOffset;
+            bitWidth = indexVariable.bitWidth;
+            buckets.resize(indexVariable.upperBound - indexVariable.lowerBound + 1);
+            for (uint64_t position = 0; position < guards.size(); ++position) {
+                detail::Range const& range = guardRanges[position][bestVariable];
+                for (int_fast64_t value = range.first; value <= range.second; ++value) {
+                    buckets[value - indexVariable.lowerBound].push_back(position);
+                }
+            }
+            STORM_LOG_TRACE("Indexed " << guards.size() << " guards with " << bestAverageNumberOfCandidates << " candidates per state on average.");
+        }
+
+        std::vector<uint64_t> const& GuardIndex::getCandidates(CompressedState const& state) const {
+            if (buckets.empty()) {
+                return allGuards;
+            }
+            uint64_t value = state.getAsInt(bitOffset, bitWidth);
+            if (value >= buckets.size()) {
+                return allGuards;
+            }
+            return buckets[value];
+        }
+
+        bool GuardIndex::isDiscriminating() const {
+            return !buckets.empty();
+        }
+
+    }
+}
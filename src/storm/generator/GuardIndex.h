@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace generator {
+
+        struct VariableInformation;
+
+        /*!
+         * An index over a list of guards that determines for a given state a (typically small) superset of the guards
+         * that hold in the state. This way, only few guards need to be evaluated when exploring the state.
+         *
+         * For this, the conjuncts of each guard that compare a single variable with a constant (such as x>=3 or !b)
+         * restrict the values of the variable for which the guard may hold. The index picks the boolean or bounded
+         * integer variable that discriminates the guards best and stores the candidate guards for each of its values.
+         */
+        class GuardIndex {
+        public:
+            /*!
+             * Creates an empty index.
+             */
+            GuardIndex() = default;
+
+            /*!
+             * Creates an index for the given guards.
+             *
+             * @param variableInformation The information about the variables of the states.
+             * @param guards The guards to index.
+             */
+            GuardIndex(VariableInformation const& variableInformation, std::vector<storm::expressions::Expression> const& guards);
+
+            /*!
+             * Retrieves the positions (in ascending order) of the guards that may hold in the given state. Guards that
+             * are not contained are guaranteed to not hold in the state.
+             */
+            std::vector<uint64_t> const& getCandidates(CompressedState const& state) const;
+
+            /*!
+             * Retrieves whether the index excludes guards for some states.
+             */
+            bool isDiscriminating() const;
+
+        private:
+            // The positions of all guards.
+            std::vector<uint64_t> allGuards;
+
+            // The position of the variable that is used to look up the candidates in the compressed state.
+            uint64_t bitOffset = 0;
+            uint64_t bitWidth = 0;
+
+            // The candidate guards for each value of the variable (as stored in the compressed state). If empty, the
+            // index does not discriminate the guards.
+            std::vector<std::vector<uint64_t>> buckets;
+        };
+
+    }
+}
@@ -42,6 +42,8 @@ namespace storm {
         template<typename ValueType, typename StateType>
         JaniNextStateGenerator<ValueType, StateType>::JaniNextStateGenerator(storm::jani::Model const& model, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(model.getExpressionManager(), options), model(model), rewardExpressions(), hasStateActionRewards(false), evaluateRewardExpressionsAtEdges(false), evaluateRewardExpressionsAtDestinations(false) {
             STORM_LOG_THROW(!this->options.isBuildChoiceLabelsSet(), storm::exceptions::InvalidSettingsException, "JANI next-state generator cannot generate choice labels.");
+            STORM_LOG_WARN_COND(!this->options.isPartialOrderReductionSet(), "The JANI next-state generator does not support partial-order reduction. Building the full model.");
+            STORM_LOG_WARN_COND(!this->options.isSymmetryReductionSet(), "The JANI next-state generator does not support symmetry reduction. Building the full model.");
 
             auto features = this->model.getModelFeatures();
             features.remove(storm::jani::ModelFeature::DerivedOperators);
@@ -85,6 +87,7 @@ namespace storm {
             this->variableInformation.registerArrayVariableReplacements(arrayEliminatorData);
             this->transientVariableInformation = TransientVariableInformation<ValueType>(this->model, this->parallelAutomata);
             this->transientVariableInformation.registerArrayVariableReplacements(arrayEliminatorData);
+            this->createGuardIndices();
             
             // Create a proper evaluator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(this->model.getManager());
@@ -828,7 +831,8 @@ namespace storm {
         std::vector<Choice<ValueType>> JaniNextStateGenerator<ValueType, StateType>::getActionChoices(std::vector<uint64_t> const& locations, CompressedState const& state, StateToIdCallback stateToIdCallback, EdgeFilter const& edgeFilter) {
             std::vector<Choice<ValueType>> result;
             
-            for (auto const& outputAndEdges : edges) {
+            for (uint64_t synchronizationIndex = 0; synchronizationIndex < edges.size(); ++synchronizationIndex) {
+                auto const& outputAndEdges = edges[synchronizationIndex];
                 auto const& edges = outputAndEdges.second;
                 if (edges.size() == 1) {
                     // If the synch consists of just one element, it's non-synchronizing.
@@ -837,7 +841,10 @@ namespace storm {
 
                     auto edgesIt = nonsychingEdges.second.find(locations[automatonIndex]);
                     if (edgesIt != nonsychingEdges.second.end()) {
-                        for (auto const& indexAndEdge : edgesIt->second) {
+                        // Only consider the edges whose guard may hold.
+                        GuardIndex const& guardIndex = edgeGuardIndices[synchronizationIndex].front().at(edgesIt->first);
+                        for (uint64_t position : guardIndex.getCandidates(state)) {
+                            auto const& indexAndEdge = edgesIt->second[position];
                             if (edgeFilter != EdgeFilter::All) {
                                 STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
                                 if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
@@ -865,14 +872,17 @@ namespace storm {
                     uint64_t outputActionIndex = outputAndEdges.first.get();
                     
                     bool productiveCombination = true;
-                    for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    for (uint64_t participantIndex = 0; participantIndex < outputAndEdges.second.size(); ++participantIndex) {
+                        auto const& automatonAndEdges = outputAndEdges.second[participantIndex];
                         uint64_t automatonIndex = automatonAndEdges.first;
                         EdgeSetWithIndices enabledEdgesOfAutomaton;
                         
                         bool atLeastOneEdge = false;
                         auto edgesIt = automatonAndEdges.second.find(locations[automatonIndex]);
                         if (edgesIt != automatonAndEdges.second.end()) {
-                            for (auto const& indexAndEdge : edgesIt->second) {
+                            GuardIndex const& guardIndex = edgeGuardIndices[synchronizationIndex][participantIndex].at(edgesIt->first);
+                            for (uint64_t position : guardIndex.getCandidates(state)) {
+                                auto const& indexAndEdge = edgesIt->second[position];
                                 if (edgeFilter != EdgeFilter::All) {
                                     STORM_LOG_ASSERT(edgeFilter == EdgeFilter::WithRate || edgeFilter == EdgeFilter::WithoutRate, "Unexpected edge filter.");
                                     if ((edgeFilter == EdgeFilter::WithRate) != indexAndEdge.second->hasRate()) {
@@ -943,6 +953,11 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         storm::models::sparse::StateLabeling JaniNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices) {
+            return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, getLabelExpressions());
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<std::pair<std::string, storm::expressions::Expression>> JaniNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
             // As in JANI we can use transient boolean variable assignments in locations to identify states, we need to
             // create a list of boolean transient variables and the expressions that define them.
             std::unordered_map<storm::expressions::Variable, storm::expressions::Expression> transientVariableToExpressionMap;
@@ -963,7 +978,9 @@ namespace storm {
             for (auto const& element : transientVariableToExpressionMap) {
                 transientVariableExpressions.push_back(std::make_pair(element.first.getName(), element.second));
             }
-            return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, transientVariableExpressions);
+            std::vector<std::pair<std::string, storm::expressions::Expression>> expressionLabels = NextStateGenerator<ValueType, StateType>::getLabelExpressions();
+            transientVariableExpressions.insert(transientVariableExpressions.end(), expressionLabels.begin(), expressionLabels.end());
+            return transientVariableExpressions;
         }
         
         template<typename ValueType, typename StateType>
@@ -1087,6 +1104,27 @@ namespace storm {
             STORM_LOG_TRACE("Number of synchronizations: " << this->edges.size() << ".");
         }
         
+        template<typename ValueType, typename StateType>
+        void JaniNextStateGenerator<ValueType, StateType>::createGuardIndices() {
+            edgeGuardIndices.clear();
+            for (auto const& outputAndEdges : edges) {
+                std::vector<std::unordered_map<uint64_t, GuardIndex>> guardIndicesOfSynchronization;
+                for (auto const& automatonAndEdges : outputAndEdges.second) {
+                    std::unordered_map<uint64_t, GuardIndex> guardIndicesOfAutomaton;
+                    for (auto const& locationAndEdges : automatonAndEdges.second) {
+                        std::vector<storm::expressions::Expression> guards;
+                        guards.reserve(locationAndEdges.second.size());
+                        for (auto const& indexAndEdge : locationAndEdges.second) {
+                            guards.push_back(indexAndEdge.second->getGuard());
+                        }
+                        guardIndicesOfAutomaton.emplace(locationAndEdges.first, GuardIndex(this->variableInformation, guards));
+                    }
+                    guardIndicesOfSynchronization.push_back(std::move(guardIndicesOfAutomaton));
+                }
+                edgeGuardIndices.push_back(std::move(guardIndicesOfSynchronization));
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         std::shared_ptr<storm::storage::sparse::ChoiceOrigins> JaniNextStateGenerator<ValueType, StateType>::generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const {
             if (!this->getOptions().isBuildChoiceOriginsSet()) {
@@ -1120,6 +1158,16 @@ namespace storm {
             return std::make_shared<storm::storage::sparse::JaniChoiceOrigins>(std::make_shared<storm::jani::Model>(model), std::move(identifiers), std::move(identifierToEdgeIndexSetMapping));
         }
         
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> JaniNextStateGenerator<ValueType, StateType>::clone() const {
+            // The model was already preprocessed and applying the preprocessing steps again does not change it. However,
+            // the information about eliminated arrays would be lost, so we do not support cloning in this case.
+            if (!arrayEliminatorData.eliminatedArrayVariables.empty()) {
+                return nullptr;
+            }
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new JaniNextStateGenerator<ValueType, StateType>(model, this->options, false));
+        }
+        
         template<typename ValueType, typename StateType>
         void JaniNextStateGenerator<ValueType, StateType>::checkValid() const {
             // If the program still contains undefined constants and we are not in a parametric setting, assemble an appropriate error message.
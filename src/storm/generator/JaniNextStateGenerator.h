@@ -2,6 +2,7 @@
 
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/TransientVariableInformation.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/jani/Model.h"
 #include "storm/storage/jani/ArrayEliminator.h"
@@ -44,8 +45,11 @@ namespace storm {
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
                         
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) override;
+            virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
             
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
+
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
             
         private:
             /*!
@@ -143,6 +147,11 @@ namespace storm {
              */
             void createSynchronizationInformation();
             
+            /*!
+             * Builds the guard indices for the edges that need to be explored.
+             */
+            void createGuardIndices();
+            
             /*!
              * Checks the underlying model for validity for this next-state generator.
              */
@@ -157,6 +166,10 @@ namespace storm {
             /// The vector storing the edges that need to be explored (synchronously or asynchronously).
             std::vector<OutputAndEdges> edges;
             
+            /// For each element of edges and each participating automaton, the indices over the guards of the edges
+            /// leaving each location. The candidates refer to positions in the corresponding edge sets.
+            std::vector<std::vector<std::unordered_map<uint64_t, GuardIndex>>> edgeGuardIndices;
+            
             /// The names and defining expressions of reward models that need to be considered.
             std::vector<std::pair<std::string, storm::expressions::Expression>> rewardExpressions;
             
@@ -46,6 +46,17 @@ namespace storm {
         uint64_t NextStateGenerator<ValueType, StateType>::getStateSize() const {
             return variableInformation.getTotalBitOffset(true);
         }
+
+        template<typename ValueType, typename StateType>
+        std::vector<uint64_t> NextStateGenerator<ValueType, StateType>::getStateSegmentOffsets() const {
+            std::vector<uint64_t> result = {0};
+            for (auto const& offset : variableInformation.moduleBitOffsets) {
+                if (offset > result.back()) {
+                    result.push_back(offset);
+                }
+            }
+            return result;
+        }
         
         template<typename ValueType, typename StateType>
         void NextStateGenerator<ValueType, StateType>::load(CompressedState const& state) {
@@ -64,10 +75,28 @@ namespace storm {
             return evaluator->asBool(expression);
         }
         
+        template<typename ValueType, typename StateType>
+        std::vector<std::pair<std::string, storm::expressions::Expression>> NextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
+            return this->options.getExpressionLabels();
+        }
+        
+        template<typename ValueType, typename StateType>
+        storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(uint64_t numberOfStates, std::function<void (std::function<void (CompressedState const&, StateType const&)> const&)> const& forEachState, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices) {
+            return label(numberOfStates, forEachState, initialStateIndices, deadlockStateIndices, getLabelExpressions());
+        }
+        
         template<typename ValueType, typename StateType>
         storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions) {
-            
-            labelsAndExpressions.insert(labelsAndExpressions.end(), this->options.getExpressionLabels().begin(), this->options.getExpressionLabels().end());
+            auto forEachState = [&stateStorage] (std::function<void (CompressedState const&, StateType const&)> const& function) {
+                for (auto const& stateIndexPair : stateStorage.stateToId) {
+                    function(stateIndexPair.first, stateIndexPair.second);
+                }
+            };
+            return label(stateStorage.getNumberOfStates(), forEachState, initialStateIndices, deadlockStateIndices, std::move(labelsAndExpressions));
+        }
+        
+        template<typename ValueType, typename StateType>
+        storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(uint64_t numberOfStates, std::function<void (std::function<void (CompressedState const&, StateType const&)> const&)> const& forEachState, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions) {
             
             // Make the labels unique.
             std::sort(labelsAndExpressions.begin(), labelsAndExpressions.end(), [] (std::pair<std::string, storm::expressions::Expression> const& a, std::pair<std::string, storm::expressions::Expression> const& b) { return a.first < b.first; } );
@@ -75,24 +104,29 @@ namespace storm {
             labelsAndExpressions.resize(std::distance(labelsAndExpressions.begin(), it));
             
             // Prepare result.
-            storm::models::sparse::StateLabeling result(stateStorage.getNumberOfStates());
+            storm::models::sparse::StateLabeling result(numberOfStates);
             
             // Initialize labeling.
             for (auto const& label : labelsAndExpressions) {
                 result.addLabel(label.first);
             }
             
-            auto const& states = stateStorage.stateToId;
-            for (auto const& stateIndexPair : states) {
-                unpackStateIntoEvaluator(stateIndexPair.first, variableInformation, *this->evaluator);
+            bool checkOutOfBoundsState = this->options.isAddOutOfBoundsStateSet();
+            boost::optional<StateType> outOfBoundsStateIndex;
+            forEachState([&] (CompressedState const& state, StateType const& index) {
+                unpackStateIntoEvaluator(state, variableInformation, *this->evaluator);
                 
                 for (auto const& label : labelsAndExpressions) {
                     // Add label to state, if the corresponding expression is true.
                     if (evaluator->asBool(label.second)) {
-                        result.addLabelToState(label.first, stateIndexPair.second);
+                        result.addLabelToState(label.first, index);
                     }
                 }
-            }
+                
+                if (checkOutOfBoundsState && state == outOfBoundsState) {
+                    outOfBoundsStateIndex = index;
+                }
+            });
             
             if (!result.containsLabel("init")) {
                 // Also label the initial state with the special label "init".
@@ -116,10 +150,10 @@ namespace storm {
                 }
             }
 
-            if (this->options.isAddOutOfBoundsStateSet() && stateStorage.stateToId.contains(outOfBoundsState)) {
+            if (outOfBoundsStateIndex) {
                 STORM_LOG_THROW(!result.containsLabel("out_of_bounds"),storm::exceptions::WrongFormatException, "Label 'out_of_bounds' is reserved when adding out of bounds states.");
                 result.addLabel("out_of_bounds");
-                result.addLabelToState("out_of_bounds", stateStorage.stateToId.getValue(outOfBoundsState));
+                result.addLabelToState("out_of_bounds", outOfBoundsStateIndex.get());
             }
             
             return result;
@@ -194,6 +228,11 @@ namespace storm {
             }
             // Nothing to be done.
         }
+        
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> NextStateGenerator<ValueType, StateType>::clone() const {
+            return nullptr;
+        }
 
         template class NextStateGenerator<double>;
 
@@ -48,6 +48,13 @@ namespace storm {
             virtual ~NextStateGenerator() = default;
             
             uint64_t getStateSize() const;
+
+            /*!
+             * Retrieves the bit offsets at which the segments of the states start. The first segment holds the global
+             * variables and each further segment holds the variables of one module (automaton).
+             */
+            std::vector<uint64_t> getStateSegmentOffsets() const;
+
             virtual ModelType getModelType() const = 0;
             virtual bool isDeterministicModel() const = 0;
             virtual bool isDiscreteTimeModel() const = 0;
@@ -67,6 +74,20 @@ namespace storm {
 
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) = 0;
 
+            /*!
+             * Creates the state labeling for states that are not kept in a state storage.
+             *
+             * @param numberOfStates The number of states.
+             * @param forEachState A function that calls its argument once for each state (together with its index).
+             */
+            storm::models::sparse::StateLabeling label(uint64_t numberOfStates, std::function<void (std::function<void (CompressedState const&, StateType const&)> const&)> const& forEachState, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {});
+
+            /*!
+             * Retrieves the labels (and the expressions defining them) that label() derives from the variables of the
+             * states, i.e., all labels except for special ones like init and deadlock.
+             */
+            virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const;
+
             NextStateGeneratorOptions const& getOptions() const;
             
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const;
@@ -78,11 +99,24 @@ namespace storm {
              */
             void remapStateIds(std::function<StateType(StateType const&)> const& remapping);
             
+            /*!
+             * Creates a new generator for the same model and options that does not share any mutable data with this
+             * generator. In particular, the new generator can expand states concurrently to this one.
+             *
+             * @return The new generator or a null pointer if this generator does not support cloning.
+             */
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const;
+            
         protected:
             /*!
              * Creates the state labeling for the given states using the provided labels and expressions.
              */
             storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions);
+
+            /*!
+             * Creates the state labeling for the enumerated states using the provided labels and expressions.
+             */
+            storm::models::sparse::StateLabeling label(uint64_t numberOfStates, std::function<void (std::function<void (CompressedState const&, StateType const&)> const&)> const& forEachState, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions);
             
             void postprocess(StateBehavior<ValueType, StateType>& result);
             
@@ -17,6 +17,7 @@
 #include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/exceptions/UnexpectedException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace generator {
@@ -27,7 +28,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false), useCompiledExpressions(false) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
                         
@@ -38,6 +39,11 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            if (this->options.isCompiledExpressionsSet()) {
+                compileExpressions();
+            }
+            createGuardIndices();
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -80,6 +86,18 @@ namespace storm {
                     }
                 }
             }
+            
+            // Symmetries and ample sets depend on the labels, terminal states and rewards, so we determine them last.
+            if (this->options.isSymmetryReductionSet()) {
+                detectSymmetricModules();
+            }
+            if (this->options.isPartialOrderReductionSet()) {
+                if (symmetricModules.empty()) {
+                    computeAmpleCandidates();
+                } else {
+                    STORM_LOG_WARN("Partial-order reduction cannot be combined with symmetry reduction. Building the model without partial-order reduction.");
+                }
+            }
         }
 
         template<typename ValueType, typename StateType>
@@ -143,6 +161,24 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::getInitialStates(StateToIdCallback const& stateToIdCallback) {
+            if (symmetricModules.empty()) {
+                return enumerateInitialStates(stateToIdCallback);
+            }
+            
+            // With symmetry reduction, only the canonical states are registered, so several initial states may be
+            // mapped to the same index.
+            std::vector<StateType> initialStateIndices = enumerateInitialStates([this, &stateToIdCallback] (CompressedState const& state) {
+                CompressedState canonicalState(state);
+                this->orderBySymmetry(canonicalState);
+                return stateToIdCallback(canonicalState);
+            });
+            std::sort(initialStateIndices.begin(), initialStateIndices.end());
+            initialStateIndices.erase(std::unique(initialStateIndices.begin(), initialStateIndices.end()), initialStateIndices.end());
+            return initialStateIndices;
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<StateType> PrismNextStateGenerator<ValueType, StateType>::enumerateInitialStates(StateToIdCallback const& stateToIdCallback) {
             std::vector<StateType> initialStateIndices;
 
             // If all states are initial, we can simplify the enumeration substantially.
@@ -252,6 +288,20 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expand(StateToIdCallback const& stateToIdCallback) {
+            if (symmetricModules.empty()) {
+                return expandState(stateToIdCallback);
+            }
+            
+            // With symmetry reduction, the successors are only registered in their canonical form.
+            return expandState([this, &stateToIdCallback] (CompressedState const& state) {
+                CompressedState canonicalState(state);
+                this->orderBySymmetry(canonicalState);
+                return stateToIdCallback(canonicalState);
+            });
+        }
+        
+        template<typename ValueType, typename StateType>
+        StateBehavior<ValueType, StateType> PrismNextStateGenerator<ValueType, StateType>::expandState(StateToIdCallback const& stateToIdCallback) {
             // Prepare the result, in case we return early.
             StateBehavior<ValueType, StateType> result;
             
@@ -293,8 +343,14 @@ namespace storm {
                     allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback, CommandFilter::Markovian);
                 }
             } else {
-                allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
-                allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback);
+                // If partial-order reduction is applied, a single (ample) choice may suffice.
+                if (!ampleCandidates.empty()) {
+                    allChoices = getAmpleChoices(*this->state, stateToIdCallback);
+                }
+                if (allChoices.empty()) {
+                    allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
+                    allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback);
+                }
             }
             for (auto& choice : allLabeledChoices) {
                     allChoices.push_back(std::move(choice));
@@ -376,10 +432,592 @@ namespace storm {
             return result;
         }
         
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileExpressions() {
+            if (!std::is_same<ValueType, double>::value) {
+                STORM_LOG_WARN("Compiled expressions are only available for double precision. Falling back to the default evaluation.");
+                return;
+            }
+            
+            std::unordered_map<storm::expressions::Variable, uint64_t> booleanVariableToIndex;
+            for (uint64_t index = 0; index < this->variableInformation.booleanVariables.size(); ++index) {
+                booleanVariableToIndex[this->variableInformation.booleanVariables[index].variable] = index;
+            }
+            std::unordered_map<storm::expressions::Variable, uint64_t> integerVariableToIndex;
+            for (uint64_t index = 0; index < this->variableInformation.integerVariables.size(); ++index) {
+                integerVariableToIndex[this->variableInformation.integerVariables[index].variable] = index;
+            }
+            
+            StateExpressionCompiler compiler(this->variableInformation);
+            try {
+                for (auto const& module : program.getModules()) {
+                    for (auto const& command : module.getCommands()) {
+                        if (compiledGuards.size() <= command.getGlobalIndex()) {
+                            compiledGuards.resize(command.getGlobalIndex() + 1);
+                        }
+                        compiledGuards[command.getGlobalIndex()] = compiler.compile(command.getGuardExpression());
+                        
+                        for (auto const& update : command.getUpdates()) {
+                            if (compiledUpdates.size() <= update.getGlobalIndex()) {
+                                compiledUpdates.resize(update.getGlobalIndex() + 1);
+                            }
+                            CompiledUpdate& compiledUpdate = compiledUpdates[update.getGlobalIndex()];
+                            compiledUpdate.likelihood = compiler.compile(update.getLikelihoodExpression());
+                            for (auto const& assignment : update.getAssignments()) {
+                                CompiledAssignment compiledAssignment;
+                                compiledAssignment.expression = compiler.compile(assignment.getExpression());
+                                auto booleanVariableIt = booleanVariableToIndex.find(assignment.getVariable());
+                                if (booleanVariableIt != booleanVariableToIndex.end()) {
+                                    compiledAssignment.booleanVariable = true;
+                                    compiledAssignment.variableIndex = booleanVariableIt->second;
+                                } else {
+                                    auto integerVariableIt = integerVariableToIndex.find(assignment.getVariable());
+                                    STORM_LOG_THROW(integerVariableIt != integerVariableToIndex.end(), storm::exceptions::NotSupportedException, "Cannot compile assignment to variable '" << assignment.getVariableName() << "'.");
+                                    compiledAssignment.booleanVariable = false;
+                                    compiledAssignment.variableIndex = integerVariableIt->second;
+                                }
+                                compiledUpdate.assignments.push_back(std::move(compiledAssignment));
+                            }
+                        }
+                    }
+                }
+            } catch (storm::exceptions::NotSupportedException const& e) {
+                STORM_LOG_WARN("Unable to compile the expressions of the program (" << e.what() << "). Falling back to the default evaluation.");
+                compiledGuards.clear();
+                compiledUpdates.clear();
+                return;
+            }
+            useCompiledExpressions = true;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::createGuardIndices() {
+            auto indexCommands = [this] (storm::prism::Module const& module, std::vector<uint64_t>&& commandIndices) {
+                std::vector<storm::expressions::Expression> guards;
+                guards.reserve(commandIndices.size());
+                for (auto const& commandIndex : commandIndices) {
+                    guards.push_back(module.getCommand(commandIndex).getGuardExpression());
+                }
+                IndexedCommands result;
+                result.guardIndex = GuardIndex(this->variableInformation, guards);
+                result.commandIndices = std::move(commandIndices);
+                return result;
+            };
+            
+            for (auto const& module : program.getModules()) {
+                std::vector<uint64_t> unlabeledCommandIndices;
+                for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    if (!module.getCommand(commandIndex).isLabeled()) {
+                        unlabeledCommandIndices.push_back(commandIndex);
+                    }
+                }
+                unlabeledCommands.push_back(indexCommands(module, std::move(unlabeledCommandIndices)));
+                
+                labeledCommands.emplace_back();
+                for (auto const& actionIndex : module.getSynchronizingActionIndices()) {
+                    std::set<uint_fast64_t> const& commandIndices = module.getCommandIndicesByActionIndex(actionIndex);
+                    labeledCommands.back()[actionIndex] = indexCommands(module, std::vector<uint64_t>(commandIndices.begin(), commandIndices.end()));
+                }
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::computeAmpleCandidates() {
+            if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+                STORM_LOG_WARN("Partial-order reduction is only supported for MDPs. Building the full model.");
+                return;
+            }
+            if (!rewardModels.empty()) {
+                STORM_LOG_WARN("Partial-order reduction does not preserve rewards. Building the full model.");
+                return;
+            }
+            
+            // Number the variables, so we can represent sets of variables as bit vectors.
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+            for (auto const& booleanVariable : this->variableInformation.booleanVariables) {
+                variableToIndex.emplace(booleanVariable.variable, variableToIndex.size());
+            }
+            for (auto const& integerVariable : this->variableInformation.integerVariables) {
+                variableToIndex.emplace(integerVariable.variable, variableToIndex.size());
+            }
+            uint64_t numberOfVariables = variableToIndex.size();
+            auto addVariables = [&variableToIndex] (storm::expressions::Expression const& expression, storm::storage::BitVector& variables) {
+                for (auto const& variable : expression.getVariables()) {
+                    // Variables that are not part of the state (e.g. parameters) are never written.
+                    auto variableIt = variableToIndex.find(variable);
+                    if (variableIt != variableToIndex.end()) {
+                        variables.set(variableIt->second);
+                    }
+                }
+            };
+            
+            // Determine the variables that are observed by the labels and the terminal states.
+            storm::storage::BitVector visibleVariables(numberOfVariables);
+            if (this->options.isBuildAllLabelsSet()) {
+                for (auto const& label : program.getLabels()) {
+                    addVariables(label.getStatePredicateExpression(), visibleVariables);
+                }
+            } else {
+                for (auto const& labelName : this->options.getLabelNames()) {
+                    if (program.hasLabel(labelName)) {
+                        addVariables(program.getLabelExpression(labelName), visibleVariables);
+                    }
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                addVariables(expressionLabel.second, visibleVariables);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                addVariables(expressionBool.first, visibleVariables);
+            }
+            
+            // The actions of the program are its unlabeled commands and its synchronizing actions. For each action, we
+            // collect the variables read by its guards, all variables it reads and the variables it writes.
+            struct ActionVariables {
+                ActionVariables(uint64_t numberOfVariables) : guardVariables(numberOfVariables), readVariables(numberOfVariables), writtenVariables(numberOfVariables) {
+                    // Intentionally left empty.
+                }
+                
+                storm::storage::BitVector guardVariables;
+                storm::storage::BitVector readVariables;
+                storm::storage::BitVector writtenVariables;
+            };
+            auto addCommand = [&] (storm::prism::Command const& command, ActionVariables& action) {
+                addVariables(command.getGuardExpression(), action.guardVariables);
+                addVariables(command.getGuardExpression(), action.readVariables);
+                for (auto const& update : command.getUpdates()) {
+                    addVariables(update.getLikelihoodExpression(), action.readVariables);
+                    for (auto const& assignment : update.getAssignments()) {
+                        addVariables(assignment.getExpression(), action.readVariables);
+                        action.writtenVariables.set(variableToIndex.at(assignment.getVariable()));
+                    }
+                }
+            };
+            
+            std::vector<ActionVariables> actions;
+            std::vector<std::pair<uint64_t, uint64_t>> unlabeledCommandPositions;
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                for (uint64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    if (!module.getCommand(commandIndex).isLabeled()) {
+                        actions.emplace_back(numberOfVariables);
+                        addCommand(module.getCommand(commandIndex), actions.back());
+                        unlabeledCommandPositions.emplace_back(moduleIndex, commandIndex);
+                    }
+                }
+            }
+            std::vector<uint64_t> synchronizingActionIndices(program.getSynchronizingActionIndices().begin(), program.getSynchronizingActionIndices().end());
+            for (auto const& actionIndex : synchronizingActionIndices) {
+                actions.emplace_back(numberOfVariables);
+                for (auto const& module : program.getModules()) {
+                    if (module.hasActionIndex(actionIndex)) {
+                        for (auto const& commandIndex : module.getCommandIndicesByActionIndex(actionIndex)) {
+                            addCommand(module.getCommand(commandIndex), actions.back());
+                        }
+                    }
+                }
+            }
+            
+            // Two actions are independent if neither writes a variable the other one reads or writes. Then, they can
+            // neither enable nor disable each other and executing them in either order yields the same distribution.
+            auto areDependent = [] (ActionVariables const& first, ActionVariables const& second) {
+                return !first.writtenVariables.isDisjointFrom(second.readVariables | second.writtenVariables) || !second.writtenVariables.isDisjointFrom(first.readVariables);
+            };
+            
+            for (uint64_t candidate = 0; candidate < unlabeledCommandPositions.size(); ++candidate) {
+                ActionVariables const& candidateVariables = actions[candidate];
+                
+                // For MDPs, the command must be probabilistically trivial. Otherwise, a scheduler of the reduced model
+                // would have to resolve the remaining choices before the outcome of the command is known, whereas a
+                // scheduler of the full model may take them after observing it.
+                if (program.getModule(unlabeledCommandPositions[candidate].first).getCommand(unlabeledCommandPositions[candidate].second).getNumberOfUpdates() != 1) {
+                    continue;
+                }
+                
+                // The command must not change the valuation of the labels (invisibility).
+                if (!candidateVariables.writtenVariables.isDisjointFrom(visibleVariables)) {
+                    continue;
+                }
+                
+                storm::storage::BitVector dependentActions(actions.size());
+                storm::storage::BitVector writtenByIndependentActions(numberOfVariables);
+                for (uint64_t action = 0; action < actions.size(); ++action) {
+                    if (action != candidate && areDependent(candidateVariables, actions[action])) {
+                        dependentActions.set(action);
+                    } else if (action != candidate) {
+                        writtenByIndependentActions |= actions[action].writtenVariables;
+                    }
+                }
+                
+                // In a state in which all dependent actions are disabled, they need to stay disabled until the command
+                // is executed. This holds if the independent actions do not write any variable read by their guards.
+                bool dependentActionsStayDisabled = true;
+                for (auto const& action : dependentActions) {
+                    if (!actions[action].guardVariables.isDisjointFrom(writtenByIndependentActions)) {
+                        dependentActionsStayDisabled = false;
+                        break;
+                    }
+                }
+                if (!dependentActionsStayDisabled) {
+                    continue;
+                }
+                
+                AmpleCandidate ampleCandidate;
+                ampleCandidate.moduleIndex = unlabeledCommandPositions[candidate].first;
+                ampleCandidate.commandIndex = unlabeledCommandPositions[candidate].second;
+                for (auto const& action : dependentActions) {
+                    if (action < unlabeledCommandPositions.size()) {
+                        ampleCandidate.dependentUnlabeledCommands.push_back(unlabeledCommandPositions[action]);
+                    } else {
+                        ampleCandidate.dependentActionIndices.push_back(synchronizingActionIndices[action - unlabeledCommandPositions.size()]);
+                    }
+                }
+                ampleCandidates.push_back(std::move(ampleCandidate));
+            }
+            STORM_LOG_DEBUG("Partial-order reduction may reduce the states in which " << ampleCandidates.size() << " of " << unlabeledCommandPositions.size() << " unlabeled commands are enabled.");
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoices(CompressedState const& state, StateToIdCallback stateToIdCallback) {
+            std::vector<Choice<ValueType>> result;
+            
+            for (auto const& candidate : ampleCandidates) {
+                storm::prism::Command const& command = program.getModule(candidate.moduleIndex).getCommand(candidate.commandIndex);
+                if (!isEnabled(command)) {
+                    continue;
+                }
+                
+                // The command is only an ample set if all actions that depend on it are disabled.
+                bool dependentActionEnabled = false;
+                for (auto const& moduleCommandPair : candidate.dependentUnlabeledCommands) {
+                    if (isEnabled(program.getModule(moduleCommandPair.first).getCommand(moduleCommandPair.second))) {
+                        dependentActionEnabled = true;
+                        break;
+                    }
+                }
+                for (auto it = candidate.dependentActionIndices.begin(), ite = candidate.dependentActionIndices.end(); !dependentActionEnabled && it != ite; ++it) {
+                    dependentActionEnabled = static_cast<bool>(getActiveCommandsByActionIndex(*it));
+                }
+                if (dependentActionEnabled) {
+                    continue;
+                }
+                
+                result.push_back(getUnlabeledChoice(state, command, stateToIdCallback));
+                
+                // Every cycle of the reduced model needs to contain a fully expanded state. As each cycle contains a
+                // state with a successor whose index is not larger than its own, we fully expand all such states.
+                StateType currentIndex = stateToIdCallback(state);
+                for (auto const& stateProbabilityPair : result.back()) {
+                    if (stateProbabilityPair.first <= currentIndex) {
+                        result.clear();
+                        break;
+                    }
+                }
+                return result;
+            }
+            
+            return result;
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::detectSymmetricModules() {
+            if (program.getModelType() == storm::prism::Program::ModelType::POMDP) {
+                STORM_LOG_WARN("Symmetry reduction is not supported for POMDPs. Building the full model.");
+                return;
+            }
+            
+            // Determine the module of each local variable.
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToModuleIndex;
+            for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                for (auto const& booleanVariable : program.getModule(moduleIndex).getBooleanVariables()) {
+                    variableToModuleIndex.emplace(booleanVariable.getExpressionVariable(), moduleIndex);
+                }
+                for (auto const& integerVariable : program.getModule(moduleIndex).getIntegerVariables()) {
+                    variableToModuleIndex.emplace(integerVariable.getExpressionVariable(), moduleIndex);
+                }
+            }
+            auto getLocalVariables = [] (storm::prism::Module const& module) {
+                std::vector<storm::expressions::Variable> result;
+                for (auto const& booleanVariable : module.getBooleanVariables()) {
+                    result.push_back(booleanVariable.getExpressionVariable());
+                }
+                for (auto const& integerVariable : module.getIntegerVariables()) {
+                    result.push_back(integerVariable.getExpressionVariable());
+                }
+                return result;
+            };
+            auto getReadVariables = [] (storm::prism::Module const& module) {
+                std::set<storm::expressions::Variable> result;
+                for (auto const& command : module.getCommands()) {
+                    command.getGuardExpression().gatherVariables(result);
+                    for (auto const& update : command.getUpdates()) {
+                        update.getLikelihoodExpression().gatherVariables(result);
+                        for (auto const& assignment : update.getAssignments()) {
+                            assignment.getExpression().gatherVariables(result);
+                        }
+                    }
+                }
+                return result;
+            };
+            
+            // The labels and terminal states need to be invariant under permutations of symmetric modules.
+            std::vector<storm::expressions::Expression> observedExpressions;
+            if (this->options.isBuildAllLabelsSet()) {
+                for (auto const& label : program.getLabels()) {
+                    observedExpressions.push_back(label.getStatePredicateExpression());
+                }
+            } else {
+                for (auto const& labelName : this->options.getLabelNames()) {
+                    if (program.hasLabel(labelName)) {
+                        observedExpressions.push_back(program.getLabelExpression(labelName));
+                    }
+                }
+            }
+            for (auto const& expressionLabel : this->options.getExpressionLabels()) {
+                observedExpressions.push_back(expressionLabel.second);
+            }
+            for (auto const& expressionBool : this->terminalStates) {
+                observedExpressions.push_back(expressionBool.first);
+            }
+            
+            // The rewards must not refer to symmetric modules at all.
+            std::set<storm::expressions::Variable> rewardVariables;
+            std::set<uint_fast64_t> rewardActionIndices;
+            for (auto const& rewardModel : rewardModels) {
+                for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                    stateReward.getStatePredicateExpression().gatherVariables(rewardVariables);
+                    stateReward.getRewardValueExpression().gatherVariables(rewardVariables);
+                }
+                for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                    stateActionReward.getStatePredicateExpression().gatherVariables(rewardVariables);
+                    stateActionReward.getRewardValueExpression().gatherVariables(rewardVariables);
+                    rewardActionIndices.insert(stateActionReward.getActionIndex());
+                }
+                for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                    transitionReward.getSourceStatePredicateExpression().gatherVariables(rewardVariables);
+                    transitionReward.getTargetStatePredicateExpression().gatherVariables(rewardVariables);
+                    transitionReward.getRewardValueExpression().gatherVariables(rewardVariables);
+                    rewardActionIndices.insert(transitionReward.getActionIndex());
+                }
+            }
+            
+            // The solver used to check the invariance of expressions (created upon first use).
+            std::unique_ptr<storm::solver::SmtSolver> solver;
+            
+            // Checks whether the given modules (the first of which is the base module of the others) are fully
+            // symmetric. If not, the reason is returned.
+            auto checkSymmetry = [&] (std::vector<uint64_t> const& moduleIndices) -> std::string {
+                storm::prism::Module const& baseModule = program.getModule(moduleIndices.front());
+                std::vector<std::vector<storm::expressions::Variable>> localVariables;
+                std::set<storm::expressions::Variable> symmetricVariables;
+                for (auto const& moduleIndex : moduleIndices) {
+                    localVariables.push_back(getLocalVariables(program.getModule(moduleIndex)));
+                    symmetricVariables.insert(localVariables.back().begin(), localVariables.back().end());
+                }
+                if (!baseModule.getClockVariables().empty()) {
+                    return "module '" + baseModule.getName() + "' has clock variables";
+                }
+                
+                std::set<uint_fast64_t> renamedActionIndices;
+                for (uint64_t position = 1; position < moduleIndices.size(); ++position) {
+                    storm::prism::Module const& module = program.getModule(moduleIndices[position]);
+                    
+                    // The variables are stored relative to their lower bound, so the bounds need to coincide.
+                    for (uint64_t variableIndex = 0; variableIndex < module.getNumberOfIntegerVariables(); ++variableIndex) {
+                        storm::prism::IntegerVariable const& baseVariable = baseModule.getIntegerVariables()[variableIndex];
+                        storm::prism::IntegerVariable const& variable = module.getIntegerVariables()[variableIndex];
+                        if (baseVariable.getLowerBoundExpression().evaluateAsInt() != variable.getLowerBoundExpression().evaluateAsInt() || baseVariable.getUpperBoundExpression().evaluateAsInt() != variable.getUpperBoundExpression().evaluateAsInt()) {
+                            return "the bounds of the variables '" + baseVariable.getName() + "' and '" + variable.getName() + "' differ";
+                        }
+                    }
+                    
+                    // Besides its own variables, the renaming may only rename actions that are private to the module
+                    // or (if there are two modules) swap the variables of the two modules.
+                    for (auto const& namePair : module.getRenaming()) {
+                        if (namePair.first == namePair.second) {
+                            continue;
+                        }
+                        bool validRenaming = false;
+                        for (uint64_t variableIndex = 0; variableIndex < localVariables.front().size(); ++variableIndex) {
+                            validRenaming |= namePair.first == localVariables.front()[variableIndex].getName();
+                            validRenaming |= moduleIndices.size() == 2 && namePair.first == localVariables[position][variableIndex].getName() && namePair.second == localVariables.front()[variableIndex].getName();
+                        }
+                        if (!validRenaming && program.hasAction(namePair.first) && program.hasAction(namePair.second)) {
+                            uint_fast64_t baseActionIndex = program.getActionIndex(namePair.first);
+                            uint_fast64_t actionIndex = program.getActionIndex(namePair.second);
+                            validRenaming = program.getModuleIndicesByActionIndex(baseActionIndex) == std::set<uint_fast64_t>({moduleIndices.front()}) && program.getModuleIndicesByActionIndex(actionIndex) == std::set<uint_fast64_t>({moduleIndices[position]});
+                            renamedActionIndices.insert(baseActionIndex);
+                            renamedActionIndices.insert(actionIndex);
+                        }
+                        if (!validRenaming) {
+                            return "module '" + module.getName() + "' renames '" + namePair.first + "' to '" + namePair.second + "'";
+                        }
+                    }
+                }
+                
+                // If the base module refers to the variables of another symmetric module, the renaming has to swap them.
+                for (auto const& variable : getReadVariables(baseModule)) {
+                    auto moduleIt = variableToModuleIndex.find(variable);
+                    if (moduleIt == variableToModuleIndex.end() || moduleIt->second == moduleIndices.front() || symmetricVariables.count(variable) == 0) {
+                        continue;
+                    }
+                    if (moduleIndices.size() != 2 || program.getModule(moduleIndices.back()).getRenaming().count(variable.getName()) == 0) {
+                        return "module '" + baseModule.getName() + "' refers to variable '" + variable.getName() + "' of a symmetric module";
+                    }
+                }
+                
+                // The other modules must not refer to the symmetric modules.
+                for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    if (std::find(moduleIndices.begin(), moduleIndices.end(), moduleIndex) != moduleIndices.end()) {
+                        continue;
+                    }
+                    for (auto const& variable : getReadVariables(program.getModule(moduleIndex))) {
+                        if (symmetricVariables.count(variable) > 0) {
+                            return "module '" + program.getModule(moduleIndex).getName() + "' refers to variable '" + variable.getName() + "'";
+                        }
+                    }
+                }
+                
+                for (auto const& variable : rewardVariables) {
+                    if (symmetricVariables.count(variable) > 0) {
+                        return "the rewards refer to variable '" + variable.getName() + "'";
+                    }
+                }
+                for (auto const& actionIndex : renamedActionIndices) {
+                    if (rewardActionIndices.count(actionIndex) > 0) {
+                        return "the rewards refer to action '" + program.getActionName(actionIndex) + "'";
+                    }
+                }
+                
+                // Each observed expression needs to be invariant under swapping neighboring modules (which generate all
+                // permutations). We check this with an SMT solver.
+                for (auto const& expression : observedExpressions) {
+                    std::set<storm::expressions::Variable> expressionVariables = expression.getVariables();
+                    if (std::none_of(expressionVariables.begin(), expressionVariables.end(), [&symmetricVariables] (storm::expressions::Variable const& variable) { return symmetricVariables.count(variable) > 0; })) {
+                        continue;
+                    }
+                    if (!solver) {
+                        storm::utility::solver::SmtSolverFactory factory;
+                        solver = factory.create(program.getManager());
+                        for (auto const& rangeExpression : program.getAllRangeExpressions()) {
+                            solver->add(rangeExpression);
+                        }
+                    }
+                    for (uint64_t position = 0; position + 1 < moduleIndices.size(); ++position) {
+                        std::map<storm::expressions::Variable, storm::expressions::Expression> swapping;
+                        for (uint64_t variableIndex = 0; variableIndex < localVariables[position].size(); ++variableIndex) {
+                            swapping[localVariables[position][variableIndex]] = localVariables[position + 1][variableIndex].getExpression();
+                            swapping[localVariables[position + 1][variableIndex]] = localVariables[position][variableIndex].getExpression();
+                        }
+                        solver->push();
+                        solver->add(storm::expressions::xclusiveor(expression, expression.substitute(swapping)));
+                        storm::solver::SmtSolver::CheckResult result = solver->check();
+                        solver->pop();
+                        if (result != storm::solver::SmtSolver::CheckResult::Unsat) {
+                            return "the expression '" + expression.toString() + "' is not invariant under permutations of the modules";
+                        }
+                    }
+                }
+                
+                return "";
+            };
+            
+            for (uint64_t baseIndex = 0; baseIndex < program.getNumberOfModules(); ++baseIndex) {
+                storm::prism::Module const& baseModule = program.getModule(baseIndex);
+                if (baseModule.isRenamedFromModule()) {
+                    continue;
+                }
+                std::vector<uint64_t> moduleIndices = {baseIndex};
+                for (uint64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                    storm::prism::Module const& module = program.getModule(moduleIndex);
+                    if (module.isRenamedFromModule() && module.getBaseModule() == baseModule.getName()) {
+                        moduleIndices.push_back(moduleIndex);
+                    }
+                }
+                if (moduleIndices.size() < 2) {
+                    continue;
+                }
+                
+                std::string reason = checkSymmetry(moduleIndices);
+                if (!reason.empty()) {
+                    STORM_LOG_WARN("The modules obtained from module '" << baseModule.getName() << "' are not treated as symmetric, because " << reason << ".");
+                    continue;
+                }
+                
+                SymmetricModules symmetricModuleSet;
+                for (auto const& moduleIndex : moduleIndices) {
+                    symmetricModuleSet.segmentOffsets.push_back(this->variableInformation.moduleBitOffsets[moduleIndex]);
+                }
+                uint64_t segmentEnd = baseIndex + 1 < this->variableInformation.moduleBitOffsets.size() ? this->variableInformation.moduleBitOffsets[baseIndex + 1] : this->variableInformation.getTotalBitOffset();
+                symmetricModuleSet.segmentLength = segmentEnd - symmetricModuleSet.segmentOffsets.front();
+                if (symmetricModuleSet.segmentLength > 0) {
+                    STORM_LOG_INFO("Treating the " << moduleIndices.size() << " modules obtained from module '" << baseModule.getName() << "' as symmetric.");
+                    symmetricModules.push_back(std::move(symmetricModuleSet));
+                }
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::orderBySymmetry(CompressedState& state) const {
+            for (auto const& symmetricModuleSet : symmetricModules) {
+                // Sort the segments in decreasing order by bubble sort (there are typically only few of them).
+                std::vector<uint64_t> const& offsets = symmetricModuleSet.segmentOffsets;
+                uint64_t unsortedEnd = offsets.size();
+                do {
+                    uint64_t lastSwap = 0;
+                    for (uint64_t position = 1; position < unsortedEnd; ++position) {
+                        if (state.compareAndSwap(offsets[position - 1], offsets[position], symmetricModuleSet.segmentLength)) {
+                            lastSwap = position;
+                        }
+                    }
+                    unsortedEnd = lastSwap;
+                } while (unsortedEnd > 0);
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+            if (useCompiledExpressions) {
+                return compiledGuards[command.getGlobalIndex()].evaluateAsBool(*this->state);
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::getLikelihood(storm::prism::Update const& update) const {
+            if (useCompiledExpressions) {
+                return storm::utility::convertNumber<ValueType>(compiledUpdates[update.getGlobalIndex()].likelihood.evaluateAsDouble(*this->state));
+            }
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+        
         template<typename ValueType, typename StateType>
         CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
             CompressedState newState(state);
             
+            // The assignments are evaluated in the state currently loaded (which may differ from the given state when
+            // synchronizing commands). Compiled assignments already know the variables they write to.
+            if (useCompiledExpressions) {
+                for (auto const& assignment : compiledUpdates[update.getGlobalIndex()].assignments) {
+                    if (assignment.booleanVariable) {
+                        newState.set(this->variableInformation.booleanVariables[assignment.variableIndex].bitOffset, assignment.expression.evaluateAsBool(*this->state));
+                        continue;
+                    }
+                    auto const& integerVariable = this->variableInformation.integerVariables[assignment.variableIndex];
+                    int_fast64_t assignedValue = assignment.expression.evaluateAsInt(*this->state);
+                    if (this->options.isAddOutOfBoundsStateSet()) {
+                        if (assignedValue < integerVariable.lowerBound || assignedValue > integerVariable.upperBound) {
+                            return this->outOfBoundsState;
+                        }
+                    } else if (integerVariable.forceOutOfBoundsCheck || this->options.isExplorationChecksSet()) {
+                        STORM_LOG_THROW(assignedValue >= integerVariable.lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << integerVariable.variable.getName() << "'.");
+                        STORM_LOG_THROW(assignedValue <= integerVariable.upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << integerVariable.variable.getName() << "'.");
+                    }
+                    newState.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, assignedValue - integerVariable.lowerBound);
+                }
+                return newState;
+            }
+            
             // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
             // assignments to boolean variables precede the assignments to all integer variables and that within the
             // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -445,16 +1083,17 @@ namespace storm {
                 
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
                 
-                // Look up commands by their indices and add them if the guard evaluates to true in the given state.
-                for (uint_fast64_t commandIndex : commandIndices) {
-                    storm::prism::Command const& command = module.getCommand(commandIndex);
+                // Look up the commands whose guard may hold and add them if the guard evaluates to true in the given state.
+                IndexedCommands const& indexedCommands = labeledCommands[i].at(actionIndex);
+                for (uint64_t position : indexedCommands.guardIndex.getCandidates(*this->state)) {
+                    storm::prism::Command const& command = module.getCommand(indexedCommands.commandIndices[position]);
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
                         if ((commandFilter == CommandFilter::Markovian) != command.isMarkovian()) {
                             continue;
                         }
                     }
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isEnabled(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -480,12 +1119,10 @@ namespace storm {
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
                 
-                // Iterate over all commands.
-                for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
-                    storm::prism::Command const& command = module.getCommand(j);
-                    
-                    // Only consider unlabeled commands.
-                    if (command.isLabeled()) continue;
+                // Iterate over the unlabeled commands whose guard may hold.
+                IndexedCommands const& indexedCommands = unlabeledCommands[i];
+                for (uint64_t position : indexedCommands.guardIndex.getCandidates(state)) {
+                    storm::prism::Command const& command = module.getCommand(indexedCommands.commandIndices[position]);
                     
                     if (commandFilter != CommandFilter::All) {
                         STORM_LOG_ASSERT(commandFilter == CommandFilter::Markovian || commandFilter == CommandFilter::Probabilistic, "Unexpected command filter.");
@@ -495,59 +1132,65 @@ namespace storm {
                     }
 
                     // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    if (!isEnabled(command)) {
                         continue;
                     }
                     
-                    result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-                    Choice<ValueType>& choice = result.back();
-                    
-                    // Remember the choice origin only if we were asked to.
-                    if (this->options.isBuildChoiceOriginsSet()) {
-                        CommandSet commandIndex { command.getGlobalIndex() };
-                        choice.addOriginData(boost::any(std::move(commandIndex)));
-                    }
+                    result.push_back(getUnlabeledChoice(state, command, stateToIdCallback));
+                }
+            }
+            
+            return result;
+        }
+        
+        template<typename ValueType, typename StateType>
+        Choice<ValueType> PrismNextStateGenerator<ValueType, StateType>::getUnlabeledChoice(CompressedState const& state, storm::prism::Command const& command, StateToIdCallback stateToIdCallback) {
+            Choice<ValueType> choice(command.getActionIndex(), command.isMarkovian());
+            
+            // Remember the choice origin only if we were asked to.
+            if (this->options.isBuildChoiceOriginsSet()) {
+                CommandSet commandIndex { command.getGlobalIndex() };
+                choice.addOriginData(boost::any(std::move(commandIndex)));
+            }
+            
+            // Iterate over all updates of the current command.
+            ValueType probabilitySum = storm::utility::zero<ValueType>();
+            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+                storm::prism::Update const& update = command.getUpdate(k);
+
+                ValueType probability = getLikelihood(update);
+                if (probability != storm::utility::zero<ValueType>()) {
+                    // Obtain target state index and add it to the list of known states. If it has not yet been
+                    // seen, we also add it to the set of states that have yet to be explored.
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
                     
-                    // Iterate over all updates of the current command.
-                    ValueType probabilitySum = storm::utility::zero<ValueType>();
-                    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                        storm::prism::Update const& update = command.getUpdate(k);
-
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                        if (probability != storm::utility::zero<ValueType>()) {
-                            // Obtain target state index and add it to the list of known states. If it has not yet been
-                            // seen, we also add it to the set of states that have yet to be explored.
-                            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
-                            
-                            // Update the choice by adding the probability/target state to it.
-                            choice.addProbability(stateIndex, probability);
-                            if (this->options.isExplorationChecksSet()) {
-                                probabilitySum += probability;
-                            }
-                        }
+                    // Update the choice by adding the probability/target state to it.
+                    choice.addProbability(stateIndex, probability);
+                    if (this->options.isExplorationChecksSet()) {
+                        probabilitySum += probability;
                     }
-                    
-                    // Create the state-action reward for the newly created choice.
-                    for (auto const& rewardModel : rewardModels) {
-                        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                        if (rewardModel.get().hasStateActionRewards()) {
-                            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                                }
-                            }
+                }
+            }
+            
+            // Create the state-action reward for the newly created choice.
+            for (auto const& rewardModel : rewardModels) {
+                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+                if (rewardModel.get().hasStateActionRewards()) {
+                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                        if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                         }
-                        choice.addReward(stateActionRewardValue);
-                    }
-                    
-                    if (this->options.isExplorationChecksSet()) {
-                        // Check that the resulting distribution is in fact a distribution.
-                        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
                     }
                 }
+                choice.addReward(stateActionRewardValue);
             }
             
-            return result;
+            if (this->options.isExplorationChecksSet()) {
+                // Check that the resulting distribution is in fact a distribution.
+                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+            }
+            
+            return choice;
         }
 
         template<typename ValueType, typename StateType>
@@ -564,7 +1207,7 @@ namespace storm {
                 storm::prism::Command const& command = *iteratorList[position];
                 for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                     storm::prism::Update const& update = command.getUpdate(j);
-                    generateSynchronizedDistribution(applyUpdate(state, update), probability * this->evaluator->asRational(update.getLikelihoodExpression()), position + 1, iteratorList, distribution, stateToIdCallback);
+                    generateSynchronizedDistribution(applyUpdate(state, update), probability * getLikelihood(update), position + 1, iteratorList, distribution, stateToIdCallback);
                 }
             }
         }
@@ -664,6 +1307,11 @@ namespace storm {
         
         template<typename ValueType, typename StateType>
         storm::models::sparse::StateLabeling PrismNextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices) {
+            return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, getLabelExpressions());
+        }
+        
+        template<typename ValueType, typename StateType>
+        std::vector<std::pair<std::string, storm::expressions::Expression>> PrismNextStateGenerator<ValueType, StateType>::getLabelExpressions() const {
             // Gather a vector of labels and their expressions.
             std::vector<std::pair<std::string, storm::expressions::Expression>> labels;
             if (this->options.isBuildAllLabelsSet()) {
@@ -680,7 +1328,9 @@ namespace storm {
                 }
             }
             
-            return NextStateGenerator<ValueType, StateType>::label(stateStorage, initialStateIndices, deadlockStateIndices, labels);
+            std::vector<std::pair<std::string, storm::expressions::Expression>> expressionLabels = NextStateGenerator<ValueType, StateType>::getLabelExpressions();
+            labels.insert(labels.end(), expressionLabels.begin(), expressionLabels.end());
+            return labels;
         }
         
         template<typename ValueType, typename StateType>
@@ -727,6 +1377,12 @@ namespace storm {
             return std::make_shared<storm::storage::sparse::PrismChoiceOrigins>(std::make_shared<storm::prism::Program>(program), std::move(identifiers), std::move(identifierToCommandSetMapping));
         }
 
+        template<typename ValueType, typename StateType>
+        std::shared_ptr<NextStateGenerator<ValueType, StateType>> PrismNextStateGenerator<ValueType, StateType>::clone() const {
+            // The program was already preprocessed, so we can directly use the delegate constructor.
+            return std::shared_ptr<NextStateGenerator<ValueType, StateType>>(new PrismNextStateGenerator<ValueType, StateType>(program, this->options, false));
+        }
+
                 
         template class PrismNextStateGenerator<double>;
 
@@ -2,6 +2,8 @@
 #define STORM_GENERATOR_PRISMNEXTSTATEGENERATOR_H_
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/GuardIndex.h"
 
 #include "storm/storage/prism/Program.h"
 #include "storm/storage/BoostTypes.h"
@@ -37,9 +39,12 @@ namespace storm {
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const override;
             
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) override;
+            virtual std::vector<std::pair<std::string, storm::expressions::Expression>> getLabelExpressions() const override;
 
             virtual std::shared_ptr<storm::storage::sparse::ChoiceOrigins> generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const override;
 
+            virtual std::shared_ptr<NextStateGenerator<ValueType, StateType>> clone() const override;
+
         private:
             void checkValid() const;
 
@@ -50,6 +55,16 @@ namespace storm {
              */
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool flag);
             
+            /*!
+             * Retrieves the initial states, where the given callback is invoked for each of them.
+             */
+            std::vector<StateType> enumerateInitialStates(StateToIdCallback const& stateToIdCallback);
+            
+            /*!
+             * Expands the state currently loaded, where the given callback is invoked for each successor.
+             */
+            StateBehavior<ValueType, StateType> expandState(StateToIdCallback const& stateToIdCallback);
+            
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
@@ -59,6 +74,47 @@ namespace storm {
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
             
+            /*!
+             * Compiles the guards, probabilities and assignments of the program, so they can be evaluated directly on
+             * the compressed states. If this is not possible, the evaluator is used instead.
+             */
+            void compileExpressions();
+            
+            /*!
+             * Builds the guard indices for the commands of all modules.
+             */
+            void createGuardIndices();
+            
+            /*!
+             * Determines the unlabeled commands that may be used as (singleton) ample sets for partial-order reduction.
+             * Only commands with a single update are selected, as the reduction does not preserve minimal and maximal
+             * probabilities otherwise. If the program is no MDP or the reduction would not preserve the built rewards,
+             * no command is selected.
+             */
+            void computeAmpleCandidates();
+            
+            /*!
+             * Determines the sets of modules that are created from the same module via renaming and whose permutations
+             * neither change the behavior of the program nor the built labels and rewards.
+             */
+            void detectSymmetricModules();
+            
+            /*!
+             * Sorts the segments of symmetric modules in the given state. This yields the same (canonical) state for all
+             * states that only differ in a permutation of symmetric modules.
+             */
+            void orderBySymmetry(CompressedState& state) const;
+            
+            /*!
+             * Retrieves whether the guard of the given command is satisfied in the state currently loaded.
+             */
+            bool isEnabled(storm::prism::Command const& command) const;
+            
+            /*!
+             * Evaluates the likelihood of the given update in the state currently loaded.
+             */
+            ValueType getLikelihood(storm::prism::Update const& update) const;
+            
             /*!
              * Retrieves all commands that are labeled with the given label and enabled in the given state, grouped by
              * modules.
@@ -85,6 +141,24 @@ namespace storm {
              */
             std::vector<Choice<ValueType>> getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback, CommandFilter const& commandFilter = CommandFilter::All);
             
+            /*!
+             * Creates the choice of the given unlabeled command, which needs to be enabled in the given state.
+             *
+             * @param state The state for which to create the choice.
+             * @param command The command whose updates are applied.
+             * @return The choice of the command.
+             */
+            Choice<ValueType> getUnlabeledChoice(CompressedState const& state, storm::prism::Command const& command, StateToIdCallback stateToIdCallback);
+            
+            /*!
+             * Retrieves the choice of an ample set of the given state (if partial-order reduction is applied). If no
+             * ample set other than the set of all enabled choices is found, the result is empty.
+             *
+             * @param state The state for which to retrieve the ample choice.
+             * @return The ample choice of the state (if any).
+             */
+            std::vector<Choice<ValueType>> getAmpleChoices(CompressedState const& state, StateToIdCallback stateToIdCallback);
+            
             /*!
              * Retrieves all labeled choices possible from the given state.
              *
@@ -106,6 +180,77 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // An assignment that was compiled along with the variable it assigns.
+            struct CompiledAssignment {
+                // The compiled expression of the assignment.
+                CompiledStateExpression expression;
+                
+                // Whether a boolean or an integer variable is assigned.
+                bool booleanVariable;
+                
+                // The index of the variable in the boolean or integer variables of the variable information.
+                uint64_t variableIndex;
+            };
+            
+            // An update whose likelihood and assignments were compiled.
+            struct CompiledUpdate {
+                CompiledStateExpression likelihood;
+                std::vector<CompiledAssignment> assignments;
+            };
+            
+            // A flag that stores whether guards, probabilities and assignments are evaluated via compiled expressions.
+            bool useCompiledExpressions;
+            
+            // The compiled guards, indexed by the global indices of the commands.
+            std::vector<CompiledStateExpression> compiledGuards;
+            
+            // The compiled updates, indexed by the global indices of the updates.
+            std::vector<CompiledUpdate> compiledUpdates;
+            
+            // A set of commands of a module along with an index over their guards.
+            struct IndexedCommands {
+                // The indices of the commands within their module (in ascending order).
+                std::vector<uint64_t> commandIndices;
+                
+                // The index over the guards of the commands. The candidates refer to positions in commandIndices.
+                GuardIndex guardIndex;
+            };
+            
+            // For each module, the unlabeled commands.
+            std::vector<IndexedCommands> unlabeledCommands;
+            
+            // For each module, a mapping from action indices to the commands labeled with the action.
+            std::vector<std::unordered_map<uint64_t, IndexedCommands>> labeledCommands;
+            
+            // An unlabeled command that is an ample set on its own in each state in which it is enabled, but none of the
+            // actions that depend on it.
+            struct AmpleCandidate {
+                // The module and the index of the command within the module.
+                uint64_t moduleIndex;
+                uint64_t commandIndex;
+                
+                // The unlabeled commands (given as pairs of module and command index) that depend on the command.
+                std::vector<std::pair<uint64_t, uint64_t>> dependentUnlabeledCommands;
+                
+                // The synchronizing actions that depend on the command.
+                std::vector<uint64_t> dependentActionIndices;
+            };
+            
+            // The commands that may form an ample set. This is empty if partial-order reduction is not applied.
+            std::vector<AmpleCandidate> ampleCandidates;
+            
+            // A set of fully symmetric modules.
+            struct SymmetricModules {
+                // The offsets of the segments of the modules in the states.
+                std::vector<uint64_t> segmentOffsets;
+                
+                // The number of bits of each segment.
+                uint64_t segmentLength;
+            };
+            
+            // The sets of symmetric modules. This is empty if symmetry reduction is not applied.
+            std::vector<SymmetricModules> symmetricModules;
         };
         
     }
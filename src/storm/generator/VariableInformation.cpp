@@ -51,6 +51,7 @@ namespace storm {
                 totalBitOffset += bitwidth;
             }
             for (auto const& module : program.getModules()) {
+                moduleBitOffsets.push_back(totalBitOffset);
                 for (auto const& booleanVariable : module.getBooleanVariables()) {
                     booleanVariables.emplace_back(booleanVariable.getExpressionVariable(), totalBitOffset, false, booleanVariable.isObservable());
                     ++totalBitOffset;
@@ -158,6 +159,7 @@ namespace storm {
         }
         
         void VariableInformation::createVariablesForAutomaton(storm::jani::Automaton const& automaton, uint64_t reservedBitsForUnboundedVariables) {
+            moduleBitOffsets.push_back(totalBitOffset);
             uint_fast64_t bitwidth = static_cast<uint_fast64_t>(std::ceil(std::log2(automaton.getNumberOfLocations())));
             locationVariables.emplace_back(automaton.getLocationExpressionVariable(), automaton.getNumberOfLocations() - 1, totalBitOffset, bitwidth, true);
             totalBitOffset += bitwidth;
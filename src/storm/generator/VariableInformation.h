@@ -110,6 +110,9 @@ namespace storm {
             /// The integer variables.
             std::vector<IntegerVariableInformation> integerVariables;
             
+            /// The bit offsets at which the variables of the individual modules (automata) start.
+            std::vector<uint_fast64_t> moduleBitOffsets;
+
             /// Replacements for each array variable
             std::unordered_map<storm::expressions::Variable, std::vector<uint64_t>> arrayVariableToElementInformations;
 
@@ -0,0 +1,170 @@
+#include "storm/modelchecker/exploration/LazyModel.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+
+            namespace detail {
+                // The maximal usage of a slot of the row cache, i.e. the number of passes of the clock hand that a
+                // frequently requested state survives.
+                static const uint8_t maximalCacheSlotUsage = 3;
+            }
+
+            template <typename StateType, typename ValueType>
+            const StateType LazyModel<StateType, ValueType>::notCached;
+
+            template <typename StateType, typename ValueType>
+            std::size_t LazyModel<StateType, ValueType>::Rows::getNumberOfRows() const {
+                return rowIndications.size() - 1;
+            }
+
+            template <typename StateType, typename ValueType>
+            typename std::vector<typename LazyModel<StateType, ValueType>::EntryType>::const_iterator LazyModel<StateType, ValueType>::Rows::begin(std::size_t row) const {
+                return entries.begin() + rowIndications[row];
+            }
+
+            template <typename StateType, typename ValueType>
+            typename std::vector<typename LazyModel<StateType, ValueType>::EntryType>::const_iterator LazyModel<StateType, ValueType>::Rows::end(std::size_t row) const {
+                return entries.begin() + rowIndications[row + 1];
+            }
+
+            template <typename StateType, typename ValueType>
+            LazyModel<StateType, ValueType>::LazyModel(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression, uint_fast64_t rowCacheSize) : generator(generator), conditionStateExpression(conditionStateExpression), targetStateExpression(targetStateExpression), stateStorage(generator->getStateSize()), rowCacheSize(std::max(rowCacheSize, static_cast<uint_fast64_t>(1))), clockHand(0), numberOfRequests(0), numberOfExpansions(0), numberOfEvictions(0) {
+                std::function<StateType (storm::generator::CompressedState const&)> stateToIdCallback = [this] (storm::generator::CompressedState const& state) { return this->getOrAddStateIndex(state); };
+                stateStorage.initialStateIndices = this->generator->getInitialStates(stateToIdCallback);
+
+                // Now that the generator is done, we can classify the discovered states.
+                for (StateType state = 0; state < states.size(); ++state) {
+                    classifyState(state);
+                }
+            }
+
+            template <typename StateType, typename ValueType>
+            std::vector<StateType> const& LazyModel<StateType, ValueType>::getInitialStates() const {
+                return stateStorage.initialStateIndices;
+            }
+
+            template <typename StateType, typename ValueType>
+            std::size_t LazyModel<StateType, ValueType>::getNumberOfDiscoveredStates() const {
+                return states.size();
+            }
+
+            template <typename StateType, typename ValueType>
+            bool LazyModel<StateType, ValueType>::isTargetState(StateType const& state) const {
+                STORM_LOG_ASSERT(stateKinds[state] != StateKind::Unclassified, "State " << state << " was not classified.");
+                return stateKinds[state] == StateKind::Target;
+            }
+
+            template <typename StateType, typename ValueType>
+            bool LazyModel<StateType, ValueType>::isTerminalState(StateType const& state) const {
+                STORM_LOG_ASSERT(stateKinds[state] != StateKind::Unclassified, "State " << state << " was not classified.");
+                return stateKinds[state] != StateKind::Regular;
+            }
+
+            template <typename StateType, typename ValueType>
+            typename LazyModel<StateType, ValueType>::Rows const& LazyModel<StateType, ValueType>::getRows(StateType const& state) {
+                STORM_LOG_ASSERT(!isTerminalState(state), "Requesting the rows of terminal state " << state << ".");
+                ++numberOfRequests;
+
+                StateType slotIndex = stateToCacheSlot[state];
+                if (slotIndex != notCached) {
+                    CacheSlot& slot = cache[slotIndex];
+                    slot.usage = std::min(static_cast<uint8_t>(slot.usage + 1), detail::maximalCacheSlotUsage);
+                    return slot.rows;
+                }
+
+                slotIndex = getFreeCacheSlot();
+                ++numberOfExpansions;
+
+                // The generator keeps a pointer to the loaded state, but discovering successors may reallocate the
+                // storage of the states, so we load a copy.
+                storm::generator::CompressedState currentState = states[state];
+                std::size_t numberOfKnownStates = states.size();
+                generator->load(currentState);
+                std::function<StateType (storm::generator::CompressedState const&)> stateToIdCallback = [this] (storm::generator::CompressedState const& state) { return this->getOrAddStateIndex(state); };
+                storm::generator::StateBehavior<ValueType, StateType> behavior = generator->expand(stateToIdCallback);
+
+                // Store the rows in the cache slot.
+                CacheSlot& slot = cache[slotIndex];
+                slot.state = state;
+                slot.usage = 1;
+                slot.rows.entries.clear();
+                slot.rows.rowIndications.clear();
+                slot.rows.rowIndications.push_back(0);
+                for (auto const& choice : behavior) {
+                    for (auto const& stateProbabilityPair : choice) {
+                        slot.rows.entries.emplace_back(stateProbabilityPair.first, stateProbabilityPair.second);
+                    }
+                    slot.rows.rowIndications.push_back(slot.rows.entries.size());
+                }
+                stateToCacheSlot[state] = slotIndex;
+
+                // Finally, classify the newly discovered states.
+                for (StateType newState = numberOfKnownStates; newState < states.size(); ++newState) {
+                    classifyState(newState);
+                }
+
+                return slot.rows;
+            }
+
+            template <typename StateType, typename ValueType>
+            void LazyModel<StateType, ValueType>::printStatisticsToStream(std::ostream& out) const {
+                out << std::endl << "Lazy exploration statistics:" << std::endl;
+                out << "Discovered states: " << states.size() << std::endl;
+                out << "Requests of rows: " << numberOfRequests << std::endl;
+                out << "Expansions of states: " << numberOfExpansions << " (" << numberOfEvictions << " evictions from the row cache of size " << rowCacheSize << ")" << std::endl;
+            }
+
+            template <typename StateType, typename ValueType>
+            StateType LazyModel<StateType, ValueType>::getOrAddStateIndex(storm::generator::CompressedState const& state) {
+                StateType newIndex = static_cast<StateType>(states.size());
+                StateType actualIndex = stateStorage.stateToId.findOrAdd(state, newIndex);
+                if (actualIndex == newIndex) {
+                    states.push_back(state);
+                    stateKinds.push_back(StateKind::Unclassified);
+                    stateToCacheSlot.push_back(notCached);
+                }
+                return actualIndex;
+            }
+
+            template <typename StateType, typename ValueType>
+            void LazyModel<StateType, ValueType>::classifyState(StateType const& state) {
+                generator->load(states[state]);
+                if (generator->satisfies(targetStateExpression)) {
+                    stateKinds[state] = StateKind::Target;
+                } else if (!generator->satisfies(conditionStateExpression)) {
+                    stateKinds[state] = StateKind::ConditionViolated;
+                } else {
+                    stateKinds[state] = StateKind::Regular;
+                }
+            }
+
+            template <typename StateType, typename ValueType>
+            std::size_t LazyModel<StateType, ValueType>::getFreeCacheSlot() {
+                if (cache.size() < rowCacheSize) {
+                    cache.emplace_back();
+                    return cache.size() - 1;
+                }
+
+                // Advance the clock hand until we find a slot that was not requested since the last pass.
+                while (true) {
+                    CacheSlot& slot = cache[clockHand];
+                    std::size_t slotIndex = clockHand;
+                    clockHand = (clockHand + 1) % cache.size();
+                    if (slot.usage == 0) {
+                        stateToCacheSlot[slot.state] = notCached;
+                        ++numberOfEvictions;
+                        return slotIndex;
+                    }
+                    --slot.usage;
+                }
+            }
+
+            template class LazyModel<uint32_t, double>;
+        }
+    }
+}
@@ -0,0 +1,152 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_LAZYMODEL_H_
+#define STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_LAZYMODEL_H_
+
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/NextStateGenerator.h"
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/StateStorage.h"
+
+#include "storm/storage/expressions/Expression.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace exploration_detail {
+
+            /*!
+             * A model whose transitions are generated on demand by a next-state generator. States are discovered when
+             * they appear as successors of expanded states. The rows (choices) of a state are only generated when they
+             * are requested and are then kept in a cache of bounded size. If the cache is full, the rows of a rarely
+             * requested state are evicted (and generated again if they are requested later on).
+             *
+             * States that satisfy the target expression or violate the condition expression are terminal, i.e. they are
+             * never expanded.
+             */
+            template <typename StateType, typename ValueType>
+            class LazyModel {
+            public:
+                typedef storm::storage::MatrixEntry<StateType, ValueType> EntryType;
+
+                // The rows of a state.
+                struct Rows {
+                    // The entries of all rows.
+                    std::vector<EntryType> entries;
+
+                    // The index of the first entry of each row (plus the number of entries).
+                    std::vector<StateType> rowIndications;
+
+                    std::size_t getNumberOfRows() const;
+                    typename std::vector<EntryType>::const_iterator begin(std::size_t row) const;
+                    typename std::vector<EntryType>::const_iterator end(std::size_t row) const;
+                };
+
+                /*!
+                 * Creates a lazy model that generates its transitions with the given generator.
+                 *
+                 * @param generator The generator used to expand the states.
+                 * @param conditionStateExpression Only states satisfying this expression are expanded.
+                 * @param targetStateExpression States satisfying this expression are not expanded.
+                 * @param rowCacheSize The maximal number of states whose rows are kept in memory.
+                 */
+                LazyModel(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, storm::expressions::Expression const& conditionStateExpression, storm::expressions::Expression const& targetStateExpression, uint_fast64_t rowCacheSize);
+
+                /*!
+                 * Retrieves the initial states of the model.
+                 */
+                std::vector<StateType> const& getInitialStates() const;
+
+                /*!
+                 * Retrieves the number of states discovered so far.
+                 */
+                std::size_t getNumberOfDiscoveredStates() const;
+
+                /*!
+                 * Retrieves whether the given state satisfies the target expression.
+                 */
+                bool isTargetState(StateType const& state) const;
+
+                /*!
+                 * Retrieves whether the given state is terminal, i.e. it satisfies the target expression or violates the
+                 * condition expression.
+                 */
+                bool isTerminalState(StateType const& state) const;
+
+                /*!
+                 * Retrieves the rows of the given non-terminal state, generating them if they are not cached. Successors
+                 * that were not known before are discovered by this. The returned reference is only valid until the next
+                 * call to this method.
+                 */
+                Rows const& getRows(StateType const& state);
+
+                /*!
+                 * Prints statistics about the model to the given stream.
+                 */
+                void printStatisticsToStream(std::ostream& out) const;
+
+            private:
+                // The kinds of states.
+                enum class StateKind : uint8_t { Unclassified, Regular, Target, ConditionViolated };
+
+                // An entry of the row cache.
+                struct CacheSlot {
+                    StateType state;
+                    uint8_t usage;
+                    Rows rows;
+                };
+
+                /*!
+                 * Retrieves the index of the given state, adding it if it was not discovered before.
+                 */
+                StateType getOrAddStateIndex(storm::generator::CompressedState const& state);
+
+                /*!
+                 * Determines the kind of the given state. This loads the state into the generator.
+                 */
+                void classifyState(StateType const& state);
+
+                /*!
+                 * Determines a cache slot that can be used for a new state, evicting its previous state if necessary.
+                 */
+                std::size_t getFreeCacheSlot();
+
+                // The generator used to expand the states.
+                std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> generator;
+
+                storm::expressions::Expression conditionStateExpression;
+                storm::expressions::Expression targetStateExpression;
+
+                // The mapping of states to their indices as well as the states in the order of their indices.
+                storm::storage::sparse::StateStorage<StateType> stateStorage;
+                std::vector<storm::generator::CompressedState> states;
+                std::vector<StateKind> stateKinds;
+
+                // For each state, the slot of the cache that holds its rows (if any).
+                std::vector<StateType> stateToCacheSlot;
+
+                // The cache of rows. Slots are reused in a clock-like fashion: each request of a state increases the
+                // usage of its slot and each pass of the clock hand decreases it. A slot is reused once its usage drops
+                // to zero.
+                std::vector<CacheSlot> cache;
+                uint_fast64_t rowCacheSize;
+                std::size_t clockHand;
+
+                // Some statistics.
+                std::size_t numberOfRequests;
+                std::size_t numberOfExpansions;
+                std::size_t numberOfEvictions;
+
+                // A marker for states whose rows are not cached.
+                static const StateType notCached = std::numeric_limits<StateType>::max();
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_EXPLORATION_DETAIL_LAZYMODEL_H_ */
@@ -2,10 +2,12 @@
 
 #include "storm/modelchecker/exploration/ExplorationInformation.h"
 #include "storm/modelchecker/exploration/StateGeneration.h"
+#include "storm/modelchecker/exploration/LazyModel.h"
 #include "storm/modelchecker/exploration/Bounds.h"
 #include "storm/modelchecker/exploration/Statistics.h"
 
 #include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
@@ -55,12 +57,21 @@ namespace storm {
             storm::logic::Formula const& targetFormula = untilFormula.getRightSubformula();
             STORM_LOG_THROW(program.isDeterministicModel() || checkTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "For nondeterministic systems, an optimization direction (min/max) must be given in the property.");
             
-            ExplorationInformation<StateType, ValueType> explorationInformation(checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection() : storm::OptimizationDirection::Maximize);
+            storm::OptimizationDirection direction = checkTask.isOptimizationDirectionSet() ? checkTask.getOptimizationDirection() : storm::OptimizationDirection::Maximize;
+            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+            
+            auto const& explorationSettings = storm::settings::getModule<storm::settings::modules::ExplorationSettings>();
+            if (explorationSettings.getExplorationMethod() == storm::settings::modules::ExplorationSettings::ExplorationMethod::Lazy) {
+                LazyModel<StateType, ValueType> lazyModel(std::make_shared<storm::generator::PrismNextStateGenerator<ValueType, StateType>>(program), conditionFormula.toExpression(program.getManager(), labelToExpressionMapping), targetFormula.toExpression(program.getManager(), labelToExpressionMapping), explorationSettings.getRowCacheSize());
+                std::pair<StateType, ValueType> valueForInitialState = performLazyValueIteration(lazyModel, direction);
+                return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(valueForInitialState.first, valueForInitialState.second);
+            }
+            
+            ExplorationInformation<StateType, ValueType> explorationInformation(direction);
             
             // The first row group starts at action 0.
             explorationInformation.newRowGroup(0);
             
-            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
             StateGeneration<StateType, ValueType> stateGeneration(program, explorationInformation, conditionFormula.toExpression(program.getManager(), labelToExpressionMapping), targetFormula.toExpression(program.getManager(), labelToExpressionMapping));
             
             
@@ -122,6 +133,107 @@ namespace storm {
             return std::make_tuple(initialStateIndex, bounds.getLowerBoundForState(initialStateIndex, explorationInformation), bounds.getUpperBoundForState(initialStateIndex, explorationInformation));
         }
         
+        template<typename ModelType, typename StateType>
+        std::pair<StateType, typename ModelType::ValueType> SparseExplorationModelChecker<ModelType, StateType>::performLazyValueIteration(LazyModel<StateType, ValueType>& lazyModel, storm::OptimizationDirection const& direction) const {
+            STORM_LOG_THROW(lazyModel.getInitialStates().size() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
+            StateType initialStateIndex = lazyModel.getInitialStates().front();
+            if (lazyModel.isTerminalState(initialStateIndex)) {
+                return std::make_pair(initialStateIndex, lazyModel.isTargetState(initialStateIndex) ? storm::utility::one<ValueType>() : storm::utility::zero<ValueType>());
+            }
+            
+            // First, we discover the relevant states, i.e. the non-terminal states that are reachable via non-terminal
+            // states, breadth-first. Terminal states are never expanded, so only this part of the state space is built.
+            std::vector<StateType> relevantStates = {initialStateIndex};
+            storm::storage::BitVector discoveredStates(lazyModel.getNumberOfDiscoveredStates());
+            discoveredStates.set(initialStateIndex);
+            for (uint64_t position = 0; position < relevantStates.size(); ++position) {
+                auto const& rows = lazyModel.getRows(relevantStates[position]);
+                discoveredStates.grow(lazyModel.getNumberOfDiscoveredStates());
+                for (auto const& entry : rows.entries) {
+                    if (!discoveredStates.get(entry.getColumn())) {
+                        discoveredStates.set(entry.getColumn());
+                        if (!lazyModel.isTerminalState(entry.getColumn())) {
+                            relevantStates.push_back(entry.getColumn());
+                        }
+                    }
+                }
+            }
+            STORM_LOG_DEBUG("Discovered " << lazyModel.getNumberOfDiscoveredStates() << " states (" << relevantStates.size() << " relevant).");
+            
+            // Then, we determine the relevant states that can reach a target state. The others have probability zero.
+            // As states tend to be discovered after their predecessors, we sweep the relevant states backwards.
+            storm::storage::BitVector statesWithProbabilityGreater0(lazyModel.getNumberOfDiscoveredStates());
+            for (auto state : discoveredStates) {
+                if (lazyModel.isTargetState(state)) {
+                    statesWithProbabilityGreater0.set(state);
+                }
+            }
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (auto stateIt = relevantStates.rbegin(); stateIt != relevantStates.rend(); ++stateIt) {
+                    if (statesWithProbabilityGreater0.get(*stateIt)) {
+                        continue;
+                    }
+                    auto const& rows = lazyModel.getRows(*stateIt);
+                    for (auto const& entry : rows.entries) {
+                        if (statesWithProbabilityGreater0.get(entry.getColumn())) {
+                            statesWithProbabilityGreater0.set(*stateIt);
+                            changed = true;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (!statesWithProbabilityGreater0.get(initialStateIndex)) {
+                return std::make_pair(initialStateIndex, storm::utility::zero<ValueType>());
+            }
+            relevantStates.erase(std::remove_if(relevantStates.begin(), relevantStates.end(), [&statesWithProbabilityGreater0] (StateType const& state) { return !statesWithProbabilityGreater0.get(state); }), relevantStates.end());
+            
+            // Finally, we perform Gauss-Seidel value iteration from below on the remaining states, requesting the rows
+            // from the lazy model in every sweep.
+            std::vector<ValueType> values(lazyModel.getNumberOfDiscoveredStates(), storm::utility::zero<ValueType>());
+            for (auto state : discoveredStates) {
+                if (lazyModel.isTargetState(state)) {
+                    values[state] = storm::utility::one<ValueType>();
+                }
+            }
+            ValueType precision = storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision());
+            uint64_t iterations = 0;
+            bool converged = false;
+            while (!converged) {
+                ValueType maximalDifference = storm::utility::zero<ValueType>();
+                for (auto stateIt = relevantStates.rbegin(); stateIt != relevantStates.rend(); ++stateIt) {
+                    auto const& rows = lazyModel.getRows(*stateIt);
+                    ValueType newValue = storm::utility::zero<ValueType>();
+                    for (std::size_t row = 0; row < rows.getNumberOfRows(); ++row) {
+                        ValueType rowValue = storm::utility::zero<ValueType>();
+                        for (auto entryIt = rows.begin(row), entryIte = rows.end(row); entryIt != entryIte; ++entryIt) {
+                            rowValue += entryIt->getValue() * values[entryIt->getColumn()];
+                        }
+                        if (row == 0 || (direction == storm::OptimizationDirection::Maximize ? rowValue > newValue : rowValue < newValue)) {
+                            newValue = rowValue;
+                        }
+                    }
+                    maximalDifference = std::max(maximalDifference, storm::utility::abs<ValueType>(newValue - values[*stateIt]));
+                    values[*stateIt] = newValue;
+                }
+                ++iterations;
+                // This is the usual (unsound) value iteration criterion. Unlike the sampling method, it does not yield an
+                // error bound, since slowly converging values may still be far from the fixpoint.
+                converged = maximalDifference < precision;
+            }
+            STORM_LOG_DEBUG("Lazy value iteration converged after " << iterations << " iterations.");
+            
+            // Show statistics if required.
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                lazyModel.printStatisticsToStream(std::cout);
+                std::cout << "Iterations: " << iterations << std::endl;
+            }
+            
+            return std::make_pair(initialStateIndex, values[initialStateIndex]);
+        }
+        
         template<typename ModelType, typename StateType>
         bool SparseExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const {
             // Start the search from the initial state.
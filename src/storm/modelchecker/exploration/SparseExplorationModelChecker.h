@@ -26,6 +26,7 @@ namespace storm {
     namespace modelchecker {
         namespace exploration_detail {
             template <typename StateType, typename ValueType> class StateGeneration;
+            template <typename StateType, typename ValueType> class LazyModel;
             template <typename StateType, typename ValueType> class ExplorationInformation;
             template <typename StateType, typename ValueType> class Bounds;
             template <typename StateType, typename ValueType> struct Statistics;
@@ -48,6 +49,13 @@ namespace storm {
             
         private:
             std::tuple<StateType, ValueType, ValueType> performExploration(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation) const;
+            
+            /*!
+             * Performs value iteration from below on the relevant part of the lazy model. The iteration stops once no value
+             * changes by more than the exploration precision in a sweep. As no upper bounds are maintained, the returned
+             * value is a lower bound on the actual probability, but its distance to it is not bounded by the precision.
+             */
+            std::pair<StateType, ValueType> performLazyValueIteration(LazyModel<StateType, ValueType>& lazyModel, storm::OptimizationDirection const& direction) const;
 
             bool samplePathFromInitialState(StateGeneration<StateType, ValueType>& stateGeneration, ExplorationInformation<StateType, ValueType>& explorationInformation, StateActionStack& stack, Bounds<StateType, ValueType>& bounds, Statistics<StateType, ValueType>& stats) const;
             
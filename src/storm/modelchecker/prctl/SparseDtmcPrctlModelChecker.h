@@ -35,6 +35,12 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> computeLongRunAverageRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::LongRunAverageRewardFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType, CheckTask<storm::logic::EventuallyFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env, CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
+            
+            /*!
+             * Computes the probabilities of the given until formulas. Formulas with the same maybe states share their
+             * equation system, which is then solved for all of them simultaneously.
+             */
+            std::vector<std::unique_ptr<CheckResult>> computeUntilProbabilitiesBatch(Environment const& env, std::vector<CheckTask<storm::logic::UntilFormula, ValueType>> const& checkTasks);
         };
         
     } // namespace modelchecker
@@ -10,6 +10,11 @@ namespace storm {
     class Environment;
     
     namespace modelchecker {
+        namespace helper {
+            template<typename ValueType>
+            class SparseMdpSolverCache;
+        }
+        
         template<class SparseMdpModelType>
         class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<SparseMdpModelType> {
         public:
@@ -35,6 +40,17 @@ namespace storm {
             virtual std::unique_ptr<CheckResult> checkMultiObjectiveFormula(Environment const& env, CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
             virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env, CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
             
+            /*!
+             * Sets a cache that is used to share intermediate results among queries on the model of this checker. The
+             * same cache may be used by several checkers as long as they all operate on the same model. A null pointer
+             * disables the caching (which is the default).
+             */
+            void setSolverCache(std::shared_ptr<helper::SparseMdpSolverCache<ValueType>> const& solverCache);
+            std::shared_ptr<helper::SparseMdpSolverCache<ValueType>> const& getSolverCache() const;
+            
+        private:
+            // The cache that is shared among queries (if any).
+            std::shared_ptr<helper::SparseMdpSolverCache<ValueType>> solverCache;
         };
     } // namespace modelchecker
 } // namespace storm
@@ -52,7 +52,7 @@ namespace storm {
                 if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
                     maybeStates = hint.template asExplicitModelCheckerHint<ValueType>().getMaybeStates();
                 } else {
-                    maybeStates = storm::utility::graph::performProbGreater0(backwardTransitions, phiStates, psiStates, true, stepBound);
+                    maybeStates = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates, true, stepBound);
                     maybeStates &= ~psiStates;
                 }
                 
@@ -170,7 +170,7 @@ namespace storm {
             }
             
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 
                 std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
                 
@@ -197,7 +197,7 @@ namespace storm {
                     STORM_LOG_INFO("Preprocessing: " << statesWithProbability1.getNumberOfSetBits() << " states with probability 1 (" << maybeStates.getNumberOfSetBits() << " states remaining).");
                 } else {
                     // Get all states that have probability 0 and 1 of satisfying the until-formula.
-                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = analysisCache ? analysisCache->getProb01(transitionMatrix, phiStates, psiStates) : storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, phiStates, psiStates);
                     storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
                     statesWithProbability1 = std::move(statesWithProbability01.second);
                     maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -256,6 +256,107 @@ namespace storm {
                 return result;
             }
 
+            template<typename ValueType, typename RewardModelType>
+            std::vector<std::vector<ValueType>> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilitiesBatch(Environment const& env, std::vector<storm::solver::SolveGoal<ValueType>>&& goals, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<storm::storage::BitVector> const& phiStates, std::vector<storm::storage::BitVector> const& psiStates, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
+                STORM_LOG_THROW(phiStates.size() == psiStates.size(), storm::exceptions::IllegalArgumentException, "Expected the same number of phi and psi states.");
+                STORM_LOG_THROW(goals.size() == phiStates.size(), storm::exceptions::IllegalArgumentException, "Expected one goal per query.");
+                uint64_t numberOfQueries = phiStates.size();
+                std::vector<std::vector<ValueType>> result(numberOfQueries);
+                
+                // Queries with a bounded goal need a termination condition of their own, so they are checked individually.
+                storm::storage::BitVector remainingQueries(numberOfQueries, false);
+                for (uint64_t query = 0; query < numberOfQueries; ++query) {
+                    if (goals[query].isBounded()) {
+                        result[query] = computeUntilProbabilities(env, std::move(goals[query]), transitionMatrix, backwardTransitions, phiStates[query], psiStates[query], false, ModelCheckerHint(), analysisCache);
+                    } else {
+                        remainingQueries.set(query, true);
+                    }
+                }
+                
+                // Perform the qualitative analysis for each remaining query separately.
+                std::vector<storm::storage::BitVector> maybeStates(numberOfQueries), statesWithProbability1(numberOfQueries);
+                for (uint64_t query = 0; query < numberOfQueries; ++query) {
+                    if (!remainingQueries.get(query)) {
+                        continue;
+                    }
+                    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = analysisCache ? analysisCache->getProb01(transitionMatrix, phiStates[query], psiStates[query]) : storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, phiStates[query], psiStates[query]);
+                    statesWithProbability1[query] = std::move(statesWithProbability01.second);
+                    maybeStates[query] = ~(statesWithProbability01.first | statesWithProbability1[query]);
+                    result[query] = std::vector<ValueType>(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                    storm::utility::vector::setVectorValues<ValueType>(result[query], statesWithProbability1[query], storm::utility::one<ValueType>());
+                    if (maybeStates[query].empty()) {
+                        remainingQueries.set(query, false);
+                    }
+                }
+                
+                storm::solver::GeneralLinearEquationSolverFactory<ValueType> linearEquationSolverFactory;
+                bool convertToEquationSystem = linearEquationSolverFactory.getEquationProblemFormat(env) == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+                
+                while (!remainingQueries.empty()) {
+                    // Collect all queries that have the same maybe states as the first remaining one.
+                    uint64_t firstQuery = remainingQueries.getNextSetIndex(0);
+                    storm::storage::BitVector const& currentMaybeStates = maybeStates[firstQuery];
+                    std::vector<uint64_t> batch;
+                    for (auto query : remainingQueries) {
+                        if (maybeStates[query] == currentMaybeStates) {
+                            batch.push_back(query);
+                        }
+                    }
+                    for (auto query : batch) {
+                        remainingQueries.set(query, false);
+                    }
+                    uint64_t batchSize = batch.size();
+                    uint64_t numberOfMaybeStates = currentMaybeStates.getNumberOfSetBits();
+                    STORM_LOG_INFO("Solving " << batchSize << " until queries with " << numberOfMaybeStates << " maybe states simultaneously.");
+                    
+                    storm::storage::SparseMatrix<ValueType> submatrix = transitionMatrix.getSubmatrix(true, currentMaybeStates, currentMaybeStates, convertToEquationSystem);
+                    if (convertToEquationSystem) {
+                        // Converting the matrix from the fixpoint notation to the form needed for the equation
+                        // system. That is, we go from x = A*x + b to (I-A)x = b.
+                        submatrix.convertToEquationSystem();
+                    }
+                    
+                    // Interleave the right-hand sides of the queries such that the entries of each state are stored contiguously.
+                    std::vector<ValueType> x(numberOfMaybeStates * batchSize, storm::utility::convertNumber<ValueType>(0.5));
+                    std::vector<ValueType> b(numberOfMaybeStates * batchSize);
+                    for (uint64_t index = 0; index < batchSize; ++index) {
+                        std::vector<ValueType> queryB = transitionMatrix.getConstrainedRowSumVector(currentMaybeStates, statesWithProbability1[batch[index]]);
+                        for (uint64_t row = 0; row < numberOfMaybeStates; ++row) {
+                            b[row * batchSize + index] = std::move(queryB[row]);
+                        }
+                    }
+                    
+                    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = storm::solver::configureLinearEquationSolver(env, storm::solver::SolveGoal<ValueType>(), linearEquationSolverFactory, std::move(submatrix));
+                    solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
+                    
+                    // The values of a state are relevant if they are relevant for at least one query of the batch.
+                    bool allGoalsHaveRelevantValues = true;
+                    storm::storage::BitVector relevantValues(transitionMatrix.getRowCount(), false);
+                    for (auto query : batch) {
+                        if (goals[query].hasRelevantValues()) {
+                            relevantValues |= goals[query].relevantValues();
+                        } else {
+                            allGoalsHaveRelevantValues = false;
+                            break;
+                        }
+                    }
+                    if (allGoalsHaveRelevantValues) {
+                        solver->setRelevantValues(relevantValues % currentMaybeStates);
+                    }
+                    solver->solveEquationsBatch(env, batchSize, x, b);
+                    
+                    // Set values of resulting vectors according to the solution.
+                    for (uint64_t index = 0; index < batchSize; ++index) {
+                        uint64_t row = 0;
+                        for (auto state : currentMaybeStates) {
+                            result[batch[index]][state] = x[row * batchSize + index];
+                            ++row;
+                        }
+                    }
+                }
+                return result;
+            }
+
             template<typename ValueType, typename RewardModelType>
             std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
 
@@ -317,9 +418,9 @@ namespace storm {
             }
 
             template<typename ValueType, typename RewardModelType>
-            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative) {
+            std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 goal.oneMinus();
-                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative);
+                std::vector<ValueType> result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowCount(), true), ~psiStates, qualitative, ModelCheckerHint(), analysisCache);
                 for (auto& entry : result) {
                     entry = storm::utility::one<ValueType>() - entry;
                 }
@@ -373,7 +474,7 @@ namespace storm {
                 // Identify the states from which only states with zero reward are reachable.
                 // We can then compute reachability rewards assuming these states as target set.
                 storm::storage::BitVector statesWithoutReward = rewardModel.getStatesWithZeroReward(transitionMatrix);
-                storm::storage::BitVector rew0States = storm::utility::graph::performProbGreater0(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+                storm::storage::BitVector rew0States = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, statesWithoutReward, ~statesWithoutReward);
                 rew0States.complement();
                 return computeReachabilityRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, rew0States, qualitative, hint);
             }
@@ -575,7 +676,7 @@ namespace storm {
                     // First, compute the relevant states and some offsets.
                     storm::storage::BitVector allStates(targetStates.size(), true);
                     std::vector<uint_fast64_t> numberOfBeforeStatesUpToState = result.beforeStates.getNumberOfSetBitsBeforeIndices();
-                    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(backwardTransitions, allStates, targetStates);
+                    storm::storage::BitVector statesWithProbabilityGreater0 = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, allStates, targetStates);
                     statesWithProbabilityGreater0 &= storm::utility::graph::getReachableStates(transitionMatrix, conditionStates, allStates, targetStates);
                     uint_fast64_t normalStatesOffset = result.beforeStates.getNumberOfSetBits();
                     std::vector<uint_fast64_t> numberOfNormalStatesUpToState = statesWithProbabilityGreater0.getNumberOfSetBitsBeforeIndices();
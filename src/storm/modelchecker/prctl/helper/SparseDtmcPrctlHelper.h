@@ -11,6 +11,7 @@
 
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/sparse/ModelAnalysisCache.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolveGoal.h"
@@ -34,11 +35,22 @@ namespace storm {
                 
                 static std::vector<ValueType> computeNextProbabilities(Environment const& env, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& nextStates);
                 
-                static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                /*!
+                 * Computes the until probabilities. If an analysis cache (of the model with the given transition matrix)
+                 * is given, the states with probability 0 and 1 are taken from it.
+                 */
+                static std::vector<ValueType> computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(), storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
+
+                /*!
+                 * Computes the until probabilities for the i-th phi and psi states for all i. Queries with the same maybe
+                 * states share their equation system, which is then solved for all of them simultaneously. Queries whose goal
+                 * is bounded are checked individually, as their termination condition refers to a single solution vector.
+                 */
+                static std::vector<std::vector<ValueType>> computeUntilProbabilitiesBatch(Environment const& env, std::vector<storm::solver::SolveGoal<ValueType>>&& goals, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, std::vector<storm::storage::BitVector> const& phiStates, std::vector<storm::storage::BitVector> const& psiStates, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
 
                 static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
 
-                static std::vector<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative);
+                static std::vector<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache = nullptr);
                 
                 static std::vector<ValueType> computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, RewardModelType const& rewardModel, uint_fast64_t stepBound);
                 
@@ -7,6 +7,7 @@
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverCache.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -64,7 +65,7 @@ namespace storm {
                     if (goal.minimize()) {
                         maybeStates = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates, true, stepBound);
                     } else {
-                        maybeStates = storm::utility::graph::performProbGreater0E(backwardTransitions, phiStates, psiStates, true, stepBound);
+                        maybeStates = storm::utility::graph::performProbGreater0E(transitionMatrix, backwardTransitions, phiStates, psiStates, true, stepBound);
                     }
                     maybeStates &= ~psiStates;
                 }
@@ -509,12 +510,14 @@ namespace storm {
             }
             
             template<typename ValueType>
-            QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+            QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 QualitativeStateSetsUntilProbabilities result;
 
                 // Get all states that have probability 0 and 1 of satisfying the until-formula.
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-                if (goal.minimize()) {
+                if (analysisCache) {
+                    statesWithProbability01 = goal.minimize() ? analysisCache->getProb01Min(transitionMatrix, phiStates, psiStates) : analysisCache->getProb01Max(transitionMatrix, phiStates, psiStates);
+                } else if (goal.minimize()) {
                     statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
                 } else {
                     statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
@@ -527,11 +530,11 @@ namespace storm {
             }
             
             template<typename ValueType>
-            QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+            QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities(storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
                     return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
                 } else {
-                    return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+                    return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, analysisCache);
                 }
             }
             
@@ -578,6 +581,21 @@ namespace storm {
                 goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
             }
             
+            template<typename ValueType>
+            void restrictRelevantValuesAfterEndComponentElimination(storm::solver::SolveGoal<ValueType>& goal, storm::storage::BitVector const& maybeStates, SparseMdpEndComponentInformation<ValueType> const& ecInformation, uint64_t numberOfRowGroupsAfterElimination) {
+                if (goal.hasRelevantValues()) {
+                    storm::storage::BitVector newRelevantValues(numberOfRowGroupsAfterElimination);
+                    for (auto state : goal.relevantValues()) {
+                        if (maybeStates.get(state)) {
+                            newRelevantValues.set(ecInformation.getRowGroupAfterElimination(state));
+                        }
+                    }
+                    if (!newRelevantValues.empty()) {
+                        goal.setRelevantValues(std::move(newRelevantValues));
+                    }
+                }
+            }
+            
             template<typename ValueType>
             boost::optional<SparseMdpEndComponentInformation<ValueType>> computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(storm::solver::SolveGoal<ValueType>& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, QualitativeStateSetsUntilProbabilities const& qualitativeStateSets, storm::storage::SparseMatrix<ValueType>& submatrix, std::vector<ValueType>& b) {
                 
@@ -598,17 +616,7 @@ namespace storm {
                     SparseMdpEndComponentInformation<ValueType> result = SparseMdpEndComponentInformation<ValueType>::eliminateEndComponents(endComponentDecomposition, transitionMatrix, qualitativeStateSets.maybeStates, &qualitativeStateSets.statesWithProbability1, nullptr, nullptr, submatrix, &b, nullptr);
                     
                     // If the solve goal has relevant values, we need to adjust them.
-                    if (goal.hasRelevantValues()) {
-                        storm::storage::BitVector newRelevantValues(submatrix.getRowGroupCount());
-                        for (auto state : goal.relevantValues()) {
-                            if (qualitativeStateSets.maybeStates.get(state)) {
-                                newRelevantValues.set(result.getRowGroupAfterElimination(state));
-                            }
-                        }
-                        if (!newRelevantValues.empty()) {
-                            goal.setRelevantValues(std::move(newRelevantValues));
-                        }
-                    }
+                    restrictRelevantValuesAfterEndComponentElimination(goal, qualitativeStateSets.maybeStates, result, submatrix.getRowGroupCount());
                     
                     return result;
                 } else {
@@ -620,15 +628,39 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, SparseMdpSolverCache<ValueType>* solverCache, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException, "Cannot produce scheduler when performing qualitative model checking only.");
                 
                 // Prepare resulting vector.
                 std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                 
+                // Look up the results of previous queries. A given hint takes precedence over the cache.
+                typename SparseMdpSolverCache<ValueType>::UntilProbabilitiesEntry* cacheEntry = nullptr;
+                bool cacheHit = false;
+                if (solverCache && hint.isEmpty()) {
+                    cacheEntry = solverCache->findUntilProbabilitiesEntry(goal.direction(), phiStates, psiStates);
+                    cacheHit = cacheEntry != nullptr;
+                    if (!cacheHit) {
+                        cacheEntry = &solverCache->addUntilProbabilitiesEntry(goal.direction(), phiStates, psiStates);
+                    }
+                }
+                
                 // We need to identify the maybe states (states which have a probability for satisfying the until formula
                 // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
-                QualitativeStateSetsUntilProbabilities qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+                QualitativeStateSetsUntilProbabilities qualitativeStateSets;
+                if (cacheHit) {
+                    STORM_LOG_DEBUG("Reusing qualitative state sets from the solver cache.");
+                    qualitativeStateSets.maybeStates = cacheEntry->maybeStates;
+                    qualitativeStateSets.statesWithProbability0 = cacheEntry->statesWithProbability0;
+                    qualitativeStateSets.statesWithProbability1 = cacheEntry->statesWithProbability1;
+                } else {
+                    qualitativeStateSets = getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, analysisCache);
+                    if (cacheEntry) {
+                        cacheEntry->maybeStates = qualitativeStateSets.maybeStates;
+                        cacheEntry->statesWithProbability0 = qualitativeStateSets.statesWithProbability0;
+                        cacheEntry->statesWithProbability1 = qualitativeStateSets.statesWithProbability1;
+                    }
+                }
                 
                 STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, " << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 (" << qualitativeStateSets.maybeStates.getNumberOfSetBits() << " states remaining).");
                 
@@ -650,7 +682,9 @@ namespace storm {
                         // In this case we have have to compute the remaining probabilities.
                         
                         // Obtain proper hint information either from the provided hint or from requirements of the solver.
-                        SparseMdpHintType<ValueType> hintInformation = computeHints(env, SolutionType::UntilProbabilities, hint, goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates, phiStates, qualitativeStateSets.statesWithProbability1, produceScheduler);
+                        // The solution of a previous query serves as hint if no other hint is given.
+                        ModelCheckerHint const& effectiveHint = cacheHit ? cacheEntry->solutionHint : hint;
+                        SparseMdpHintType<ValueType> hintInformation = computeHints(env, SolutionType::UntilProbabilities, effectiveHint, goal.direction(), transitionMatrix, backwardTransitions, qualitativeStateSets.maybeStates, phiStates, qualitativeStateSets.statesWithProbability1, produceScheduler);
                         
                         // Declare the components of the equation system we will solve.
                         storm::storage::SparseMatrix<ValueType> submatrix;
@@ -658,16 +692,36 @@ namespace storm {
                         
                         // If the hint information tells us that we have to eliminate MECs, we do so now.
                         boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
-                        if (hintInformation.getEliminateEndComponents()) {
+                        bool reuseEquationSystem = cacheHit && cacheEntry->submatrix && cacheEntry->endComponentsEliminated == hintInformation.getEliminateEndComponents();
+                        if (reuseEquationSystem) {
+                            STORM_LOG_DEBUG("Reusing equation system from the solver cache.");
+                            submatrix = cacheEntry->submatrix.get();
+                            b = cacheEntry->b;
+                            ecInformation = cacheEntry->ecInformation;
+                            
+                            // If the solve goal has relevant values, we need to adjust them.
+                            if (ecInformation && ecInformation.get().getEliminatedEndComponents()) {
+                                restrictRelevantValuesAfterEndComponentElimination(goal, qualitativeStateSets.maybeStates, ecInformation.get(), submatrix.getRowGroupCount());
+                            } else {
+                                goal.restrictRelevantValues(qualitativeStateSets.maybeStates);
+                            }
+                        } else if (hintInformation.getEliminateEndComponents()) {
                             ecInformation = computeFixedPointSystemUntilProbabilitiesEliminateEndComponents(goal, transitionMatrix, backwardTransitions, qualitativeStateSets, submatrix, b);
-
-                            // Make sure we are not supposed to produce a scheduler if we actually eliminate end components.
-                            STORM_LOG_THROW(!ecInformation || !ecInformation.get().getEliminatedEndComponents() || !produceScheduler, storm::exceptions::NotSupportedException, "Producing schedulers is not supported if end-components need to be eliminated for the solver.");
                         } else {
                             // Otherwise, we compute the standard equations.
                             computeFixedPointSystemUntilProbabilities(goal, transitionMatrix, qualitativeStateSets, submatrix, b);
                         }
                         
+                        // Make sure we are not supposed to produce a scheduler if we actually eliminate end components.
+                        STORM_LOG_THROW(!ecInformation || !ecInformation.get().getEliminatedEndComponents() || !produceScheduler, storm::exceptions::NotSupportedException, "Producing schedulers is not supported if end-components need to be eliminated for the solver.");
+                        
+                        if (cacheEntry && !reuseEquationSystem) {
+                            cacheEntry->submatrix = submatrix;
+                            cacheEntry->b = b;
+                            cacheEntry->ecInformation = ecInformation;
+                            cacheEntry->endComponentsEliminated = hintInformation.getEliminateEndComponents();
+                        }
+                        
                         // Now compute the results for the maybe states.
                         MaybeStateResult<ValueType> resultForMaybeStates = computeValuesForMaybeStates(env, std::move(goal), std::move(submatrix), b, produceScheduler, hintInformation);
                         
@@ -690,6 +744,15 @@ namespace storm {
                     extendScheduler(*scheduler, goal, qualitativeStateSets, transitionMatrix, backwardTransitions, phiStates, psiStates);
                 }
                 
+                // Keep the solution (and the scheduler) as hint for subsequent queries. Hints are disregarded if end
+                // components are eliminated, so we do not store them in this case.
+                if (cacheEntry && !qualitative && !cacheEntry->endComponentsEliminated) {
+                    cacheEntry->solutionHint.setResultHint(result);
+                    if (produceScheduler) {
+                        cacheEntry->solutionHint.setSchedulerHint(*scheduler);
+                    }
+                }
+                
                 // Sanity check for created scheduler.
                 STORM_LOG_ASSERT(!produceScheduler || scheduler, "Expected that a scheduler was obtained.");
                 STORM_LOG_ASSERT((!produceScheduler && !scheduler) || !scheduler->isPartialScheduler(), "Expected a fully defined scheduler");
@@ -778,7 +841,7 @@ namespace storm {
                 } else {
                     // Identify the states from which only states with zero reward are reachable.
                     storm::storage::BitVector statesWithoutReward = rewardModel.getStatesWithZeroReward(transitionMatrix);
-                    storm::storage::BitVector rew0AStates = storm::utility::graph::performProbGreater0E(backwardTransitions, statesWithoutReward, ~statesWithoutReward);
+                    storm::storage::BitVector rew0AStates = storm::utility::graph::performProbGreater0E(transitionMatrix, backwardTransitions, statesWithoutReward, ~statesWithoutReward);
                     rew0AStates.complement();
                     
                     // There might be end components that consists only of states/choices with zero rewards. The reachability reward semantics would assign such
@@ -1207,7 +1270,7 @@ namespace storm {
             }
             
             template<typename ValueType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool produceScheduler) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& psiStates, bool produceScheduler, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 
                 // If there are no goal states, we avoid the computation and directly return zero.
                 if (psiStates.empty()) {
@@ -1224,12 +1287,12 @@ namespace storm {
                 std::vector<ValueType> stateRewards(psiStates.size(), storm::utility::zero<ValueType>());
                 storm::utility::vector::setVectorValues(stateRewards, psiStates, storm::utility::one<ValueType>());
                 storm::models::sparse::StandardRewardModel<ValueType> rewardModel(std::move(stateRewards));
-                return computeLongRunAverageRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, produceScheduler);
+                return computeLongRunAverageRewards(env, std::move(goal), transitionMatrix, backwardTransitions, rewardModel, produceScheduler, analysisCache);
             }
             
             template<typename ValueType>
             template<typename RewardModelType>
-            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool produceScheduler) {
+            MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, bool produceScheduler, storm::storage::sparse::ModelAnalysisCache<ValueType>* analysisCache) {
                 
                 uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
 
@@ -1239,7 +1302,13 @@ namespace storm {
                 }
                 
                 // Start by decomposing the MDP into its MECs.
-                storm::storage::MaximalEndComponentDecomposition<ValueType> mecDecomposition(transitionMatrix, backwardTransitions);
+                std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecompositionPtr;
+                if (analysisCache) {
+                    mecDecompositionPtr = analysisCache->getMaximalEndComponents(transitionMatrix);
+                } else {
+                    mecDecompositionPtr = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, backwardTransitions);
+                }
+                storm::storage::MaximalEndComponentDecomposition<ValueType> const& mecDecomposition = *mecDecompositionPtr;
                 
                 // Get some data members for convenience.
                 std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -1813,7 +1882,7 @@ namespace storm {
             template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, uint_fast64_t stepBound);
             template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
             template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
-            template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool produceScheduler);
+            template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool produceScheduler, storm::storage::sparse::ModelAnalysisCache<double>* analysisCache);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponent(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, std::unique_ptr<storm::storage::Scheduler<double>>& scheduler);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponentVI(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec, std::unique_ptr<storm::storage::Scheduler<double>>& scheduler);
             template double SparseMdpPrctlHelper<double>::computeLraForMaximalEndComponentLP(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::models::sparse::StandardRewardModel<double> const& rewardModel, storm::storage::MaximalEndComponent const& mec);
@@ -1824,7 +1893,7 @@ namespace storm {
             template std::vector<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeCumulativeRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, uint_fast64_t stepBound);
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
             template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
-            template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool produceScheduler);
+            template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeLongRunAverageRewards(Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, bool produceScheduler, storm::storage::sparse::ModelAnalysisCache<storm::RationalNumber>* analysisCache);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponent(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec, std::unique_ptr<storm::storage::Scheduler<storm::RationalNumber>>& scheduler);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponentVI(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec, std::unique_ptr<storm::storage::Scheduler<storm::RationalNumber>>& scheduler);
             template storm::RationalNumber SparseMdpPrctlHelper<storm::RationalNumber>::computeLraForMaximalEndComponentLP(Environment const& env, OptimizationDirection dir, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::MaximalEndComponent const& mec);
@@ -0,0 +1,75 @@
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverCache.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            SparseMdpSolverCache<ValueType>::UntilProbabilitiesEntry::UntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) : direction(direction), phiStates(phiStates), psiStates(psiStates), endComponentsEliminated(false) {
+                // The hint only carries the solution and the scheduler, so we explicitly disable its other options.
+                solutionHint.setComputeOnlyMaybeStates(false);
+                solutionHint.setNoEndComponentsInMaybeStates(false);
+            }
+
+            template<typename ValueType>
+            bool SparseMdpSolverCache<ValueType>::UntilProbabilitiesEntry::matches(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const {
+                return this->direction == direction && this->psiStates == psiStates && this->phiStates == phiStates;
+            }
+
+            template<typename ValueType>
+            SparseMdpSolverCache<ValueType>::SparseMdpSolverCache(uint64_t maximalNumberOfEntries) : maximalNumberOfEntries(maximalNumberOfEntries), numberOfHits(0) {
+                STORM_LOG_THROW(maximalNumberOfEntries > 0, storm::exceptions::InvalidArgumentException, "The cache needs to be able to hold at least one entry.");
+            }
+
+            template<typename ValueType>
+            typename SparseMdpSolverCache<ValueType>::UntilProbabilitiesEntry* SparseMdpSolverCache<ValueType>::findUntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                for (auto entryIt = untilProbabilitiesEntries.begin(); entryIt != untilProbabilitiesEntries.end(); ++entryIt) {
+                    if (entryIt->matches(direction, phiStates, psiStates)) {
+                        // Move the entry to the front.
+                        untilProbabilitiesEntries.splice(untilProbabilitiesEntries.begin(), untilProbabilitiesEntries, entryIt);
+                        ++numberOfHits;
+                        return &untilProbabilitiesEntries.front();
+                    }
+                }
+                return nullptr;
+            }
+
+            template<typename ValueType>
+            typename SparseMdpSolverCache<ValueType>::UntilProbabilitiesEntry& SparseMdpSolverCache<ValueType>::addUntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                if (untilProbabilitiesEntries.size() >= maximalNumberOfEntries) {
+                    STORM_LOG_DEBUG("Evicting least recently used entry from the solver cache.");
+                    untilProbabilitiesEntries.pop_back();
+                }
+                untilProbabilitiesEntries.emplace_front(direction, phiStates, psiStates);
+                return untilProbabilitiesEntries.front();
+            }
+
+            template<typename ValueType>
+            uint64_t SparseMdpSolverCache<ValueType>::getNumberOfEntries() const {
+                return untilProbabilitiesEntries.size();
+            }
+
+            template<typename ValueType>
+            uint64_t SparseMdpSolverCache<ValueType>::getNumberOfHits() const {
+                return numberOfHits;
+            }
+
+            template<typename ValueType>
+            void SparseMdpSolverCache<ValueType>::clear() {
+                untilProbabilitiesEntries.clear();
+                numberOfHits = 0;
+            }
+
+            template class SparseMdpSolverCache<double>;
+
+#ifdef STORM_HAVE_CARL
+            template class SparseMdpSolverCache<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <list>
+#include <cstdint>
+#include <boost/optional.hpp>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Stores intermediate results of until probability computations on an MDP. A later query with the same
+             * optimization direction and the same phi and psi states (e.g., a property that only differs in its bound)
+             * can then skip the qualitative analysis and the construction of the equation system for the maybe states.
+             * The solution and the scheduler of the previous query are kept as well and serve as hints for the solver.
+             *
+             * A cache must only be used for queries on a single model. If the maximal number of entries is exceeded,
+             * the least recently used entry is evicted.
+             */
+            template<typename ValueType>
+            class SparseMdpSolverCache {
+            public:
+                struct UntilProbabilitiesEntry {
+                    UntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                    bool matches(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) const;
+
+                    // The query that is described by this entry.
+                    storm::solver::OptimizationDirection direction;
+                    storm::storage::BitVector phiStates;
+                    storm::storage::BitVector psiStates;
+
+                    // The result of the qualitative analysis.
+                    storm::storage::BitVector maybeStates;
+                    storm::storage::BitVector statesWithProbability0;
+                    storm::storage::BitVector statesWithProbability1;
+
+                    // The equation system for the maybe states (if it was built already) and whether end components were
+                    // eliminated when building it.
+                    boost::optional<storm::storage::SparseMatrix<ValueType>> submatrix;
+                    std::vector<ValueType> b;
+                    boost::optional<SparseMdpEndComponentInformation<ValueType>> ecInformation;
+                    bool endComponentsEliminated;
+
+                    // The values and (if produced) the scheduler obtained by the most recent query.
+                    ExplicitModelCheckerHint<ValueType> solutionHint;
+                };
+
+                SparseMdpSolverCache(uint64_t maximalNumberOfEntries = 16);
+
+                /*!
+                 * Retrieves the entry for the given query and nullptr if there is none. A retrieved entry counts as most
+                 * recently used.
+                 */
+                UntilProbabilitiesEntry* findUntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Adds an (empty) entry for the given query, possibly evicting the least recently used entry.
+                 */
+                UntilProbabilitiesEntry& addUntilProbabilitiesEntry(storm::solver::OptimizationDirection direction, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                uint64_t getNumberOfEntries() const;
+
+                /*!
+                 * Retrieves how often an entry was found.
+                 */
+                uint64_t getNumberOfHits() const;
+
+                void clear();
+
+            private:
+                uint64_t maximalNumberOfEntries;
+                uint64_t numberOfHits;
+
+                // The entries, most recently used first.
+                std::list<UntilProbabilitiesEntry> untilProbabilitiesEntries;
+            };
+        }
+    }
+}
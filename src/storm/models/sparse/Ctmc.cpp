@@ -34,6 +34,7 @@ namespace storm {
                 
                 if (!components.rateTransitions) {
                     this->getTransitionMatrix().scaleRowsInPlace(exitRates);
+                    this->invalidateAnalysisCache();
                 }
             }
             
@@ -50,6 +51,7 @@ namespace storm {
                
                 if (!components.rateTransitions) {
                     this->getTransitionMatrix().scaleRowsInPlace(exitRates);
+                    this->invalidateAnalysisCache();
                 }
             }
             
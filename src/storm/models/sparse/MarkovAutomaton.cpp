@@ -174,6 +174,7 @@ namespace storm {
                         STORM_LOG_THROW(comparator.isOne(this->getTransitionMatrix().getRowSum(row)), storm::exceptions::InvalidArgumentException, "Entries of transition matrix do not sum up to one for (non-Markovian) choice " << row << " of state " << state << " (sum is " << this->getTransitionMatrix().getRowSum(row) << ").");
                     }
                 }
+                this->invalidateAnalysisCache();
             }
 
             template <typename ValueType, typename RewardModelType>
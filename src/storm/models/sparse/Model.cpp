@@ -19,18 +19,40 @@ namespace storm {
 
             template <typename ValueType, typename RewardModelType>
             Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components)
-            : storm::models::Model<ValueType>(modelType), transitionMatrix(components.transitionMatrix), stateLabeling(components.stateLabeling), rewardModels(components.rewardModels),
+            : storm::models::Model<ValueType>(modelType), transitionMatrix(components.transitionMatrix), analysisCache(std::make_shared<storm::storage::sparse::ModelAnalysisCache<ValueType>>()), stateLabeling(components.stateLabeling), rewardModels(components.rewardModels),
                       choiceLabeling(components.choiceLabeling), stateValuations(components.stateValuations), choiceOrigins(components.choiceOrigins) {
                 assertValidityOfComponents(components);
             }
             
             template <typename ValueType, typename RewardModelType>
             Model<ValueType, RewardModelType>::Model(ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components)
-            : storm::models::Model<ValueType>(modelType), transitionMatrix(std::move(components.transitionMatrix)), stateLabeling(std::move(components.stateLabeling)), rewardModels(std::move(components.rewardModels)),
+            : storm::models::Model<ValueType>(modelType), transitionMatrix(std::move(components.transitionMatrix)), analysisCache(std::make_shared<storm::storage::sparse::ModelAnalysisCache<ValueType>>()), stateLabeling(std::move(components.stateLabeling)), rewardModels(std::move(components.rewardModels)),
                       choiceLabeling(std::move(components.choiceLabeling)), stateValuations(std::move(components.stateValuations)), choiceOrigins(std::move(components.choiceOrigins)) {
                 assertValidityOfComponents(components);
             }
             
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>::Model(Model<ValueType, RewardModelType> const& other)
+            : storm::models::Model<ValueType>(other), transitionMatrix(other.transitionMatrix), analysisCache(std::make_shared<storm::storage::sparse::ModelAnalysisCache<ValueType>>()), stateLabeling(other.stateLabeling), rewardModels(other.rewardModels),
+                      choiceLabeling(other.choiceLabeling), stateValuations(other.stateValuations), choiceOrigins(other.choiceOrigins) {
+                // Intentionally left empty.
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            Model<ValueType, RewardModelType>& Model<ValueType, RewardModelType>::operator=(Model<ValueType, RewardModelType> const& other) {
+                if (this != &other) {
+                    storm::models::Model<ValueType>::operator=(other);
+                    transitionMatrix = other.transitionMatrix;
+                    analysisCache = std::make_shared<storm::storage::sparse::ModelAnalysisCache<ValueType>>();
+                    stateLabeling = other.stateLabeling;
+                    rewardModels = other.rewardModels;
+                    choiceLabeling = other.choiceLabeling;
+                    stateValuations = other.stateValuations;
+                    choiceOrigins = other.choiceOrigins;
+                }
+                return *this;
+            }
+            
             template <typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::assertValidityOfComponents(storm::storage::sparse::ModelComponents<ValueType, RewardModelType> const& components) const {
                 
@@ -85,6 +107,22 @@ namespace storm {
             storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBackwardTransitions() const {
                 return this->getTransitionMatrix().transpose(true);
             }
+
+            template<typename ValueType, typename RewardModelType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> Model<ValueType, RewardModelType>::getCachedBackwardTransitions() const {
+                return this->getAnalysisCache().getBackwardTransitions(this->getTransitionMatrix());
+            }
+
+            template<typename ValueType, typename RewardModelType>
+            storm::storage::sparse::ModelAnalysisCache<ValueType>& Model<ValueType, RewardModelType>::getAnalysisCache() const {
+                return *analysisCache;
+            }
+
+            template<typename ValueType, typename RewardModelType>
+            void Model<ValueType, RewardModelType>::invalidateAnalysisCache() {
+                // Results handed out earlier may still be in use, so we do not clear the cache but start a new one.
+                analysisCache = std::make_shared<storm::storage::sparse::ModelAnalysisCache<ValueType>>();
+            }
             
             template<typename ValueType, typename RewardModelType>
             typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
@@ -406,11 +444,13 @@ namespace storm {
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                this->invalidateAnalysisCache();
             }
             
             template<typename ValueType, typename RewardModelType>
             void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
                 this->transitionMatrix = std::move(transitionMatrix);
+                this->invalidateAnalysisCache();
             }
             
             template<typename ValueType, typename RewardModelType>
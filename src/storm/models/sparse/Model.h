@@ -9,6 +9,7 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
 #include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/ModelAnalysisCache.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
@@ -35,8 +36,12 @@ namespace storm {
                 typedef CValueType ValueType;
                 typedef CRewardModelType RewardModelType;
                 
-                Model(Model<ValueType, RewardModelType> const& other) = default;
-                Model& operator=(Model<ValueType, RewardModelType> const& other) = default;
+                /*!
+                 * Copies the given model. The copy starts with an empty analysis cache, because it may be modified
+                 * independently of the original.
+                 */
+                Model(Model<ValueType, RewardModelType> const& other);
+                Model& operator=(Model<ValueType, RewardModelType> const& other);
                 
                 /*!
                  * Constructs a model from the given data.
@@ -54,6 +59,26 @@ namespace storm {
                  * @return A sparse matrix that represents the backward transitions of this model.
                  */
                 storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
+
+                /*!
+                 * Retrieves the backward transition relation of the model from its analysis cache. The relation is
+                 * computed if it is not in the cache and remains valid even if it is evicted from the cache afterwards.
+                 *
+                 * @return A sparse matrix that represents the backward transitions of this model.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getCachedBackwardTransitions() const;
+
+                /*!
+                 * Retrieves the cache for graph analysis results (e.g., decompositions and qualitative state sets) of
+                 * this model.
+                 */
+                storm::storage::sparse::ModelAnalysisCache<ValueType>& getAnalysisCache() const;
+
+                /*!
+                 * Drops all cached analysis results. This needs to be called after the transition matrix was modified
+                 * via getTransitionMatrix().
+                 */
+                void invalidateAnalysisCache();
                 
                 /*!
                  * Returns an object representing the matrix rows associated with the given state.
@@ -115,7 +140,8 @@ namespace storm {
                 storm::storage::SparseMatrix<ValueType> const& getTransitionMatrix() const;
                 
                 /*!
-                 * Retrieves the matrix representing the transitions of the model.
+                 * Retrieves the matrix representing the transitions of the model. Modifying the matrix requires a
+                 * subsequent call to invalidateAnalysisCache().
                  *
                  * @return A matrix representing the transitions of the model.
                  */
@@ -402,6 +428,9 @@ namespace storm {
 
                 //  A matrix representing transition relation.
                 storm::storage::SparseMatrix<ValueType> transitionMatrix;
+
+                // The results of graph analyses of the transition matrix.
+                std::shared_ptr<storm::storage::sparse::ModelAnalysisCache<ValueType>> analysisCache;
                 
                 // The labeling of the states.
                 storm::models::sparse::StateLabeling stateLabeling;
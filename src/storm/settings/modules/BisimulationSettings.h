@@ -25,6 +25,8 @@ namespace storm {
                 
                 enum class RefinementMode { Full, ChangedStates };
                 
+                enum class SparseRefinementMode { Splitter, Signature };
+                
                 /*!
                  * Creates a new set of bisimulation settings.
                  */
@@ -89,6 +91,12 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves the refinement mode to use for sparse models.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                SparseRefinementMode getSparseRefinementMode() const;
                                 
                 virtual bool check() const override;
                 
@@ -105,6 +113,7 @@ namespace storm {
                 static const std::string reuseOptionName;
                 static const std::string initialPartitionOptionName;
                 static const std::string refinementModeOptionName;
+                static const std::string sparseRefinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
             };
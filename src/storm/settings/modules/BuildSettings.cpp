@@ -23,6 +23,14 @@ namespace storm {
             const std::string explorationOrderOptionShortName = "eo";
             const std::string explorationChecksOptionName = "explchecks";
             const std::string explorationChecksOptionShortName = "ec";
+            const std::string parallelExplorationOptionName = "explparallel";
+            const std::string compiledExpressionsOptionName = "explcompiled";
+            const std::string explorationMemoryLimitOptionName = "explmemlimit";
+            const std::string externalExplorationDirectoryOptionName = "explextdir";
+            const std::string stateCompressionOptionName = "explcompress";
+            const std::string lumpingOnTheFlyOptionName = "expllump";
+            const std::string partialOrderReductionOptionName = "explpor";
+            const std::string symmetryReductionOptionName = "explsymmetry";
             const std::string prismCompatibilityOptionName = "prismcompat";
             const std::string prismCompatibilityOptionShortName = "pc";
             const std::string dontFixDeadlockOptionName = "nofixdl";
@@ -48,6 +56,16 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName).setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, parallelExplorationOptionName, false, "If set, the explicit model builder explores the state space with the number of threads given via --threads (requires breadth-first exploration).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, compiledExpressionsOptionName, false, "If set, the explicit model builder evaluates guards, probabilities and assignments of PRISM programs via compiled expressions instead of ExprTk (requires double precision).").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationMemoryLimitOptionName, false, "If set, the explicit model builder stores the explored states and transitions on disk and bounds the memory used for exploring the states in between (requires breadth-first exploration). Only the exploration is bounded: the finished transition matrix is read back into memory, so the model itself still has to fit into memory.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The memory limit in megabytes.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, externalExplorationDirectoryOptionName, false, "Sets the directory in which the files of the explicit model builder are stored if a memory limit is given. By default, the directory for temporary files is used.").setIsAdvanced()
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("directory", "The directory.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, stateCompressionOptionName, false, "If set, the explicit model builder stores the explored states in compressed form, which saves memory for models whose states consist of several modules.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, the explicit model builder applies partial-order reduction to MDPs given as PRISM programs. The reduced model preserves the minimal and maximal probabilities of the properties in the query.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, the explicit model builder identifies the states of PRISM programs that only differ in a permutation of modules obtained from the same module via renaming. Applies only if the program and the labels of the query are invariant under such permutations.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, lumpingOnTheFlyOptionName, false, "If set, the explicit model builder merges bisimilar states of deterministic models while exploring them and only keeps the transitions of one state per block. The result is not necessarily the coarsest quotient, which can be obtained via --bisimulation.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, buildOutOfBoundsStateOptionName, false, "If set, a state for out-of-bounds valuations is added").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, bitsForUnboundedVariablesOptionName, false, "Sets the number of bits that is used for unbounded integer variables.").setIsAdvanced()
                                         .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of bits.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedRangeValidatorExcluding(0,63)).setDefaultValueUnsignedInteger(32).build()).build());
@@ -107,6 +125,46 @@ namespace storm {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
 
+            bool BuildSettings::isParallelExplorationSet() const {
+                return this->getOption(parallelExplorationOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isCompiledExpressionsSet() const {
+                return this->getOption(compiledExpressionsOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isExplorationMemoryLimitSet() const {
+                return this->getOption(explorationMemoryLimitOptionName).getHasOptionBeenSet();
+            }
+
+            uint64_t BuildSettings::getExplorationMemoryLimit() const {
+                return this->getOption(explorationMemoryLimitOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
+
+            bool BuildSettings::isExternalExplorationDirectorySet() const {
+                return this->getOption(externalExplorationDirectoryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getExternalExplorationDirectory() const {
+                return this->getOption(externalExplorationDirectoryOptionName).getArgumentByName("directory").getValueAsString();
+            }
+
+            bool BuildSettings::isStateCompressionSet() const {
+                return this->getOption(stateCompressionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isLumpingOnTheFlySet() const {
+                return this->getOption(lumpingOnTheFlyOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
             uint64_t BuildSettings::getBitsForUnboundedVariables() const {
                 return this->getOption(bitsForUnboundedVariablesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
             }
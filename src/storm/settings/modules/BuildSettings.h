@@ -37,6 +37,78 @@ namespace storm {
                  */
                 bool isExplorationChecksSet() const;
 
+                /*!
+                 * Retrieves whether the explicit model builder is supposed to explore the state space with multiple threads.
+                 *
+                 * @return True if the state space is to be explored in parallel.
+                 */
+                bool isParallelExplorationSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is supposed to evaluate expressions via compiled expressions.
+                 *
+                 * @return True if compiled expressions are to be used.
+                 */
+                bool isCompiledExpressionsSet() const;
+
+                /*!
+                 * Retrieves whether a memory limit for the exploration of the explicit model builder was set. If so,
+                 * the builder stores the explored states and transitions on disk. The built model is still held in
+                 * memory.
+                 *
+                 * @return True if a memory limit was set.
+                 */
+                bool isExplorationMemoryLimitSet() const;
+
+                /*!
+                 * Retrieves the memory limit for the exploration of the explicit model builder.
+                 *
+                 * @return The memory limit in megabytes.
+                 */
+                uint64_t getExplorationMemoryLimit() const;
+
+                /*!
+                 * Retrieves whether the directory for the files of the explicit model builder was set.
+                 *
+                 * @return True if the directory was set.
+                 */
+                bool isExternalExplorationDirectorySet() const;
+
+                /*!
+                 * Retrieves the directory for the files of the explicit model builder.
+                 *
+                 * @return The directory.
+                 */
+                std::string getExternalExplorationDirectory() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to store the explored states in compressed form.
+                 *
+                 * @return True if the states are to be compressed.
+                 */
+                bool isStateCompressionSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to merge bisimilar states while exploring the model.
+                 *
+                 * @return True if the states are to be merged on the fly.
+                 */
+                bool isLumpingOnTheFlySet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to apply partial-order reduction.
+                 *
+                 * @return True if partial-order reduction is to be applied.
+                 */
+                bool isPartialOrderReductionSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to apply symmetry reduction.
+                 *
+                 * @return True if symmetry reduction is to be applied.
+                 */
+                bool isSymmetryReductionSet() const;
+
                 /*!
                  * Retrieves the exploration order if it was set.
                  *
@@ -1,5 +1,8 @@
 #include "storm/settings/modules/CoreSettings.h"
 
+#include <algorithm>
+#include <thread>
+
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/Option.h"
@@ -31,6 +34,7 @@ namespace storm {
             const std::string CoreSettings::cudaOptionName = "cuda";
             const std::string CoreSettings::intelTbbOptionName = "enable-tbb";
             const std::string CoreSettings::intelTbbOptionShortName = "tbb";
+            const std::string CoreSettings::threadsOptionName = "threads";
             
             CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(CoreSettings::Engine::Sparse) {
                 std::vector<std::string> engines = {"sparse", "hybrid", "dd", "dd-to-sparse", "expl", "abs"};
@@ -56,6 +60,8 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, cudaOptionName, false, "Sets whether to use CUDA.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, intelTbbOptionName, false, "Sets whether to use Intel TBB (if Storm was built with support for TBB).").setShortName(intelTbbOptionShortName).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, threadsOptionName, false, "Sets the number of threads used by multi-threaded algorithms.").setIsAdvanced()
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of threads. If zero, the number of hardware threads is used.").setDefaultValueUnsignedInteger(0).build()).build());
             }
 
             storm::solver::EquationSolverType  CoreSettings::getEquationSolver() const {
@@ -133,6 +139,14 @@ namespace storm {
                 return this->getOption(cudaOptionName).getHasOptionBeenSet();
             }
             
+            uint64_t CoreSettings::getNumberOfThreads() const {
+                uint64_t count = this->getOption(threadsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+                if (count == 0) {
+                    count = std::thread::hardware_concurrency();
+                }
+                return std::max<uint64_t>(count, 1);
+            }
+            
             CoreSettings::Engine CoreSettings::getEngine() const {
                 return engine;
             }
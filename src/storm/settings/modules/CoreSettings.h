@@ -113,6 +113,14 @@ namespace storm {
                  */
                 bool isUseCudaSet() const;
 
+                /*!
+                 * Retrieves the number of threads that multi-threaded algorithms are supposed to use. If the option
+                 * was not set, this is the number of concurrent threads supported by the hardware.
+                 *
+                 * @return The number of threads (at least one).
+                 */
+                uint64_t getNumberOfThreads() const;
+
                 /*!
                  * Retrieves the selected engine.
                  *
@@ -146,6 +154,7 @@ namespace storm {
                 static const std::string intelTbbOptionName;
                 static const std::string intelTbbOptionShortName;
                 static const std::string cudaOptionName;
+                static const std::string threadsOptionName;
             };
 
         } // namespace modules
@@ -18,6 +18,8 @@ namespace storm {
             const std::string ExplorationSettings::numberOfExplorationStepsUntilPrecomputationOptionName = "stepsprecomp";
             const std::string ExplorationSettings::numberOfSampledPathsUntilPrecomputationOptionName = "pathsprecomp";
             const std::string ExplorationSettings::nextStateHeuristicOptionName = "nextstate";
+            const std::string ExplorationSettings::explorationMethodOptionName = "method";
+            const std::string ExplorationSettings::rowCacheSizeOptionName = "rowcache";
             const std::string ExplorationSettings::precisionOptionName = "precision";
             const std::string ExplorationSettings::precisionOptionShortName = "eps";
             
@@ -30,6 +32,10 @@ namespace storm {
                 std::vector<std::string> nextStateHeuristics = { "probdiffs", "prob", "unif" };
                 this->addOption(storm::settings::OptionBuilder(moduleName, nextStateHeuristicOptionName, true, "Sets the next-state heuristic to use.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic to use. 'prob' samples according to the probabilities in the system, 'probdiffs' takes into account probabilities and the differences between the current bounds and 'unif' samples uniformly.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(nextStateHeuristics)).setDefaultValueString("probdiffs").build()).build());
                 
+                std::vector<std::string> explorationMethods = { "sampling", "lazy" };
+                this->addOption(storm::settings::OptionBuilder(moduleName, explorationMethodOptionName, true, "Sets the method used to explore the state space.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the method to use. 'sampling' samples paths and refines bounds along them, 'lazy' performs value iteration on the relevant part of the state space whose transitions are generated on demand. Unlike 'sampling', 'lazy' gives no guaranteed error bound.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationMethods)).setDefaultValueString("sampling").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, rowCacheSizeOptionName, true, "Sets the maximal number of states whose transitions are kept in memory by the lazy exploration method. Evicted transitions are generated again when needed.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states.").setDefaultValueUnsignedInteger(1000000).addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0)).build()).build());
+                
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision to achieve.").setShortName(precisionOptionShortName).setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The value to use to determine convergence.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
             }
@@ -82,6 +88,20 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown next-state heuristic '" << nextStateHeuristicAsString << "'.");
             }
             
+            ExplorationSettings::ExplorationMethod ExplorationSettings::getExplorationMethod() const {
+                std::string explorationMethodAsString = this->getOption(explorationMethodOptionName).getArgumentByName("name").getValueAsString();
+                if (explorationMethodAsString == "sampling") {
+                    return ExplorationSettings::ExplorationMethod::Sampling;
+                } else if (explorationMethodAsString == "lazy") {
+                    return ExplorationSettings::ExplorationMethod::Lazy;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration method '" << explorationMethodAsString << "'.");
+            }
+            
+            uint_fast64_t ExplorationSettings::getRowCacheSize() const {
+                return this->getOption(rowCacheSizeOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
             double ExplorationSettings::getPrecision() const {
                 return this->getOption(precisionOptionName).getArgumentByName("value").getValueAsDouble();
             }
@@ -90,7 +110,9 @@ namespace storm {
                 bool optionsSet = this->getOption(precomputationTypeOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfExplorationStepsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
                                     this->getOption(numberOfSampledPathsUntilPrecomputationOptionName).getHasOptionBeenSet() ||
-                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet();
+                                    this->getOption(nextStateHeuristicOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(explorationMethodOptionName).getHasOptionBeenSet() ||
+                                    this->getOption(rowCacheSizeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::settings::modules::CoreSettings::Engine::Exploration || !optionsSet, "Exploration engine is not selected, so setting options for it has no effect.");
                 return true;
             }
@@ -18,6 +18,9 @@ namespace storm {
                 // The available heuristics to choose the next state.
                 enum class NextStateHeuristic { DifferenceProbabilitySum, Probability, Uniform };
                 
+                // The available methods to explore the state space.
+                enum class ExplorationMethod { Sampling, Lazy };
+                
                 /*!
                  * Creates a new set of exploration settings.
                  */
@@ -72,6 +75,20 @@ namespace storm {
                  */
                 NextStateHeuristic getNextStateHeuristic() const;
                 
+                /*!
+                 * Retrieves the selected exploration method.
+                 *
+                 * @return The selected exploration method.
+                 */
+                ExplorationMethod getExplorationMethod() const;
+                
+                /*!
+                 * Retrieves the maximal number of states whose rows are kept in memory by the lazy exploration method.
+                 *
+                 * @return The maximal number of states whose rows are kept in memory.
+                 */
+                uint_fast64_t getRowCacheSize() const;
+                
                 /*!
                  * Retrieves the precision to use for numerical operations.
                  *
@@ -90,6 +107,8 @@ namespace storm {
                 static const std::string numberOfExplorationStepsUntilPrecomputationOptionName;
                 static const std::string numberOfSampledPathsUntilPrecomputationOptionName;
                 static const std::string nextStateHeuristicOptionName;
+                static const std::string explorationMethodOptionName;
+                static const std::string rowCacheSizeOptionName;
                 static const std::string precisionOptionName;
                 static const std::string precisionOptionShortName;
             };
@@ -14,14 +14,20 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::maximalAnalysisCacheSizeOptionName = "analysiscache";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, maximalAnalysisCacheSizeOptionName, false, "Sets the upper bound of memory (in MB) for graph analysis results (e.g., backward transitions, prob0/prob1 states and end components) that are reused by several properties on the same model.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("size", "The memory available to the cache.").setDefaultValueUnsignedInteger(512).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            uint_fast64_t ModelCheckerSettings::getMaximalAnalysisCacheSize() const {
+                return this->getOption(maximalAnalysisCacheSizeOptionName).getArgumentByName("size").getValueAsUnsignedInteger();
+            }
             
         } // namespace modules
     } // namespace settings
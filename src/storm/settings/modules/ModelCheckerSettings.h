@@ -22,12 +22,18 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves the maximal size (in MB) of the graph analysis results that are cached per model.
+                 */
+                uint_fast64_t getMaximalAnalysisCacheSize() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string maximalAnalysisCacheSizeOptionName;
             };
 
         } // namespace modules
@@ -13,18 +13,28 @@ namespace storm {
             
             const std::string MultiplierSettings::moduleName = "multiplier";
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
+            const std::string MultiplierSettings::splitStorageOptionName = "splitstorage";
+            const std::string MultiplierSettings::mixedPrecisionOptionName = "mixedprecision";
+            const std::string MultiplierSettings::mixedPrecisionRefinementOptionName = "mixedprecision-refine";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+                std::vector<std::string> multiplierTypes = {"native", "native-parallel", "native-simd", "gmmxx"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, splitStorageOptionName, false, "If set, the native multiplier stores column indices (with 32 bits if possible) and values of the matrix in separate arrays.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "If set, the native multiplier stores the matrix entries with single precision (while vectors keep double precision). Iterative solvers then give no guarantees on the direction from which the solution is approached.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionRefinementOptionName, false, "If set, iterations with single precision matrix entries are followed by iterations with double precision until convergence.").setIsAdvanced().build());
             }
             
             storm::solver::MultiplierType MultiplierSettings::getMultiplierType() const {
                 std::string type = this->getOption(multiplierTypeOptionName).getArgumentByName("name").getValueAsString();
                 if (type == "native") {
                     return storm::solver::MultiplierType::Native;
+                } else if (type == "native-parallel") {
+                    return storm::solver::MultiplierType::NativeParallel;
+                } else if (type == "native-simd") {
+                    return storm::solver::MultiplierType::NativeSimd;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
                 }
@@ -35,6 +45,18 @@ namespace storm {
             bool MultiplierSettings::isMultiplierTypeSetFromDefaultValue() const {
                 return !this->getOption(multiplierTypeOptionName).getArgumentByName("name").getHasBeenSet() || this->getOption(multiplierTypeOptionName).getArgumentByName("name").wasSetFromDefaultValue();
             }
+            
+            bool MultiplierSettings::isSplitStorageSet() const {
+                return this->getOption(splitStorageOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MultiplierSettings::isMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+            
+            bool MultiplierSettings::isMixedPrecisionRefinementSet() const {
+                return this->getOption(mixedPrecisionRefinementOptionName).getHasOptionBeenSet();
+            }
         }
     }
 }
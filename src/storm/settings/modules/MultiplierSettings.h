@@ -22,11 +22,31 @@ namespace storm {
                 
                 bool isMultiplierTypeSetFromDefaultValue() const;
                 
+                /*!
+                 * Retrieves whether the native multiplier is supposed to use a copy of the matrix that stores column
+                 * indices and values in separate arrays.
+                 */
+                bool isSplitStorageSet() const;
+                
+                /*!
+                 * Retrieves whether the native multiplier is supposed to store the matrix entries with single precision.
+                 */
+                bool isMixedPrecisionSet() const;
+                
+                /*!
+                 * Retrieves whether iterations with single precision matrix entries are to be followed by iterations
+                 * with full precision.
+                 */
+                bool isMixedPrecisionRefinementSet() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
             private:
                 static const std::string multiplierTypeOptionName;
+                static const std::string splitStorageOptionName;
+                static const std::string mixedPrecisionOptionName;
+                static const std::string mixedPrecisionRefinementOptionName;
             };
             
         }
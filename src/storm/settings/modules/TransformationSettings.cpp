@@ -16,6 +16,7 @@ namespace storm {
             const std::string TransformationSettings::labelBehaviorOptionName = "ec-label-behavior";
             const std::string TransformationSettings::toNondetOptionName = "to-nondet";
             const std::string TransformationSettings::toDiscreteTimeOptionName = "to-discrete";
+            const std::string TransformationSettings::stateReorderingOptionName = "reorder-states";
 
 
             TransformationSettings::TransformationSettings() : ModuleSettings(moduleName) {
@@ -32,6 +33,10 @@ namespace storm {
                                 "keep").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(labelBehavior)).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, toNondetOptionName, false, "If set, DTMCs/CTMCs are converted to MDPs/MAs (without actual nondeterminism) before model checking.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, toDiscreteTimeOptionName, false, "If set, CTMCs/MAs are converted to DTMCs/MDPs (which might or might not preserve the provided properties).").setIsAdvanced().build());
+                std::vector<std::string> reorderingMethods = {"bfs", "rcm"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, stateReorderingOptionName, false, "If set, the states of sparse models are renumbered before model checking to improve the memory locality of the transition matrix.").setIsAdvanced().addArgument(
+                        storm::settings::ArgumentBuilder::createStringArgument("method", "The method used to compute the new order. 'bfs' orders the states by a breadth-first search from the initial states, 'rcm' uses the reverse Cuthill-McKee order.").setDefaultValueString(
+                                "rcm").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(reorderingMethods)).build()).build());
             }
 
             bool TransformationSettings::isChainEliminationSet() const {
@@ -59,6 +64,20 @@ namespace storm {
                 return this->getOption(toDiscreteTimeOptionName).getHasOptionBeenSet();
             }
 
+            bool TransformationSettings::isStateReorderingSet() const {
+                return this->getOption(stateReorderingOptionName).getHasOptionBeenSet();
+            }
+
+            storm::transformer::StateReorderingMethod TransformationSettings::getStateReorderingMethod() const {
+                std::string methodAsString = this->getOption(stateReorderingOptionName).getArgumentByName("method").getValueAsString();
+                if (methodAsString == "bfs") {
+                    return storm::transformer::StateReorderingMethod::Bfs;
+                } else if (methodAsString == "rcm") {
+                    return storm::transformer::StateReorderingMethod::ReverseCuthillMcKee;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Illegal value '" << methodAsString << "' set as state reordering method.");
+            }
+
             bool TransformationSettings::check() const {
                 // Ensure that labeling preservation is only set if chain elimination is set
                 STORM_LOG_THROW(isChainEliminationSet() || !this->getOption(labelBehaviorOptionName).getHasOptionBeenSet(),
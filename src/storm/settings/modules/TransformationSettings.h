@@ -45,6 +45,16 @@ namespace storm {
                  */
                 bool isToDiscreteTimeModelSet() const;
 
+                /*!
+                 * Retrieves whether the states of the model are to be renumbered before model checking.
+                 */
+                bool isStateReorderingSet() const;
+
+                /*!
+                 * Retrieves the method used to renumber the states of the model.
+                 */
+                storm::transformer::StateReorderingMethod getStateReorderingMethod() const;
+
                 bool check() const override;
 
                 void finalize() override;
@@ -58,6 +68,7 @@ namespace storm {
                 static const std::string labelBehaviorOptionName;
                 static const std::string toNondetOptionName;
                 static const std::string toDiscreteTimeOptionName;
+                static const std::string stateReorderingOptionName;
 
             };
 
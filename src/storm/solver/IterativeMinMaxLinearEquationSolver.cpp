@@ -6,6 +6,7 @@
 #include "storm/utility/ConstantsComparator.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
@@ -63,8 +64,17 @@ namespace storm {
         
         template<typename ValueType>
         bool IterativeMinMaxLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            MinMaxMethod method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+            if (env.solver().multiplier().isMixedPrecisionSet() && (method == MinMaxMethod::IntervalIteration || method == MinMaxMethod::SoundValueIteration || method == MinMaxMethod::RationalSearch)) {
+                // Sound methods rely on the iterates approaching the solution from one side, which single precision matrix entries can not ensure.
+                STORM_LOG_WARN("Single precision matrix entries are not supported by the selected method. Using full precision.");
+                storm::Environment fullPrecisionEnvironment = env;
+                fullPrecisionEnvironment.solver().multiplier().setMixedPrecision(false);
+                return internalSolveEquations(fullPrecisionEnvironment, dir, x, b);
+            }
+            
             bool result = false;
-            switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
+            switch (method) {
                 case MinMaxMethod::ValueIteration:
                     result = solveEquationsValueIteration(env, dir, x, b);
                     break;
@@ -386,12 +396,39 @@ namespace storm {
                     guarantee = SolverGuarantee::GreaterOrEqual;
                 }
             }
+            
+            // With single precision matrix entries, the iterates may overshoot the solution, so they can not be used if a guarantee is required.
+            bool mixedPrecision = env.solver().multiplier().isMixedPrecisionSet();
+            if (mixedPrecision && !this->multiplierA->supportsMixedPrecision()) {
+                STORM_LOG_WARN("Single precision matrix entries are only supported by the native multiplier. Using full precision.");
+                mixedPrecision = false;
+            } else if (mixedPrecision && guarantee != SolverGuarantee::None && this->hasCustomTerminationCondition() && this->getTerminationCondition().requiresGuarantee(guarantee)) {
+                STORM_LOG_WARN("Single precision matrix entries can not provide the guarantee required by the termination condition. Using full precision.");
+                mixedPrecision = false;
+            }
+            if (mixedPrecision) {
+                // The single precision iterates (and thus also the starting point of a refinement) may lie on either side of the solution.
+                guarantee = SolverGuarantee::None;
+            }
+            std::unique_ptr<storm::Environment> fullPrecisionEnvironmentStorage;
+            if (env.solver().multiplier().isMixedPrecisionSet()) {
+                fullPrecisionEnvironmentStorage = std::make_unique<storm::Environment>(env);
+                fullPrecisionEnvironmentStorage->solver().multiplier().setMixedPrecision(false);
+            }
+            storm::Environment const& fullPrecisionEnvironment = fullPrecisionEnvironmentStorage ? *fullPrecisionEnvironmentStorage : env;
 
             std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
             std::vector<ValueType>* currentX = &x;
             
             this->startMeasureProgress();
-            ValueIterationResult result = performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            ValueIterationResult result = performValueIteration(mixedPrecision ? env : fullPrecisionEnvironment, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+            
+            if (mixedPrecision && env.solver().multiplier().isMixedPrecisionRefinementSet() && result.status == SolverStatus::Converged) {
+                // Continue with full precision matrix entries, starting from the result of the single precision iterations.
+                ValueIterationResult refinementResult = performValueIteration(fullPrecisionEnvironment, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()), env.solver().minMax().getRelativeTerminationCriterion(), guarantee, result.iterations, env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle());
+                STORM_LOG_INFO("Refined the single precision result with " << refinementResult.iterations << " full precision iterations.");
+                result = ValueIterationResult(result.iterations + refinementResult.iterations, refinementResult.status);
+            }
 
             // Swap the result into the output x.
             if (currentX == auxiliaryRowGroupVector.get()) {
@@ -403,7 +440,7 @@ namespace storm {
             // If requested, we store the scheduler for retrieval.
             if (this->isTrackSchedulerSet()) {
                 this->schedulerChoices = std::vector<uint_fast64_t>(this->A->getRowGroupCount());
-                this->multiplierA->multiplyAndReduce(env, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
+                this->multiplierA->multiplyAndReduce(fullPrecisionEnvironment, dir, x, &b, *auxiliaryRowGroupVector.get(), &this->schedulerChoices.get());
             }
             
             if (!this->isCachingEnabled()) {
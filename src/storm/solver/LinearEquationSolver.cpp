@@ -30,6 +30,36 @@ namespace storm {
             return this->internalSolveEquations(env, x, b);
         }
         
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::solveEquationsBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_ASSERT(x.size() == this->getMatrixRowCount() * batchSize, "Solution block has unexpected size.");
+            STORM_LOG_ASSERT(b.size() == this->getMatrixRowCount() * batchSize, "Right-hand side block has unexpected size.");
+            if (batchSize == 1) {
+                return this->internalSolveEquations(env, x, b);
+            }
+            return this->internalSolveEquationsBatch(env, batchSize, x, b);
+        }
+        
+        template<typename ValueType>
+        bool LinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            // Solve the systems one after another.
+            uint64_t numberOfRows = this->getMatrixRowCount();
+            std::vector<ValueType> singleX(numberOfRows);
+            std::vector<ValueType> singleB(numberOfRows);
+            bool result = true;
+            for (uint64_t k = 0; k < batchSize; ++k) {
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    singleX[row] = x[row * batchSize + k];
+                    singleB[row] = b[row * batchSize + k];
+                }
+                result &= this->internalSolveEquations(env, singleX, singleB);
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    x[row * batchSize + k] = singleX[row];
+                }
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         LinearEquationSolverRequirements LinearEquationSolver<ValueType>::getRequirements(Environment const&) const {
             return LinearEquationSolverRequirements();
@@ -48,6 +48,21 @@ namespace storm {
              */
             bool solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
+            /*!
+             * Solves several equation systems that only differ in their right-hand sides. The vectors are stored in a
+             * row-major block, i.e., the entry of the k-th system that belongs to row r is stored at index
+             * r * batchSize + k. Solvers that support it solve all systems in one pass, all others solve them one by
+             * one.
+             *
+             * @param batchSize The number of equation systems.
+             * @param x The block of solution vectors that has to be computed. Its length must be equal to the number of
+             * rows of A times the batch size.
+             * @param b The block of right-hand sides. Its length must be equal to the number of rows of A times the batch size.
+             *
+             * @return true iff all systems were solved.
+             */
+            bool solveEquationsBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
             /*!
              * Retrieves the format in which this solver expects to solve equations. If the solver expects the equation
              * system format, it solves Ax = b. If it it expects a fixed point format, it solves Ax + b = x.
@@ -78,6 +93,7 @@ namespace storm {
             
         protected:
             virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const = 0;
+            virtual bool internalSolveEquationsBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
                         
             // auxiliary storage. If set, this vector has getMatrixRowCount() entries.
             mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector;
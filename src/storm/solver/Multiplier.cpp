@@ -10,6 +10,8 @@
 #include "storm/utility/macros.h"
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/NativeMultiplier.h"
+#include "storm/solver/NativeParallelMultiplier.h"
+#include "storm/solver/NativeSimdMultiplier.h"
 #include "storm/solver/GmmxxMultiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/exceptions/IllegalArgumentException.h"
@@ -27,6 +29,35 @@ namespace storm {
             cachedVector.reset();
         }
         
+        template<typename ValueType>
+        bool Multiplier<ValueType>::supportsMixedPrecision() const {
+            return false;
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyBatch(Environment const&, uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            
+            this->matrix.multiplyWithVectorBatch(batchSize, x, *target, b);
+            
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+        
+        template<typename ValueType>
+        void Multiplier<ValueType>::multiplyBatchGaussSeidel(Environment const&, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            this->matrix.multiplyWithVectorBatchBackward(batchSize, x, b);
+        }
+        
         template<typename ValueType>
         void Multiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             multiplyAndReduce(env, dir, this->matrix.getRowGroupIndices(), x, b, result, choices);
@@ -79,6 +110,10 @@ namespace storm {
                     return std::make_unique<GmmxxMultiplier<ValueType>>(matrix);
                 case MultiplierType::Native:
                     return std::make_unique<NativeMultiplier<ValueType>>(matrix);
+                case MultiplierType::NativeParallel:
+                    return std::make_unique<NativeParallelMultiplier<ValueType>>(matrix);
+                case MultiplierType::NativeSimd:
+                    return std::make_unique<NativeSimdMultiplier<ValueType>>(matrix);
             }
             STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentException, "Unknown MultiplierType");
         }
@@ -30,6 +30,11 @@ namespace storm {
              */
             virtual void clearCache() const;
             
+            /*!
+             * Retrieves whether this multiplier can perform the multiplications with single precision matrix entries.
+             */
+            virtual bool supportsMixedPrecision() const;
+            
             /*!
              * Performs a matrix-vector multiplication x' = A*x + b.
              *
@@ -52,6 +57,33 @@ namespace storm {
              */
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const = 0;
             
+            /*!
+             * Performs the matrix-vector multiplication x' = A*x + b for several vectors at once. The vectors are
+             * stored in a row-major block, i.e., the entry of the k-th vector that belongs to column c is stored at
+             * index c * batchSize + k.
+             *
+             * @param batchSize The number of vectors in the block.
+             * @param x The input block with which to multiply the matrix. Its length must be equal to the number of
+             * columns of A times the batch size.
+             * @param b If non-null, this block is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A times the batch size.
+             * @param result The target block into which to write the multiplication result. Its length must be equal
+             * to the number of rows of A times the batch size. Can be the same as the x block.
+             */
+            virtual void multiplyBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
+            
+            /*!
+             * Performs the matrix-vector multiplication for several vectors at once in gauss-seidel style. The block
+             * layout is the same as for multiplyBatch.
+             *
+             * @param batchSize The number of vectors in the block.
+             * @param x The input/output block with which to multiply the matrix. Its length must be equal to the number
+             * of columns of A times the batch size.
+             * @param b If non-null, this block is added after the multiplication. If given, its length must be equal
+             * to the number of rows of A times the batch size.
+             */
+            virtual void multiplyBatchGaussSeidel(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const* b) const;
+            
             /*!
              * Performs a matrix-vector multiplication x' = A*x + b and then minimizes/maximizes over the row groups
              * so that the resulting vector has the size of number of row groups of A.
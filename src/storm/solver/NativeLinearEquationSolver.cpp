@@ -3,6 +3,7 @@
 #include <limits>
 
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
@@ -356,12 +357,39 @@ namespace storm {
                     guarantee = SolverGuarantee::GreaterOrEqual;
                 }
             }
+            
+            // With single precision matrix entries, the iterates may overshoot the solution, so they can not be used if a guarantee is required.
+            bool mixedPrecision = env.solver().multiplier().isMixedPrecisionSet();
+            if (mixedPrecision && !this->multiplier->supportsMixedPrecision()) {
+                STORM_LOG_WARN("Single precision matrix entries are only supported by the native multiplier. Using full precision.");
+                mixedPrecision = false;
+            } else if (mixedPrecision && guarantee != SolverGuarantee::None && this->hasCustomTerminationCondition() && this->getTerminationCondition().requiresGuarantee(guarantee)) {
+                STORM_LOG_WARN("Single precision matrix entries can not provide the guarantee required by the termination condition. Using full precision.");
+                mixedPrecision = false;
+            }
+            if (mixedPrecision) {
+                // The single precision iterates (and thus also the starting point of a refinement) may lie on either side of the solution.
+                guarantee = SolverGuarantee::None;
+            }
+            std::unique_ptr<storm::Environment> fullPrecisionEnvironmentStorage;
+            if (env.solver().multiplier().isMixedPrecisionSet()) {
+                fullPrecisionEnvironmentStorage = std::make_unique<storm::Environment>(env);
+                fullPrecisionEnvironmentStorage->solver().multiplier().setMixedPrecision(false);
+            }
+            storm::Environment const& fullPrecisionEnvironment = fullPrecisionEnvironmentStorage ? *fullPrecisionEnvironmentStorage : env;
             std::vector<ValueType>* newX = this->cachedRowVector.get();
             
             // Forward call to power iteration implementation.
             this->startMeasureProgress();
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+            PowerIterationResult result = this->performPowerIteration(mixedPrecision ? env : fullPrecisionEnvironment, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+            
+            if (mixedPrecision && env.solver().multiplier().isMixedPrecisionRefinementSet() && result.status == SolverStatus::Converged) {
+                // Continue with full precision matrix entries, starting from the result of the single precision iterations.
+                PowerIterationResult refinementResult = this->performPowerIteration(fullPrecisionEnvironment, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, result.iterations, env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+                STORM_LOG_INFO("Refined the single precision result with " << refinementResult.iterations << " full precision iterations.");
+                result = PowerIterationResult(result.iterations + refinementResult.iterations, refinementResult.status);
+            }
 
             // Swap the result in place.
             if (currentX == this->cachedRowVector.get()) {
@@ -377,6 +405,68 @@ namespace storm {
             return result.status == SolverStatus::Converged || result.status == SolverStatus::TerminatedEarly;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsPowerBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            STORM_LOG_INFO("Solving " << batchSize << " linear equation systems (" << getMatrixRowCount() << " rows) with NativeLinearEquationSolver (Power)");
+            
+            if (!this->multiplier) {
+                this->multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *A);
+            }
+            
+            bool useGaussSeidelMultiplication = env.solver().native().getPowerMethodMultiplicationStyle() == storm::solver::MultiplicationStyle::GaussSeidel;
+            std::vector<ValueType> tmpX(x.size());
+            std::vector<ValueType>* currentX = &x;
+            std::vector<ValueType>* newX = &tmpX;
+            
+            this->startMeasureProgress();
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+            bool relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t maxIterations = env.solver().native().getMaximalNumberOfIterations();
+            bool converged = false;
+            uint64_t iterations = 0;
+            while (!converged && iterations < maxIterations) {
+                if (useGaussSeidelMultiplication) {
+                    *newX = *currentX;
+                    this->multiplier->multiplyBatchGaussSeidel(env, batchSize, *newX, &b);
+                } else {
+                    this->multiplier->multiplyBatch(env, batchSize, *currentX, &b, *newX);
+                }
+                
+                // All systems are required to converge. If only some values are relevant, we only check the entries of these rows.
+                if (this->hasRelevantValues()) {
+                    converged = true;
+                    for (auto row : this->getRelevantValues()) {
+                        for (uint64_t index = row * batchSize, end = index + batchSize; converged && index < end; ++index) {
+                            converged = storm::utility::vector::equalModuloPrecision<ValueType>((*currentX)[index], (*newX)[index], precision, relative);
+                        }
+                        if (!converged) {
+                            break;
+                        }
+                    }
+                } else {
+                    converged = storm::utility::vector::equalModuloPrecision<ValueType>(*currentX, *newX, precision, relative);
+                }
+                std::swap(currentX, newX);
+                ++iterations;
+                
+                // Potentially show progress.
+                this->showProgressIterative(iterations);
+            }
+            
+            // Swap the result in place.
+            if (currentX == &tmpX) {
+                std::swap(x, tmpX);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            
+            this->logIterations(converged, false, iterations);
+            
+            return converged;
+        }
+        
         template<typename ValueType>
         void preserveOldRelevantValues(std::vector<ValueType> const& allValues, storm::storage::BitVector const& relevantValues, std::vector<ValueType>& oldValues) {
             storm::utility::vector::selectVectorValues(oldValues, relevantValues, allValues);
@@ -922,7 +1012,16 @@ namespace storm {
         
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-            switch(getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
+            NativeLinearEquationSolverMethod method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+            if (env.solver().multiplier().isMixedPrecisionSet() && (method == NativeLinearEquationSolverMethod::SoundValueIteration || method == NativeLinearEquationSolverMethod::IntervalIteration || method == NativeLinearEquationSolverMethod::RationalSearch)) {
+                // Sound methods rely on the iterates approaching the solution from one side, which single precision matrix entries can not ensure.
+                STORM_LOG_WARN("Single precision matrix entries are not supported by the selected method. Using full precision.");
+                storm::Environment fullPrecisionEnvironment = env;
+                fullPrecisionEnvironment.solver().multiplier().setMixedPrecision(false);
+                return internalSolveEquations(fullPrecisionEnvironment, x, b);
+            }
+            
+            switch(method) {
                 case NativeLinearEquationSolverMethod::SOR:
                     return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
                 case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -944,6 +1043,17 @@ namespace storm {
             return false;
         }
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::internalSolveEquationsBatch(Environment const& env, uint64_t batchSize, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            // Custom termination conditions (and the solver guarantees they require) refer to a single solution vector and
+            // single precision matrix entries are not supported by the batch multiplication, so we only solve the systems
+            // simultaneously in the remaining cases. As for a single system, the power method then gives no guarantee.
+            if (getMethod(env, storm::NumberTraits<ValueType>::IsExact) == NativeLinearEquationSolverMethod::Power && !this->hasCustomTerminationCondition() && !env.solver().multiplier().isMixedPrecisionSet()) {
+                return this->solveEquationsPowerBatch(env, batchSize, x, b);
+            }
+            return LinearEquationSolver<ValueType>::internalSolveEquationsBatch(env, batchSize, x, b);
+        }
+        
         template<typename ValueType>
         LinearEquationSolverProblemFormat NativeLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const& env) const {
             auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
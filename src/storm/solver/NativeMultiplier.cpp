@@ -1,5 +1,7 @@
 #include "storm/solver/NativeMultiplier.h"
 
+#include <type_traits>
+
 #include "storm-config.h"
 
 #include "storm/environment/solver/MultiplierEnvironment.h"
@@ -13,10 +15,23 @@
 #include "storm/adapters/IntelTbbAdapter.h"
 
 #include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace solver {
         
+        namespace detail {
+            template<typename ValueType>
+            std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType, float>> createMixedPrecisionMatrix(storm::storage::SparseMatrix<ValueType> const&) {
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Single precision matrix entries are only supported for double values.");
+            }
+            
+            template<>
+            std::unique_ptr<storm::storage::SplitSparseMatrix<double, float>> createMixedPrecisionMatrix(storm::storage::SparseMatrix<double> const& matrix) {
+                return std::make_unique<storm::storage::SplitSparseMatrix<double, float>>(matrix);
+            }
+        }
+        
         template<typename ValueType>
         NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix) {
             // Intentionally left empty.
@@ -31,6 +46,40 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType>
+        void NativeMultiplier<ValueType>::clearCache() const {
+            splitMatrix.reset();
+            mixedPrecisionMatrix.reset();
+            Multiplier<ValueType>::clearCache();
+        }
+        
+        template<typename ValueType>
+        bool NativeMultiplier<ValueType>::supportsMixedPrecision() const {
+            return std::is_same<ValueType, double>::value;
+        }
+        
+        template<typename ValueType>
+        storm::storage::SplitSparseMatrix<ValueType> const* NativeMultiplier<ValueType>::getSplitMatrix(Environment const& env) const {
+            if (!env.solver().multiplier().isSplitStorageSet()) {
+                return nullptr;
+            }
+            if (!splitMatrix) {
+                splitMatrix = std::make_unique<storm::storage::SplitSparseMatrix<ValueType>>(this->matrix);
+            }
+            return splitMatrix.get();
+        }
+        
+        template<typename ValueType>
+        storm::storage::SplitSparseMatrix<ValueType, float> const* NativeMultiplier<ValueType>::getMixedPrecisionMatrix(Environment const& env) const {
+            if (!env.solver().multiplier().isMixedPrecisionSet()) {
+                return nullptr;
+            }
+            if (!mixedPrecisionMatrix) {
+                mixedPrecisionMatrix = detail::createMixedPrecisionMatrix(this->matrix);
+            }
+            return mixedPrecisionMatrix.get();
+        }
+        
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
             std::vector<ValueType>* target = &result;
@@ -42,8 +91,12 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
-            if (parallelize(env)) {
+            if (auto mixed = getMixedPrecisionMatrix(env)) {
+                mixed->multiplyWithVector(x, *target, b);
+            } else if (parallelize(env)) {
                 multAddParallel(x, b, *target);
+            } else if (auto split = getSplitMatrix(env)) {
+                split->multiplyWithVector(x, *target, b);
             } else {
                 multAdd(x, b, *target);
             }
@@ -54,7 +107,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
-            this->matrix.multiplyWithVectorBackward(x, x, b);
+            if (auto mixed = getMixedPrecisionMatrix(env)) {
+                mixed->multiplyWithVectorBackward(x, x, b);
+            } else if (auto split = getSplitMatrix(env)) {
+                split->multiplyWithVectorBackward(x, x, b);
+            } else {
+                this->matrix.multiplyWithVectorBackward(x, x, b);
+            }
         }
         
         template<typename ValueType>
@@ -68,8 +127,12 @@ namespace storm {
                 }
                 target = this->cachedVector.get();
             }
-            if (parallelize(env)) {
+            if (auto mixed = getMixedPrecisionMatrix(env)) {
+                mixed->multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (parallelize(env)) {
                 multAddReduceParallel(dir, rowGroupIndices, x, b, *target, choices);
+            } else if (auto split = getSplitMatrix(env)) {
+                split->multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices);
             } else {
                 multAddReduce(dir, rowGroupIndices, x, b, *target, choices);
             }
@@ -80,7 +143,13 @@ namespace storm {
         
         template<typename ValueType>
         void NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
-            this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            if (auto mixed = getMixedPrecisionMatrix(env)) {
+                mixed->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else if (auto split = getSplitMatrix(env)) {
+                split->multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            } else {
+                this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices);
+            }
         }
         
         template<typename ValueType>
@@ -3,6 +3,7 @@
 #include "storm/solver/Multiplier.h"
 
 #include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/SplitSparseMatrix.h"
 
 namespace storm {
     namespace storage {
@@ -18,6 +19,9 @@ namespace storm {
             NativeMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
             virtual ~NativeMultiplier() = default;
             
+            virtual void clearCache() const override;
+            virtual bool supportsMixedPrecision() const override;
+            
             virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
             virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
             virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
@@ -28,6 +32,18 @@ namespace storm {
         private:
             bool parallelize(Environment const& env) const;
             
+            /*!
+             * Retrieves the split copy of the matrix if the environment requests the split storage and nullptr otherwise.
+             * The copy is created upon the first request.
+             */
+            storm::storage::SplitSparseMatrix<ValueType> const* getSplitMatrix(Environment const& env) const;
+            
+            /*!
+             * Retrieves a copy of the matrix with single precision entries if the environment requests mixed precision
+             * and nullptr otherwise. The copy is created upon the first request.
+             */
+            storm::storage::SplitSparseMatrix<ValueType, float> const* getMixedPrecisionMatrix(Environment const& env) const;
+            
             void multAdd(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             
             void multAddReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
@@ -35,6 +51,11 @@ namespace storm {
             void multAddParallel(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const;
             void multAddReduceParallel(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint64_t>* choices = nullptr) const;
             
+            // A copy of the matrix with separate column and value arrays (if requested).
+            mutable std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType>> splitMatrix;
+            
+            // A copy of the matrix with single precision entries (if requested).
+            mutable std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType, float>> mixedPrecisionMatrix;
         };
         
     }
@@ -0,0 +1,204 @@
+#include "storm/solver/NativeParallelMultiplier.h"
+
+#include <algorithm>
+
+#include "storm-config.h"
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        namespace detail {
+            // The minimal number of matrix entries for which it pays off to start an additional thread.
+            static const uint64_t minimalNumberOfEntriesPerThread = 10000;
+
+            template<typename ValueType>
+            bool supportsConcurrentArithmetic() {
+                return true;
+            }
+
+#ifdef STORM_HAVE_CARL
+            template<>
+            bool supportsConcurrentArithmetic<storm::RationalFunction>() {
+                // Operations on rational functions modify shared caches.
+                return false;
+            }
+#endif
+        }
+
+        template<typename ValueType>
+        NativeParallelMultiplier<ValueType>::NativeParallelMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : NativeMultiplier<ValueType>(matrix) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void NativeParallelMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            uint64_t numberOfThreads = getNumberOfThreads(env);
+            if (numberOfThreads <= 1) {
+                NativeMultiplier<ValueType>::multiply(env, x, b, result);
+                return;
+            }
+
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+
+            std::vector<uint64_t> blocks = computeBlocks(nullptr, numberOfThreads);
+            getThreadPool(numberOfThreads).execute([&] (uint64_t threadIndex) {
+                this->matrix.multiplyWithVectorRange(blocks[threadIndex], blocks[threadIndex + 1], x, *target, b);
+            });
+
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void NativeParallelMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const {
+            uint64_t numberOfThreads = getNumberOfThreads(env);
+            if (numberOfThreads <= 1) {
+                NativeMultiplier<ValueType>::multiplyGaussSeidel(env, x, b);
+                return;
+            }
+            
+            std::vector<uint64_t> blocks = computeBlocks(nullptr, numberOfThreads);
+            storm::utility::ThreadPool& pool = getThreadPool(numberOfThreads);
+            std::vector<ValueType> const& snapshot = createSnapshot(pool, blocks, x);
+            pool.execute([&] (uint64_t threadIndex) {
+                this->matrix.multiplyWithVectorBackwardBlock(blocks[threadIndex], blocks[threadIndex + 1], x, snapshot, b);
+            });
+        }
+        
+        template<typename ValueType>
+        void NativeParallelMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            uint64_t numberOfThreads = getNumberOfThreads(env);
+            if (numberOfThreads <= 1) {
+                NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+                return;
+            }
+
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+
+            std::vector<uint64_t> blocks = computeBlocks(&rowGroupIndices, numberOfThreads);
+            getThreadPool(numberOfThreads).execute([&] (uint64_t threadIndex) {
+                this->matrix.multiplyAndReduceRange(dir, rowGroupIndices, blocks[threadIndex], blocks[threadIndex + 1], x, b, *target, choices);
+            });
+
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void NativeParallelMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices) const {
+            uint64_t numberOfThreads = getNumberOfThreads(env);
+            if (numberOfThreads <= 1) {
+                NativeMultiplier<ValueType>::multiplyAndReduceGaussSeidel(env, dir, rowGroupIndices, x, b, choices);
+                return;
+            }
+            
+            std::vector<uint64_t> blocks = computeBlocks(&rowGroupIndices, numberOfThreads);
+            storm::utility::ThreadPool& pool = getThreadPool(numberOfThreads);
+            std::vector<ValueType> const& snapshot = createSnapshot(pool, blocks, x);
+            pool.execute([&] (uint64_t threadIndex) {
+                this->matrix.multiplyAndReduceBackwardBlock(dir, rowGroupIndices, blocks[threadIndex], blocks[threadIndex + 1], x, snapshot, b, choices);
+            });
+        }
+        
+        template<typename ValueType>
+        uint64_t NativeParallelMultiplier<ValueType>::getNumberOfThreads(Environment const& env) const {
+            if (!detail::supportsConcurrentArithmetic<ValueType>() || env.solver().multiplier().isMixedPrecisionSet()) {
+                // Single precision matrix entries are only supported by the sequential kernels.
+                return 1;
+            }
+            uint64_t maximalNumberOfThreads = this->matrix.getEntryCount() / detail::minimalNumberOfEntriesPerThread + 1;
+            return std::min<uint64_t>(env.solver().multiplier().getNumberOfThreads(), maximalNumberOfThreads);
+        }
+
+        template<typename ValueType>
+        storm::utility::ThreadPool& NativeParallelMultiplier<ValueType>::getThreadPool(uint64_t numberOfThreads) const {
+            if (!threadPool || threadPool->getNumberOfThreads() != numberOfThreads) {
+                threadPool.reset();
+                threadPool = std::make_unique<storm::utility::ThreadPool>(numberOfThreads);
+            }
+            return *threadPool;
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> NativeParallelMultiplier<ValueType>::computeBlocks(std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfBlocks) const {
+            uint64_t numberOfGroups = rowGroupIndices ? rowGroupIndices->size() - 1 : this->matrix.getRowCount();
+
+            // The cost of all row groups before the given one. Rows are taken into account as well, because empty rows
+            // still need to be processed.
+            auto costBefore = [&] (uint64_t group) {
+                uint64_t row = rowGroupIndices ? (*rowGroupIndices)[group] : group;
+                return static_cast<uint64_t>(this->matrix.begin(row) - this->matrix.begin()) + row;
+            };
+            uint64_t totalCost = costBefore(numberOfGroups);
+
+            std::vector<uint64_t> blocks;
+            blocks.reserve(numberOfBlocks + 1);
+            blocks.push_back(0);
+            for (uint64_t block = 1; block < numberOfBlocks; ++block) {
+                // Find the first group whose preceding cost reaches the share of the current block.
+                uint64_t targetCost = totalCost * block / numberOfBlocks;
+                uint64_t low = blocks.back();
+                uint64_t high = numberOfGroups;
+                while (low < high) {
+                    uint64_t middle = low + (high - low) / 2;
+                    if (costBefore(middle) < targetCost) {
+                        low = middle + 1;
+                    } else {
+                        high = middle;
+                    }
+                }
+                blocks.push_back(low);
+            }
+            blocks.push_back(numberOfGroups);
+            return blocks;
+        }
+
+        template<typename ValueType>
+        std::vector<ValueType> const& NativeParallelMultiplier<ValueType>::createSnapshot(storm::utility::ThreadPool& pool, std::vector<uint64_t> const& blocks, std::vector<ValueType> const& x) const {
+            if (this->cachedVector) {
+                this->cachedVector->resize(x.size());
+            } else {
+                this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+            }
+            std::vector<ValueType>& snapshot = *this->cachedVector;
+            pool.execute([&] (uint64_t threadIndex) {
+                std::copy(x.begin() + blocks[threadIndex], x.begin() + blocks[threadIndex + 1], snapshot.begin() + blocks[threadIndex]);
+            });
+            return snapshot;
+        }
+        
+        template class NativeParallelMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class NativeParallelMultiplier<storm::RationalNumber>;
+        template class NativeParallelMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
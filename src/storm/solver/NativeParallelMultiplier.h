@@ -0,0 +1,68 @@
+#pragma once
+
+#include "storm/solver/NativeMultiplier.h"
+
+#include "storm/utility/ThreadPool.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A multi-threaded version of the native multiplier that does not depend on external libraries. The row groups
+         * of the matrix are split into contiguous blocks (one per thread) such that each block has roughly the same
+         * number of entries.
+         *
+         * Gauss-Seidel style multiplications are performed block-wise: Within a block, the most recent values are used
+         * while the values of other blocks are taken from the beginning of the multiplication (i.e., blocks are
+         * combined in a Jacobi-like fashion). As the result is still obtained by applying a monotone operator, this
+         * is compatible with value iteration and interval iteration. The result does not depend on the thread
+         * scheduling, but it may differ from the one of a sequential Gauss-Seidel multiplication.
+         */
+        template<typename ValueType>
+        class NativeParallelMultiplier : public NativeMultiplier<ValueType> {
+        public:
+            NativeParallelMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            virtual ~NativeParallelMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr) const override;
+
+        protected:
+            /*!
+             * Retrieves the number of threads to use for multiplications with the matrix. This is bounded by the
+             * number of threads set in the environment and by the size of the matrix (as small matrices do not pay off
+             * the synchronization overhead). If single precision matrix entries are requested, the sequential
+             * kernels of the native multiplier are used.
+             */
+            uint64_t getNumberOfThreads(Environment const& env) const;
+
+            /*!
+             * Retrieves a thread pool with the given number of threads. The pool is created upon the first request
+             * (or whenever the number of threads changes).
+             */
+            storm::utility::ThreadPool& getThreadPool(uint64_t numberOfThreads) const;
+
+            /*!
+             * Splits the given row groups into the given number of contiguous blocks such that all blocks have roughly
+             * the same number of entries and rows.
+             *
+             * @param rowGroupIndices The row groups to split. If null, each row is considered as a row group.
+             * @param numberOfBlocks The number of blocks.
+             * @return The first row group of each block, followed by the number of row groups.
+             */
+            std::vector<uint64_t> computeBlocks(std::vector<uint64_t> const* rowGroupIndices, uint64_t numberOfBlocks) const;
+            
+            /*!
+             * Copies the given vector to the cached vector (using all threads of the given pool), such that the values
+             * at the beginning of a Gauss-Seidel style multiplication are available to all blocks.
+             */
+            std::vector<ValueType> const& createSnapshot(storm::utility::ThreadPool& pool, std::vector<uint64_t> const& blocks, std::vector<ValueType> const& x) const;
+
+        private:
+            mutable std::unique_ptr<storm::utility::ThreadPool> threadPool;
+        };
+
+    }
+}
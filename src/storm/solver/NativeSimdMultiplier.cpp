@@ -0,0 +1,112 @@
+#include "storm/solver/NativeSimdMultiplier.h"
+
+#include <limits>
+
+#include "storm-config.h"
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+
+        namespace detail {
+            template<typename ValueType>
+            storm::utility::simd::InstructionSet getSimdInstructionSet() {
+                // Vectorized kernels are only available for double values.
+                return storm::utility::simd::InstructionSet::None;
+            }
+
+            template<>
+            storm::utility::simd::InstructionSet getSimdInstructionSet<double>() {
+                return storm::utility::simd::getAvailableInstructionSet();
+            }
+        }
+
+        template<typename ValueType>
+        NativeSimdMultiplier<ValueType>::NativeSimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : NativeMultiplier<ValueType>(matrix), instructionSet(detail::getSimdInstructionSet<ValueType>()) {
+            // The gather instructions interpret the 32 bit column indices as signed integers.
+            if (instructionSet != storm::utility::simd::InstructionSet::None && matrix.getColumnCount() > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+                STORM_LOG_WARN("The matrix has too many columns for the vectorized multiplier, falling back to the native multiplier.");
+                instructionSet = storm::utility::simd::InstructionSet::None;
+            }
+            STORM_LOG_DEBUG("Using instruction set '" << instructionSet << "' for matrix-vector multiplications.");
+        }
+
+        template<typename ValueType>
+        void NativeSimdMultiplier<ValueType>::clearCache() const {
+            simdMatrix.reset();
+            NativeMultiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        storm::storage::SplitSparseMatrix<ValueType> const* NativeSimdMultiplier<ValueType>::getSimdMatrix(Environment const& env) const {
+            if (instructionSet == storm::utility::simd::InstructionSet::None || env.solver().multiplier().isMixedPrecisionSet()) {
+                return nullptr;
+            }
+            if (!simdMatrix) {
+                simdMatrix = std::make_unique<storm::storage::SplitSparseMatrix<ValueType>>(this->matrix);
+            }
+            return simdMatrix.get();
+        }
+
+        template<typename ValueType>
+        void NativeSimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            auto simd = getSimdMatrix(env);
+            if (!simd) {
+                NativeMultiplier<ValueType>::multiply(env, x, b, result);
+                return;
+            }
+
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            simd->multiplyWithVectorSimd(instructionSet, x, *target, b);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void NativeSimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            auto simd = getSimdMatrix(env);
+            if (!simd) {
+                NativeMultiplier<ValueType>::multiplyAndReduce(env, dir, rowGroupIndices, x, b, result, choices);
+                return;
+            }
+
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            simd->multiplyAndReduceSimd(instructionSet, dir, rowGroupIndices, x, b, *target, choices);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template class NativeSimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class NativeSimdMultiplier<storm::RationalNumber>;
+        template class NativeSimdMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
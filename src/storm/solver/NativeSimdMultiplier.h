@@ -0,0 +1,43 @@
+#pragma once
+
+#include "storm/solver/NativeMultiplier.h"
+
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace solver {
+
+        /*!
+         * A version of the native multiplier that uses vectorized (AVX2 or AVX-512) kernels for regular
+         * multiplications. The instruction set is selected at runtime depending on the capabilities of the CPU. If
+         * none is available (or the value type is not double), this behaves like the native multiplier. Gauss-Seidel
+         * style multiplications are not vectorized.
+         */
+        template<typename ValueType>
+        class NativeSimdMultiplier : public NativeMultiplier<ValueType> {
+        public:
+            NativeSimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            virtual ~NativeSimdMultiplier() = default;
+
+            virtual void clearCache() const override;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr) const override;
+
+        private:
+            /*!
+             * Retrieves the copy of the matrix that is used by the vectorized kernels and nullptr if the kernels can not
+             * be used (which is also the case if the environment requests single precision matrix entries). The copy is
+             * created upon the first request.
+             */
+            storm::storage::SplitSparseMatrix<ValueType> const* getSimdMatrix(Environment const& env) const;
+
+            // The instruction set used for the vectorized kernels.
+            storm::utility::simd::InstructionSet instructionSet;
+
+            // A copy of the matrix with separate column and value arrays.
+            mutable std::unique_ptr<storm::storage::SplitSparseMatrix<ValueType>> simdMatrix;
+        };
+
+    }
+}
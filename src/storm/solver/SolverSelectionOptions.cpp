@@ -30,6 +30,10 @@ namespace storm {
             switch(t) {
                 case MultiplierType::Native:
                     return "Native";
+                case MultiplierType::NativeParallel:
+                    return "NativeParallel";
+                case MultiplierType::NativeSimd:
+                    return "NativeSimd";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
             }
@@ -1,5 +1,9 @@
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
+#include <algorithm>
+#include <type_traits>
+
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
@@ -60,7 +64,7 @@ namespace storm {
             
             if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(env, needAdaptPrecision);
             }
             
             // We do not need to adapt the precision if all SCCs are trivial (i.e., the system is acyclic)
@@ -75,8 +79,11 @@ namespace storm {
             
             // Handle the case where there is just one large SCC
             bool returnValue = true;
+            uint64_t numberOfThreads = env.solver().topological().getNumberOfThreads();
             if (this->sortedSccDecomposition->size() == 1) {
                 returnValue = solveFullyConnectedEquationSystem(sccSolverEnvironment, x, b);
+            } else if (numberOfThreads > 1 && std::is_same<ValueType, double>::value) {
+                returnValue = solveSccsInParallel(sccSolverEnvironment, numberOfThreads, x, b);
             } else {
                 storm::storage::BitVector sccAsBitVector(x.size(), false);
                 for (auto const& scc : *this->sortedSccDecomposition) {
@@ -87,7 +94,7 @@ namespace storm {
                         for (auto const& state : scc) {
                             sccAsBitVector.set(state, true);
                         }
-                        returnValue = solveScc(sccSolverEnvironment, sccAsBitVector, x, b) && returnValue;
+                        returnValue = solveScc(sccSolverEnvironment, this->sccSolver, sccAsBitVector, x, b) && returnValue;
                     }
                 }
             }
@@ -103,9 +110,52 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->sccScheduler) {
+                this->sccScheduler = std::make_unique<helper::TopologicalSccScheduler<ValueType>>(*this->A, *this->sortedSccDecomposition);
+            }
+            STORM_LOG_TRACE("Solving SCCs using " << numberOfThreads << " threads.");
+            
+            // Each thread uses its own SCC solver and auxiliary data. Only the SCCs are processed concurrently, so the
+            // solvers of the individual SCCs are restricted to a single thread.
+            storm::Environment threadSccSolverEnvironment = sccSolverEnvironment;
+            threadSccSolverEnvironment.solver().multiplier().setNumberOfThreads(1);
+            threadSccSolverEnvironment.solver().topological().setNumberOfThreads(1);
+            this->parallelSccSolvers.resize(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::vector<char> returnValues(numberOfThreads, true);
+            
+            this->sccScheduler->execute(getThreadPool(numberOfThreads), [&] (uint64_t threadIndex, uint64_t sccIndex) {
+                auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+                if (scc.size() == 1) {
+                    returnValues[threadIndex] = solveTrivialScc(*scc.begin(), x, b) && returnValues[threadIndex];
+                } else {
+                    storm::storage::BitVector& sccAsBitVector = sccAsBitVectors[threadIndex];
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, true);
+                    }
+                    returnValues[threadIndex] = solveScc(threadSccSolverEnvironment, this->parallelSccSolvers[threadIndex], sccAsBitVector, x, b) && returnValues[threadIndex];
+                    for (auto const& state : scc) {
+                        sccAsBitVector.set(state, false);
+                    }
+                }
+            });
+            return std::all_of(returnValues.begin(), returnValues.end(), [] (char const& value) { return value; });
+        }
+        
+        template<typename ValueType>
+        storm::utility::ThreadPool& TopologicalLinearEquationSolver<ValueType>::getThreadPool(uint64_t numberOfThreads) const {
+            if (!threadPool || threadPool->getNumberOfThreads() != numberOfThreads) {
+                threadPool.reset();
+                threadPool = std::make_unique<storm::utility::ThreadPool>(numberOfThreads);
+            }
+            return *threadPool;
+        }
+        
+        template<typename ValueType>
+        void TopologicalLinearEquationSolver<ValueType>::createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(env.solver().topological().getNumberOfThreads()));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -156,23 +206,23 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>& sccSolver, storm::storage::BitVector const& scc, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
             
             // Matrix
-            bool asEquationSystem = this->sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
+            bool asEquationSystem = sccSolver->getEquationProblemFormat(sccSolverEnvironment) == LinearEquationSolverProblemFormat::EquationSystem;
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, scc, scc, asEquationSystem);
             if (asEquationSystem) {
                 sccA.convertToEquationSystem();
             }
 //            std::cout << "Solving SCC " << scc << std::endl;
 //            std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, scc);
@@ -192,20 +242,20 @@ namespace storm {
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), scc));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), scc));
             }
             
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
-            bool returnvalue = this->sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
+            bool returnvalue = sccSolver->solveEquations(sccSolverEnvironment, sccX, sccB);
             storm::utility::vector::setVectorValues(globalX, scc, sccX);
             return returnvalue;
         }
@@ -226,6 +276,8 @@ namespace storm {
             sortedSccDecomposition.reset();
             longestSccChainSize = boost::none;
             sccSolver.reset();
+            sccScheduler.reset();
+            parallelSccSolvers.clear();
             LinearEquationSolver<ValueType>::clearCache();
         }
         
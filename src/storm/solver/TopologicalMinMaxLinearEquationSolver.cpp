@@ -1,6 +1,10 @@
 #include "storm/solver/TopologicalMinMaxLinearEquationSolver.h"
 
+#include <algorithm>
+#include <type_traits>
+
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 
 #include "storm/utility/constants.h"
@@ -50,7 +54,7 @@ namespace storm {
             
             if (!this->sortedSccDecomposition || (needAdaptPrecision && !this->longestSccChainSize)) {
                 STORM_LOG_TRACE("Creating SCC decomposition.");
-                createSortedSccDecomposition(needAdaptPrecision);
+                createSortedSccDecomposition(env, needAdaptPrecision);
                 STORM_LOG_INFO("Found " << this->sortedSccDecomposition->size() << " SCC(s). Average size is " << static_cast<double>(this->A->getRowGroupCount()) / static_cast<double>(this->sortedSccDecomposition->size()) << ".");
             }
             
@@ -75,22 +79,27 @@ namespace storm {
                         this->schedulerChoices = std::vector<uint64_t>(x.size());
                     }
                 }
-                storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
-                storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
-                for (auto const& scc : *this->sortedSccDecomposition) {
-                    if (scc.size() == 1) {
-                        returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
-                    } else {
-                        STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
-                        sccRowGroupsAsBitVector.clear();
-                        sccRowsAsBitVector.clear();
-                        for (auto const& group : scc) {
-                            sccRowGroupsAsBitVector.set(group, true);
-                            for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
-                                sccRowsAsBitVector.set(row, true);
+                uint64_t numberOfThreads = env.solver().topological().getNumberOfThreads();
+                if (numberOfThreads > 1 && std::is_same<ValueType, double>::value) {
+                    returnValue = solveSccsInParallel(sccSolverEnvironment, numberOfThreads, dir, x, b);
+                } else {
+                    storm::storage::BitVector sccRowGroupsAsBitVector(x.size(), false);
+                    storm::storage::BitVector sccRowsAsBitVector(b.size(), false);
+                    for (auto const& scc : *this->sortedSccDecomposition) {
+                        if (scc.size() == 1) {
+                            returnValue = solveTrivialScc(*scc.begin(), dir, x, b) && returnValue;
+                        } else {
+                            STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                            sccRowGroupsAsBitVector.clear();
+                            sccRowsAsBitVector.clear();
+                            for (auto const& group : scc) {
+                                sccRowGroupsAsBitVector.set(group, true);
+                                for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                                    sccRowsAsBitVector.set(row, true);
+                                }
                             }
+                            returnValue = solveScc(sccSolverEnvironment, this->sccSolver, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
                         }
-                        returnValue = solveScc(sccSolverEnvironment, dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValue;
                     }
                 }
                 
@@ -112,9 +121,61 @@ namespace storm {
         }
         
         template<typename ValueType>
-        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(bool needLongestChainSize) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            if (!this->sccScheduler) {
+                this->sccScheduler = std::make_unique<helper::TopologicalSccScheduler<ValueType>>(*this->A, *this->sortedSccDecomposition);
+            }
+            STORM_LOG_TRACE("Solving SCCs using " << numberOfThreads << " threads.");
+            
+            // Each thread uses its own SCC solver and auxiliary data. Only the SCCs are processed concurrently, so the
+            // solvers of the individual SCCs are restricted to a single thread.
+            storm::Environment threadSccSolverEnvironment = sccSolverEnvironment;
+            threadSccSolverEnvironment.solver().multiplier().setNumberOfThreads(1);
+            threadSccSolverEnvironment.solver().topological().setNumberOfThreads(1);
+            this->parallelSccSolvers.resize(numberOfThreads);
+            std::vector<storm::storage::BitVector> sccRowGroupsAsBitVectors(numberOfThreads, storm::storage::BitVector(x.size(), false));
+            std::vector<storm::storage::BitVector> sccRowsAsBitVectors(numberOfThreads, storm::storage::BitVector(b.size(), false));
+            std::vector<char> returnValues(numberOfThreads, true);
+            
+            this->sccScheduler->execute(getThreadPool(numberOfThreads), [&] (uint64_t threadIndex, uint64_t sccIndex) {
+                auto const& scc = (*this->sortedSccDecomposition)[sccIndex];
+                if (scc.size() == 1) {
+                    returnValues[threadIndex] = solveTrivialScc(*scc.begin(), dir, x, b) && returnValues[threadIndex];
+                } else {
+                    STORM_LOG_TRACE("Solving SCC of size " << scc.size() << ".");
+                    storm::storage::BitVector& sccRowGroupsAsBitVector = sccRowGroupsAsBitVectors[threadIndex];
+                    storm::storage::BitVector& sccRowsAsBitVector = sccRowsAsBitVectors[threadIndex];
+                    for (auto const& group : scc) {
+                        sccRowGroupsAsBitVector.set(group, true);
+                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                            sccRowsAsBitVector.set(row, true);
+                        }
+                    }
+                    returnValues[threadIndex] = solveScc(threadSccSolverEnvironment, this->parallelSccSolvers[threadIndex], dir, sccRowGroupsAsBitVector, sccRowsAsBitVector, x, b) && returnValues[threadIndex];
+                    for (auto const& group : scc) {
+                        sccRowGroupsAsBitVector.set(group, false);
+                        for (uint64_t row = this->A->getRowGroupIndices()[group]; row < this->A->getRowGroupIndices()[group + 1]; ++row) {
+                            sccRowsAsBitVector.set(row, false);
+                        }
+                    }
+                }
+            });
+            return std::all_of(returnValues.begin(), returnValues.end(), [] (char const& value) { return value; });
+        }
+        
+        template<typename ValueType>
+        storm::utility::ThreadPool& TopologicalMinMaxLinearEquationSolver<ValueType>::getThreadPool(uint64_t numberOfThreads) const {
+            if (!threadPool || threadPool->getNumberOfThreads() != numberOfThreads) {
+                threadPool.reset();
+                threadPool = std::make_unique<storm::utility::ThreadPool>(numberOfThreads);
+            }
+            return *threadPool;
+        }
+        
+        template<typename ValueType>
+        void TopologicalMinMaxLinearEquationSolver<ValueType>::createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const {
             // Obtain the scc decomposition
-            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize));
+            this->sortedSccDecomposition = std::make_unique<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(*this->A, storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(needLongestChainSize).numberOfThreads(env.solver().topological().getNumberOfThreads()));
             if (needLongestChainSize) {
                 this->longestSccChainSize = this->sortedSccDecomposition->getMaxSccDepth() + 1;
             }
@@ -213,21 +274,21 @@ namespace storm {
         }
         
         template<typename ValueType>
-        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
+        bool TopologicalMinMaxLinearEquationSolver<ValueType>::solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection dir, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const {
             
             // Set up the SCC solver
-            if (!this->sccSolver) {
-                this->sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
-                this->sccSolver->setCachingEnabled(true);
+            if (!sccSolver) {
+                sccSolver = GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(sccSolverEnvironment);
+                sccSolver->setCachingEnabled(true);
             }
-            this->sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
-            this->sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
-            this->sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
+            sccSolver->setHasUniqueSolution(this->hasUniqueSolution());
+            sccSolver->setHasNoEndComponents(this->hasNoEndComponents());
+            sccSolver->setTrackScheduler(this->isTrackSchedulerSet());
             
             // SCC Matrix
             storm::storage::SparseMatrix<ValueType> sccA = this->A->getSubmatrix(true, sccRowGroups, sccRowGroups);
             //std::cout << "Matrix is " << sccA << std::endl;
-            this->sccSolver->setMatrix(std::move(sccA));
+            sccSolver->setMatrix(std::move(sccA));
             
             // x Vector
             auto sccX = storm::utility::vector::filterVector(globalX, sccRowGroups);
@@ -248,23 +309,23 @@ namespace storm {
             // initial scheduler
             if (this->hasInitialScheduler()) {
                 auto sccInitChoices = storm::utility::vector::filterVector(this->getInitialScheduler(), sccRowGroups);
-                this->sccSolver->setInitialScheduler(std::move(sccInitChoices));
+                sccSolver->setInitialScheduler(std::move(sccInitChoices));
             }
             
             // lower/upper bounds
             if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setLowerBound(this->getLowerBound());
+                sccSolver->setLowerBound(this->getLowerBound());
             } else if (this->hasLowerBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
+                sccSolver->setLowerBounds(storm::utility::vector::filterVector(this->getLowerBounds(), sccRowGroups));
             }
             if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Global)) {
-                this->sccSolver->setUpperBound(this->getUpperBound());
+                sccSolver->setUpperBound(this->getUpperBound());
             } else if (this->hasUpperBound(storm::solver::AbstractEquationSolver<ValueType>::BoundType::Local)) {
-                this->sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
+                sccSolver->setUpperBounds(storm::utility::vector::filterVector(this->getUpperBounds(), sccRowGroups));
             }
             
             // Requirements
-            auto req = this->sccSolver->getRequirements(sccSolverEnvironment, dir);
+            auto req = sccSolver->getRequirements(sccSolverEnvironment, dir);
             if (req.upperBounds() && this->hasUpperBound()) {
                 req.clearUpperBounds();
             }
@@ -278,16 +339,16 @@ namespace storm {
                 req.clearUniqueSolution();
             }
             STORM_LOG_THROW(!req.hasEnabledCriticalRequirement(), storm::exceptions::UncheckedRequirementException, "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
-            this->sccSolver->setRequirementsChecked(true);
+            sccSolver->setRequirementsChecked(true);
 
             // Invoke scc solver
-            bool res = this->sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
+            bool res = sccSolver->solveEquations(sccSolverEnvironment, dir, sccX, sccB);
             //std::cout << "rhs is " << storm::utility::vector::toString(sccB) << std::endl;
             //std::cout << "x is " << storm::utility::vector::toString(sccX) << std::endl;
             
             // Set Scheduler choices
             if (this->isTrackSchedulerSet()) {
-                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, this->sccSolver->getSchedulerChoices());
+                storm::utility::vector::setVectorValues(this->schedulerChoices.get(), sccRowGroups, sccSolver->getSchedulerChoices());
             }
             
             // Set solution
@@ -308,6 +369,8 @@ namespace storm {
             longestSccChainSize = boost::none;
             sccSolver.reset();
             auxiliaryRowGroupVector.reset();
+            sccScheduler.reset();
+            parallelSccSolvers.clear();
             StandardMinMaxLinearEquationSolver<ValueType>::clearCache();
         }
         
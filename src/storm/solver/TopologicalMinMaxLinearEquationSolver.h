@@ -4,6 +4,8 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/solver/helper/TopologicalSccScheduler.h"
+#include "storm/utility/ThreadPool.h"
 
 namespace storm {
 
@@ -33,7 +35,7 @@ namespace storm {
             storm::Environment getEnvironmentForUnderlyingSolver(storm::Environment const& env, bool adaptPrecision = false) const;
 
             // Creates an SCC decomposition and sorts the SCCs according to a topological sort.
-            void createSortedSccDecomposition(bool needLongestChainSize) const;
+            void createSortedSccDecomposition(storm::Environment const& env, bool needLongestChainSize) const;
 
             // Solves the SCC with the given index
             // ... for the case that the SCC is trivial
@@ -41,13 +43,23 @@ namespace storm {
             // ... for the case that there is just one large SCC
             bool solveFullyConnectedEquationSystem(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             // ... for the remaining cases (1 < scc.size() < x.size())
-            bool solveScc(storm::Environment const& sccSolverEnvironment, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            bool solveScc(storm::Environment const& sccSolverEnvironment, std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>& sccSolver, OptimizationDirection d, storm::storage::BitVector const& sccRowGroups, storm::storage::BitVector const& sccRows, std::vector<ValueType>& globalX, std::vector<ValueType> const& globalB) const;
+            
+            // Solves all SCCs, where SCCs that do not depend on each other are solved concurrently.
+            bool solveSccsInParallel(storm::Environment const& sccSolverEnvironment, uint64_t numberOfThreads, OptimizationDirection d, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            
+            storm::utility::ThreadPool& getThreadPool(uint64_t numberOfThreads) const;
 
             // cached auxiliary data
             mutable std::unique_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType>> sortedSccDecomposition;
             mutable boost::optional<uint64_t> longestSccChainSize;
             mutable std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> sccSolver;
             mutable std::unique_ptr<std::vector<ValueType>> auxiliaryRowGroupVector; // A.rowGroupCount() entries
+            
+            // auxiliary data for solving SCCs in parallel (one SCC solver per thread)
+            mutable std::unique_ptr<helper::TopologicalSccScheduler<ValueType>> sccScheduler;
+            mutable std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> parallelSccSolvers;
+            mutable std::unique_ptr<storm::utility::ThreadPool> threadPool;
         };
     }
 }
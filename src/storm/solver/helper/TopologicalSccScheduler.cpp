@@ -0,0 +1,166 @@
+#include "storm/solver/helper/TopologicalSccScheduler.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <memory>
+#include <mutex>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/ThreadPool.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace solver {
+        namespace helper {
+            
+            namespace detail {
+                // The maximal number of singleton SCCs that a thread processes without synchronizing with the other threads.
+                uint64_t const maximalSingletonBatchSize = 256;
+            }
+            
+            template<typename ValueType>
+            TopologicalSccScheduler<ValueType>::TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition) : numberOfDependencies(sccDecomposition.size(), 0), isSingleton(sccDecomposition.size()) {
+                uint64_t const numberOfSccs = sccDecomposition.size();
+                std::vector<uint64_t> stateToScc(matrix.getRowGroupCount(), std::numeric_limits<uint64_t>::max());
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    isSingleton[scc] = sccDecomposition[scc].size() == 1;
+                    for (auto const& state : sccDecomposition[scc]) {
+                        stateToScc[state] = scc;
+                    }
+                }
+                
+                // Collect the dependencies of each SCC. Since the SCCs are sorted topologically, every SCC only
+                // depends on SCCs with a smaller index.
+                std::vector<uint64_t> lastDependentOf(numberOfSccs, std::numeric_limits<uint64_t>::max());
+                std::vector<std::pair<uint64_t, uint64_t>> dependencies;
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    for (auto const& state : sccDecomposition[scc]) {
+                        for (auto const& entry : matrix.getRowGroup(state)) {
+                            uint64_t successorScc = stateToScc[entry.getColumn()];
+                            if (successorScc != scc && successorScc != std::numeric_limits<uint64_t>::max() && lastDependentOf[successorScc] != scc) {
+                                STORM_LOG_ASSERT(successorScc < scc, "The SCC decomposition is not sorted topologically.");
+                                lastDependentOf[successorScc] = scc;
+                                dependencies.emplace_back(successorScc, scc);
+                                ++numberOfDependencies[scc];
+                            }
+                        }
+                    }
+                }
+                
+                // Store the dependents of each SCC.
+                dependentIndices.assign(numberOfSccs + 1, 0);
+                for (auto const& dependency : dependencies) {
+                    ++dependentIndices[dependency.first + 1];
+                }
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    dependentIndices[scc + 1] += dependentIndices[scc];
+                }
+                dependents.resize(dependencies.size());
+                std::vector<uint64_t> nextPositions(dependentIndices.begin(), dependentIndices.end() - 1);
+                for (auto const& dependency : dependencies) {
+                    dependents[nextPositions[dependency.first]++] = dependency.second;
+                }
+            }
+            
+            template<typename ValueType>
+            void TopologicalSccScheduler<ValueType>::execute(storm::utility::ThreadPool& pool, std::function<void(uint64_t, uint64_t)> const& processScc) const {
+                uint64_t const numberOfSccs = numberOfDependencies.size();
+                std::unique_ptr<std::atomic<uint64_t>[]> remainingDependencies(new std::atomic<uint64_t>[numberOfSccs]);
+                
+                // The SCCs whose dependencies have all been processed. We keep singleton SCCs separately so that they
+                // can be handed out in batches.
+                std::vector<uint64_t> readySingletons;
+                std::vector<uint64_t> readyNonSingletons;
+                for (uint64_t scc = 0; scc < numberOfSccs; ++scc) {
+                    remainingDependencies[scc].store(numberOfDependencies[scc], std::memory_order_relaxed);
+                    if (numberOfDependencies[scc] == 0) {
+                        (isSingleton[scc] ? readySingletons : readyNonSingletons).push_back(scc);
+                    }
+                }
+                
+                std::mutex mutex;
+                std::condition_variable readySccsChanged;
+                uint64_t numberOfProcessedSccs = 0;
+                bool aborted = false;
+                
+                pool.execute([&] (uint64_t threadIndex) {
+                    std::vector<uint64_t> batch;
+                    std::vector<uint64_t> newlyReadySccs;
+                    try {
+                        while (true) {
+                            if (batch.empty()) {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                readySccsChanged.wait(lock, [&] { return aborted || !readyNonSingletons.empty() || !readySingletons.empty() || numberOfProcessedSccs == numberOfSccs; });
+                                if (aborted || numberOfProcessedSccs == numberOfSccs) {
+                                    return;
+                                }
+                                // Prefer non-singleton SCCs as they are more expensive.
+                                if (!readyNonSingletons.empty()) {
+                                    batch.push_back(readyNonSingletons.back());
+                                    readyNonSingletons.pop_back();
+                                } else {
+                                    while (!readySingletons.empty() && batch.size() < detail::maximalSingletonBatchSize) {
+                                        batch.push_back(readySingletons.back());
+                                        readySingletons.pop_back();
+                                    }
+                                }
+                            }
+                            
+                            newlyReadySccs.clear();
+                            for (auto const& scc : batch) {
+                                processScc(threadIndex, scc);
+                                for (uint64_t dependentIndex = dependentIndices[scc]; dependentIndex < dependentIndices[scc + 1]; ++dependentIndex) {
+                                    uint64_t dependent = dependents[dependentIndex];
+                                    if (remainingDependencies[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                                        newlyReadySccs.push_back(dependent);
+                                    }
+                                }
+                            }
+                            
+                            // Newly ready singletons are kept by this thread (up to the batch size) to avoid synchronization.
+                            uint64_t numberOfProcessedBatchSccs = batch.size();
+                            batch.clear();
+                            bool notify = false;
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                for (auto const& scc : newlyReadySccs) {
+                                    if (!isSingleton[scc]) {
+                                        readyNonSingletons.push_back(scc);
+                                        notify = true;
+                                    } else if (batch.size() < detail::maximalSingletonBatchSize) {
+                                        batch.push_back(scc);
+                                    } else {
+                                        readySingletons.push_back(scc);
+                                        notify = true;
+                                    }
+                                }
+                                numberOfProcessedSccs += numberOfProcessedBatchSccs;
+                                notify = notify || numberOfProcessedSccs == numberOfSccs;
+                            }
+                            if (notify) {
+                                readySccsChanged.notify_all();
+                            }
+                        }
+                    } catch (...) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                        }
+                        readySccsChanged.notify_all();
+                        throw;
+                    }
+                });
+            }
+            
+            template class TopologicalSccScheduler<double>;
+            
+#ifdef STORM_HAVE_CARL
+            template class TopologicalSccScheduler<storm::RationalNumber>;
+            template class TopologicalSccScheduler<storm::RationalFunction>;
+#endif
+        }
+    }
+}
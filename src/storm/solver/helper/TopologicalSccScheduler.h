@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace storm {
+    
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+        
+        template<typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+    }
+    
+    namespace utility {
+        class ThreadPool;
+    }
+    
+    namespace solver {
+        namespace helper {
+            
+            /*!
+             * Distributes the SCCs of a topologically sorted SCC decomposition over the threads of a pool such that an
+             * SCC is only processed after all SCCs it depends on (i.e., all SCCs that are reachable in one step) have
+             * been processed. Independent SCCs can thus be processed concurrently. Singleton SCCs are handed out in
+             * batches to keep the synchronization overhead low.
+             */
+            template<typename ValueType>
+            class TopologicalSccScheduler {
+            public:
+                /*!
+                 * Creates a scheduler for the SCCs of the given decomposition of the given matrix.
+                 */
+                TopologicalSccScheduler(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& sccDecomposition);
+                
+                /*!
+                 * Invokes the given function once for every SCC. The function is given the index of the executing thread
+                 * and the index of the SCC. If the function throws, no further SCCs are processed and the exception is
+                 * rethrown.
+                 *
+                 * @param pool The threads on which the SCCs are processed.
+                 * @param processScc The function to invoke.
+                 */
+                void execute(storm::utility::ThreadPool& pool, std::function<void(uint64_t, uint64_t)> const& processScc) const;
+                
+            private:
+                // For each SCC, the number of (distinct) SCCs it depends on.
+                std::vector<uint64_t> numberOfDependencies;
+                
+                // For each SCC, the SCCs that depend on it. The entries for SCC i are in [dependentIndices[i], dependentIndices[i+1]).
+                std::vector<uint64_t> dependentIndices;
+                std::vector<uint64_t> dependents;
+                
+                // For each SCC, whether it consists of a single state.
+                std::vector<bool> isSingleton;
+            };
+        }
+    }
+}
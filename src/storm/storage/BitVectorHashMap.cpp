@@ -42,8 +42,13 @@ namespace storm {
         }
                 
         template<class ValueType, class Hash>
-        BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+        BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor, std::shared_ptr<BitVectorTreeCompression> const& keyCompression) : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0), keyCompression(keyCompression) {
             STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            if (keyCompression) {
+                STORM_LOG_ASSERT(keyCompression->getBitsPerKey() == bucketSize, "Size of the compressed keys does not match the bucket size.");
+                // The buckets only need to hold the compressed keys.
+                this->bucketSize = 64;
+            }
 
             while (initialSize > 0) {
                 ++currentSize;
@@ -88,7 +93,7 @@ namespace storm {
             uint64_t oldSize = numberOfElements;
             numberOfElements = 0;
             for (auto bucketIndex : oldOccupied) {
-                findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+                findOrAddStoredKeyAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
             }
             STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
         }
@@ -100,6 +105,14 @@ namespace storm {
         
         template<class ValueType, class Hash>
         std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+            if (keyCompression) {
+                return findOrAddStoredKeyAndGetBucket(keyCompression->compress(key), value);
+            }
+            return findOrAddStoredKeyAndGetBucket(key, value);
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, uint64_t> BitVectorHashMap<ValueType, Hash>::findOrAddStoredKeyAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
             checkIncreaseSize();
             
             std::pair<bool, uint64_t> flagAndBucket = this->findBucket(key);
@@ -127,7 +140,15 @@ namespace storm {
         
         template<class ValueType, class Hash>
         ValueType BitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
-            std::pair<bool, uint64_t> flagBucketPair = this->findBucket(key);
+            std::pair<bool, uint64_t> flagBucketPair;
+            if (keyCompression) {
+                storm::storage::BitVector compressedKey;
+                flagBucketPair.first = keyCompression->find(key, compressedKey);
+                STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
+                flagBucketPair = this->findBucket(compressedKey);
+            } else {
+                flagBucketPair = this->findBucket(key);
+            }
             STORM_LOG_ASSERT(flagBucketPair.first, "Unknown key.");
             return values[flagBucketPair.second];
         }
@@ -139,6 +160,10 @@ namespace storm {
         
         template<class ValueType, class Hash>
         bool BitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            if (keyCompression) {
+                storm::storage::BitVector compressedKey;
+                return keyCompression->find(key, compressedKey) && findBucket(compressedKey).first;
+            }
             return findBucket(key).first;
         }
 
@@ -177,6 +202,9 @@ namespace storm {
         
         template<class ValueType, class Hash>
         std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            if (keyCompression) {
+                return std::make_pair(keyCompression->decompress(buckets.get(bucket * bucketSize, bucketSize)), values[bucket]);
+            }
             return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
         }
         
@@ -3,8 +3,10 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/BitVectorTreeCompression.h"
 
 namespace storm {
     namespace storage {
@@ -12,7 +14,7 @@ namespace storm {
         /*!
          * This class represents a hash-map whose keys are bit vectors. The value type is arbitrary. Currently, only
          * queries and insertions are supported. Also, the keys must be bit vectors with a length that is a multiple of
-         * 64.
+         * 64. Optionally, the keys can be stored in compressed form (see BitVectorTreeCompression).
          */
 //        template<typename ValueType, typename Hash = std::hash<storm::storage::BitVector>>
 //        template<typename ValueType, typename Hash = FNV1aBitVectorHash>
@@ -56,8 +58,10 @@ namespace storm {
              * @param initialSize The number of buckets that is initially available.
              * @param loadFactor The load factor that determines at which point the size of the underlying storage is
              * increased.
+             * @param keyCompression If given, the keys are stored in the compressed form obtained by this compression,
+             * whose key size needs to match the bucket size. Copies of the map share the compression.
              */
-            BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+            BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, std::shared_ptr<BitVectorTreeCompression> const& keyCompression = nullptr);
             
             BitVectorHashMap(BitVectorHashMap const&) = default;
             BitVectorHashMap(BitVectorHashMap&&) = default;
@@ -162,7 +166,7 @@ namespace storm {
             bool isBucketOccupied(uint_fast64_t bucket) const;
             
             /*!
-             * Searches for the bucket with the given key.
+             * Searches for the bucket with the given (stored, i.e., possibly compressed) key.
              *
              * @param key The key to search for.
              * @return A pair whose first component indicates whether the key is already contained in the map and whose
@@ -170,6 +174,16 @@ namespace storm {
              */
             std::pair<bool, uint64_t> findBucket(storm::storage::BitVector const& key) const;
             
+            /*!
+             * Searches for the given stored (i.e., possibly compressed) key in the map and inserts it with the given
+             * value if it is not found.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return A pair of the found (or inserted) value and the index of the bucket of the key.
+             */
+            std::pair<ValueType, uint64_t> findOrAddStoredKeyAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
             /*!
              * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
              * indicated by the return value.
@@ -220,6 +234,9 @@ namespace storm {
             
             // Functor object that are used to perform the actual hashing.
             Hash hasher;
+
+            // If set, the buckets store the keys in the form obtained by this compression.
+            std::shared_ptr<BitVectorTreeCompression> keyCompression;
             
         };
 
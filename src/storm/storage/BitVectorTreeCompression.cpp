@@ -0,0 +1,245 @@
+#include "storm/storage/BitVectorTreeCompression.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/OutOfRangeException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // Leaves with at most this many bits use their bits as index.
+            static const uint64_t maximalBitsPerIndex = 32;
+
+            // Leaves have at most this many bits.
+            static const uint64_t maximalBitsPerLeaf = 64;
+
+            // The initial number of slots of a table.
+            static const uint64_t initialTableSize = 16;
+
+            // The maximal number of entries of a table (as the indices are stored with 32 bits).
+            static const uint64_t maximalTableEntries = (1ull << 32) - 1;
+
+            static uint64_t hashTableValue(uint64_t value) {
+                // The finalizer of MurmurHash3.
+                value ^= value >> 33;
+                value *= 0xff51afd7ed558ccdull;
+                value ^= value >> 33;
+                value *= 0xc4ceb9fe1a85ec53ull;
+                value ^= value >> 33;
+                return value;
+            }
+        }
+
+        BitVectorTreeCompression::BitVectorTreeCompression(uint64_t bitsPerKey, std::vector<uint64_t> const& segmentOffsets) : bitsPerKey(bitsPerKey) {
+            STORM_LOG_THROW(bitsPerKey > 64 && bitsPerKey % 64 == 0, storm::exceptions::InvalidArgumentException, "Tree compression requires keys whose size is a multiple of 64 and larger than 64.");
+
+            // Pack consecutive segments into leaves as long as their bits can be used as index. Larger segments are
+            // split into leaves of at most 64 bits.
+            std::vector<std::pair<uint64_t, uint64_t>> leaves;
+            uint64_t leafOffset = 0;
+            uint64_t leafWidth = 0;
+            for (uint64_t segment = 0; segment < segmentOffsets.size(); ++segment) {
+                uint64_t segmentOffset = segmentOffsets[segment];
+                uint64_t segmentEnd = segment + 1 < segmentOffsets.size() ? segmentOffsets[segment + 1] : bitsPerKey;
+                STORM_LOG_THROW(segmentOffset >= leafOffset + leafWidth && segmentEnd <= bitsPerKey && segmentOffset <= segmentEnd, storm::exceptions::InvalidArgumentException, "Illegal segment offsets.");
+                if (segmentOffset == segmentEnd) {
+                    continue;
+                }
+
+                // Bits that are not covered by any segment are added to the current leaf.
+                uint64_t segmentWidth = segmentEnd - leafOffset - leafWidth;
+                if (leafWidth + segmentWidth <= detail::maximalBitsPerIndex) {
+                    leafWidth += segmentWidth;
+                    continue;
+                }
+                if (leafWidth > 0) {
+                    leaves.emplace_back(leafOffset, leafWidth);
+                }
+                leafOffset += leafWidth;
+                leafWidth = segmentEnd - leafOffset;
+                while (leafWidth > detail::maximalBitsPerIndex) {
+                    uint64_t width = std::min(leafWidth, detail::maximalBitsPerLeaf);
+                    leaves.emplace_back(leafOffset, width);
+                    leafOffset += width;
+                    leafWidth -= width;
+                }
+            }
+            if (leafOffset + leafWidth < bitsPerKey) {
+                // The remaining bits (which are usually padding) form leaves of their own.
+                for (leafWidth = bitsPerKey - leafOffset; leafWidth > detail::maximalBitsPerIndex;) {
+                    uint64_t width = std::min(leafWidth, detail::maximalBitsPerLeaf);
+                    leaves.emplace_back(leafOffset, width);
+                    leafOffset += width;
+                    leafWidth -= width;
+                }
+            }
+            if (leafWidth > 0) {
+                leaves.emplace_back(leafOffset, leafWidth);
+            }
+            STORM_LOG_ASSERT(leaves.size() >= 2, "Expected at least two leaves.");
+
+            nodes.reserve(2 * leaves.size() - 1);
+            createNodes(leaves, 0, leaves.size());
+
+            // The indices of the root's children form the compressed key, so the root does not need a table.
+            nodes.back().hasTable = false;
+        }
+
+        uint64_t BitVectorTreeCompression::createNodes(std::vector<std::pair<uint64_t, uint64_t>> const& leaves, uint64_t begin, uint64_t end) {
+            Node node;
+            if (end - begin == 1) {
+                node.isLeaf = true;
+                node.bitOffset = leaves[begin].first;
+                node.bitWidth = leaves[begin].second;
+                node.leftChild = 0;
+                node.rightChild = 0;
+                node.hasTable = node.bitWidth > detail::maximalBitsPerIndex;
+            } else {
+                uint64_t middle = begin + (end - begin) / 2;
+                node.isLeaf = false;
+                node.leftChild = createNodes(leaves, begin, middle);
+                node.rightChild = createNodes(leaves, middle, end);
+                node.bitOffset = nodes[node.leftChild].bitOffset;
+                node.bitWidth = nodes[node.rightChild].bitOffset + nodes[node.rightChild].bitWidth - node.bitOffset;
+                node.hasTable = true;
+            }
+            nodes.push_back(std::move(node));
+            return nodes.size() - 1;
+        }
+
+        storm::storage::BitVector BitVectorTreeCompression::compress(storm::storage::BitVector const& key) {
+            STORM_LOG_ASSERT(key.size() == bitsPerKey, "Size of key does not match the compression.");
+            Node const& root = nodes.back();
+            uint64_t leftIndex = getIndex(root.leftChild, key);
+            uint64_t rightIndex = getIndex(root.rightChild, key);
+            storm::storage::BitVector compressedKey(64);
+            compressedKey.setFromInt(0, 64, (leftIndex << 32) | rightIndex);
+            return compressedKey;
+        }
+
+        bool BitVectorTreeCompression::find(storm::storage::BitVector const& key, storm::storage::BitVector& compressedKey) const {
+            STORM_LOG_ASSERT(key.size() == bitsPerKey, "Size of key does not match the compression.");
+            Node const& root = nodes.back();
+            uint64_t leftIndex;
+            uint64_t rightIndex;
+            if (!findIndex(root.leftChild, key, leftIndex) || !findIndex(root.rightChild, key, rightIndex)) {
+                return false;
+            }
+            compressedKey = storm::storage::BitVector(64);
+            compressedKey.setFromInt(0, 64, (leftIndex << 32) | rightIndex);
+            return true;
+        }
+
+        storm::storage::BitVector BitVectorTreeCompression::decompress(storm::storage::BitVector const& compressedKey) const {
+            uint64_t value = compressedKey.getAsInt(0, 64);
+            storm::storage::BitVector key(bitsPerKey);
+            Node const& root = nodes.back();
+            restore(root.leftChild, value >> 32, key);
+            restore(root.rightChild, value & 0xffffffffull, key);
+            return key;
+        }
+
+        uint64_t BitVectorTreeCompression::getBitsPerKey() const {
+            return bitsPerKey;
+        }
+
+        uint64_t BitVectorTreeCompression::getNumberOfTableEntries() const {
+            uint64_t result = 0;
+            for (auto const& node : nodes) {
+                result += node.table.values.size();
+            }
+            return result;
+        }
+
+        uint64_t BitVectorTreeCompression::getIndex(uint64_t node, storm::storage::BitVector const& key) {
+            Node& currentNode = nodes[node];
+            uint64_t value;
+            if (currentNode.isLeaf) {
+                value = key.getAsInt(currentNode.bitOffset, currentNode.bitWidth);
+                if (!currentNode.hasTable) {
+                    return value;
+                }
+            } else {
+                value = (getIndex(currentNode.leftChild, key) << 32) | getIndex(currentNode.rightChild, key);
+            }
+            // Note that the recursive calls do not invalidate the reference, as no nodes are added after construction.
+            return findOrAddToTable(currentNode.table, value);
+        }
+
+        bool BitVectorTreeCompression::findIndex(uint64_t node, storm::storage::BitVector const& key, uint64_t& index) const {
+            Node const& currentNode = nodes[node];
+            uint64_t value;
+            if (currentNode.isLeaf) {
+                value = key.getAsInt(currentNode.bitOffset, currentNode.bitWidth);
+                if (!currentNode.hasTable) {
+                    index = value;
+                    return true;
+                }
+            } else {
+                uint64_t leftIndex;
+                uint64_t rightIndex;
+                if (!findIndex(currentNode.leftChild, key, leftIndex) || !findIndex(currentNode.rightChild, key, rightIndex)) {
+                    return false;
+                }
+                value = (leftIndex << 32) | rightIndex;
+            }
+            return findInTable(currentNode.table, value, index);
+        }
+
+        void BitVectorTreeCompression::restore(uint64_t node, uint64_t index, storm::storage::BitVector& key) const {
+            Node const& currentNode = nodes[node];
+            uint64_t value = currentNode.hasTable ? currentNode.table.values[index] : index;
+            if (currentNode.isLeaf) {
+                key.setFromInt(currentNode.bitOffset, currentNode.bitWidth, value);
+            } else {
+                restore(currentNode.leftChild, value >> 32, key);
+                restore(currentNode.rightChild, value & 0xffffffffull, key);
+            }
+        }
+
+        bool BitVectorTreeCompression::findInTable(Table const& table, uint64_t value, uint64_t& index) {
+            if (table.slots.empty()) {
+                return false;
+            }
+            uint64_t mask = table.slots.size() - 1;
+            for (uint64_t slot = detail::hashTableValue(value) & mask; table.slots[slot] != 0; slot = (slot + 1) & mask) {
+                if (table.values[table.slots[slot] - 1] == value) {
+                    index = table.slots[slot] - 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        uint64_t BitVectorTreeCompression::findOrAddToTable(Table& table, uint64_t value) {
+            // Keep the load factor of the table below 3/4.
+            if (4 * (table.values.size() + 1) > 3 * table.slots.size()) {
+                table.slots.assign(std::max(2 * table.slots.size(), detail::initialTableSize), 0);
+                uint64_t mask = table.slots.size() - 1;
+                for (uint64_t index = 0; index < table.values.size(); ++index) {
+                    uint64_t slot = detail::hashTableValue(table.values[index]) & mask;
+                    while (table.slots[slot] != 0) {
+                        slot = (slot + 1) & mask;
+                    }
+                    table.slots[slot] = index + 1;
+                }
+            }
+
+            uint64_t mask = table.slots.size() - 1;
+            uint64_t slot = detail::hashTableValue(value) & mask;
+            for (; table.slots[slot] != 0; slot = (slot + 1) & mask) {
+                if (table.values[table.slots[slot] - 1] == value) {
+                    return table.slots[slot] - 1;
+                }
+            }
+            STORM_LOG_THROW(table.values.size() < detail::maximalTableEntries, storm::exceptions::OutOfRangeException, "Too many entries in a table of the tree compression.");
+            table.values.push_back(value);
+            table.slots[slot] = table.values.size();
+            return table.values.size() - 1;
+        }
+
+    }
+}
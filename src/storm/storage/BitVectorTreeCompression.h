@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class compresses bit vectors of a fixed size into 64-bit keys (tree compression). The bits are divided
+         * into segments (e.g. the variables of the modules of a model). Consecutive small segments are packed into the
+         * leaves of a balanced binary tree. Each inner node of the tree maps the pair of indices of its children to an
+         * index of its own by means of a table, so equal pairs are only stored once. The compressed key of a bit vector
+         * is the pair of indices of the two children of the root.
+         *
+         * If many bit vectors share their segments (which is typical for the states of a model that is composed of
+         * several modules), the tables are much smaller than the number of bit vectors, so the memory per bit vector
+         * mainly consists of the compressed key.
+         */
+        class BitVectorTreeCompression {
+        public:
+            /*!
+             * Creates a compression for bit vectors of the given size.
+             *
+             * @param bitsPerKey The size of the bit vectors. This value must be a multiple of 64 and larger than 64.
+             * @param segmentOffsets The offsets at which the segments start (in ascending order).
+             */
+            BitVectorTreeCompression(uint64_t bitsPerKey, std::vector<uint64_t> const& segmentOffsets);
+
+            /*!
+             * Compresses the given bit vector, extending the tables if necessary.
+             *
+             * @param key The bit vector to compress.
+             * @return The compressed key (with 64 bits).
+             */
+            storm::storage::BitVector compress(storm::storage::BitVector const& key);
+
+            /*!
+             * Compresses the given bit vector without extending the tables. This may be called concurrently as long as
+             * no bit vector is compressed via compress at the same time.
+             *
+             * @param key The bit vector to compress.
+             * @param compressedKey Is set to the compressed key if the bit vector was compressed before.
+             * @return True iff the bit vector was compressed before.
+             */
+            bool find(storm::storage::BitVector const& key, storm::storage::BitVector& compressedKey) const;
+
+            /*!
+             * Restores the bit vector with the given compressed key.
+             *
+             * @param compressedKey The compressed key that was obtained by compressing the bit vector.
+             * @return The bit vector.
+             */
+            storm::storage::BitVector decompress(storm::storage::BitVector const& compressedKey) const;
+
+            /*!
+             * Retrieves the size of the (uncompressed) bit vectors.
+             */
+            uint64_t getBitsPerKey() const;
+
+            /*!
+             * Retrieves the number of entries of all tables.
+             */
+            uint64_t getNumberOfTableEntries() const;
+
+        private:
+            // A table mapping 64-bit values to consecutive indices.
+            struct Table {
+                // The values in the order of their indices.
+                std::vector<uint64_t> values;
+
+                // An open-addressing hash table storing the indices of the values (plus one, zero indicates an empty slot).
+                std::vector<uint32_t> slots;
+            };
+
+            // A node of the tree. Leaves store a range of bits, inner nodes combine the indices of their children.
+            struct Node {
+                bool isLeaf;
+                uint64_t bitOffset;
+                uint64_t bitWidth;
+                uint64_t leftChild;
+                uint64_t rightChild;
+
+                // Leaves with at most 32 bits use their bits as index and do not need a table.
+                bool hasTable;
+                Table table;
+            };
+
+            /*!
+             * Creates the nodes for the given range of leaves (given by their bit offsets and widths) and returns the
+             * index of the subtree's root.
+             */
+            uint64_t createNodes(std::vector<std::pair<uint64_t, uint64_t>> const& leaves, uint64_t begin, uint64_t end);
+
+            /*!
+             * Retrieves the index of the part of the key that belongs to the given node, adding missing table entries.
+             */
+            uint64_t getIndex(uint64_t node, storm::storage::BitVector const& key);
+
+            /*!
+             * Retrieves the index of the part of the key that belongs to the given node without adding table entries.
+             *
+             * @return True iff the part of the key is contained in the tables.
+             */
+            bool findIndex(uint64_t node, storm::storage::BitVector const& key, uint64_t& index) const;
+
+            /*!
+             * Writes the bits that belong to the given node with the given index into the key.
+             */
+            void restore(uint64_t node, uint64_t index, storm::storage::BitVector& key) const;
+
+            /*!
+             * Searches the given value in the table.
+             *
+             * @return True iff the value is contained in the table.
+             */
+            static bool findInTable(Table const& table, uint64_t value, uint64_t& index);
+
+            /*!
+             * Searches the given value in the table and adds it if it is not contained. Returns its index.
+             */
+            static uint64_t findOrAddToTable(Table& table, uint64_t value);
+
+            // The size of the bit vectors.
+            uint64_t bitsPerKey;
+
+            // The nodes of the tree. The root is the last node.
+            std::vector<Node> nodes;
+        };
+
+    }
+}
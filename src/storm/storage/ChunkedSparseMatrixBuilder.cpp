@@ -0,0 +1,168 @@
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        ChunkedSparseMatrixBuilder<ValueType>::ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping, index_type chunkSize) : chunkSize(chunkSize), chunks(), hasCustomRowGrouping(hasCustomRowGrouping), rowIndications(), rowGroupIndices(), columnReplacements(), columnReplacementOffset(0), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
+            STORM_LOG_THROW(chunkSize > 0, storm::exceptions::InvalidArgumentException, "Illegal chunk size.");
+            if (hasCustomRowGrouping) {
+                rowGroupIndices = std::vector<index_type>();
+            }
+            rowIndications.push_back(0);
+        }
+
+        template<typename ValueType>
+        void ChunkedSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, value_type const& value) {
+            STORM_LOG_ASSERT(!columnReplacements, "Adding an element after replacing the columns.");
+
+            // The last entry is in the current row iff the current row is not empty.
+            bool lastEntryInRow = row == lastRow && currentEntryCount > rowIndications.back();
+
+            // Check that we did not move backwards wrt. the row or (within the row) the column.
+            STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException, "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+            STORM_LOG_THROW(!lastEntryInRow || column >= lastColumn, storm::exceptions::InvalidArgumentException, "Adding an element in column " << column << " of row " << row << ", but an element in column " << lastColumn << " has already been added.");
+
+            // If the element is in the same row and column as the previous entry, we add them up.
+            if (lastEntryInRow && column == lastColumn) {
+                auto& entry = chunks.back().back();
+                entry.setValue(entry.getValue() + value);
+                return;
+            }
+
+            // If we switched to another row, we have to adjust the missing entries in the row indices vector.
+            for (index_type i = lastRow + 1; i <= row; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+            lastRow = row;
+            lastColumn = column;
+
+            // Start a new chunk if the last one is full. As the chunk is reserved with its final size, adding entries
+            // never reallocates.
+            if (chunks.empty() || chunks.back().size() == chunkSize) {
+                chunks.emplace_back();
+                chunks.back().reserve(chunkSize);
+            }
+            chunks.back().emplace_back(column, value);
+            highestColumn = std::max(highestColumn, column);
+            ++currentEntryCount;
+        }
+
+        template<typename ValueType>
+        void ChunkedSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+            STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidStateException, "Matrix was not created to have a custom row grouping.");
+            STORM_LOG_THROW(startingRow >= lastRow, storm::exceptions::InvalidStateException, "Illegal row group with negative size.");
+            rowGroupIndices.get().push_back(startingRow);
+            ++currentRowGroupCount;
+
+            // Close all rows from the most recent one to the starting row.
+            for (index_type i = lastRow + 1; i < startingRow; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+
+            if (lastRow + 1 < startingRow) {
+                // Reset the most recently seen row/column to allow for proper insertion of the following elements.
+                lastRow = startingRow - 1;
+                lastColumn = 0;
+            }
+        }
+
+        template<typename ValueType>
+        typename ChunkedSparseMatrixBuilder<ValueType>::index_type ChunkedSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+            if (hasCustomRowGrouping) {
+                return currentRowGroupCount;
+            } else {
+                return lastRow + 1;
+            }
+        }
+
+        template<typename ValueType>
+        void ChunkedSparseMatrixBuilder<ValueType>::replaceColumns(std::vector<index_type> const& replacements, index_type offset) {
+            STORM_LOG_THROW(!columnReplacements, storm::exceptions::InvalidStateException, "The columns were already replaced.");
+            columnReplacements = replacements;
+            columnReplacementOffset = offset;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> ChunkedSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+            bool hasEntries = currentEntryCount != 0;
+            index_type rowCount = hasEntries ? lastRow + 1 : 0;
+
+            // If the last row group was empty, we need to add one more to the row count, because otherwise this empty row is not counted.
+            if (hasCustomRowGrouping && !rowGroupIndices->empty()) {
+                if (lastRow < rowGroupIndices->back()) {
+                    ++rowCount;
+                }
+            }
+            rowCount = std::max(rowCount, overriddenRowCount);
+
+            // If the current row count was overridden, we may need to add empty rows.
+            for (index_type i = lastRow + 1; i < rowCount; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+
+            // Put a sentinel element at the last position of the row indices array (as the SparseMatrixBuilder does).
+            if (rowCount > 0) {
+                rowIndications.push_back(currentEntryCount);
+            }
+            STORM_LOG_ASSERT(rowCount == rowIndications.size() - 1, "Wrong sizes of vectors: " << rowCount << " != " << (rowIndications.size() - 1) << ".");
+
+            if (hasCustomRowGrouping) {
+                index_type rowGroupCount = std::max(currentRowGroupCount, overriddenRowGroupCount);
+                for (index_type i = currentRowGroupCount; i <= rowGroupCount; ++i) {
+                    rowGroupIndices.get().push_back(rowCount);
+                }
+            }
+
+            // Move the entries into storage of the exact size, replacing the columns on the way if requested. The chunks
+            // are released one by one, so the entries are only held twice until the first chunks have been moved.
+            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            columnsAndValues.reserve(currentEntryCount);
+            if (columnReplacements) {
+                highestColumn = 0;
+            }
+            for (auto& chunk : chunks) {
+                for (auto& entry : chunk) {
+                    if (columnReplacements && entry.getColumn() >= columnReplacementOffset) {
+                        entry.setColumn(columnReplacements.get()[entry.getColumn() - columnReplacementOffset]);
+                    }
+                    if (columnReplacements) {
+                        highestColumn = std::max(highestColumn, entry.getColumn());
+                    }
+                    columnsAndValues.push_back(std::move(entry));
+                }
+                // Release the chunk right away.
+                std::vector<MatrixEntry<index_type, value_type>>().swap(chunk);
+            }
+            chunks.clear();
+
+            // Replacing the columns may have destroyed the order of the columns within the rows, so we restore it in place.
+            if (columnReplacements) {
+                for (index_type row = 0; row < rowCount; ++row) {
+                    std::sort(columnsAndValues.begin() + rowIndications[row], columnsAndValues.begin() + rowIndications[row + 1], [] (MatrixEntry<index_type, value_type> const& a, MatrixEntry<index_type, value_type> const& b) {
+                        return a.getColumn() < b.getColumn();
+                    });
+                }
+                columnReplacements = boost::none;
+            }
+            index_type columnCount = std::max(hasEntries ? highestColumn + 1 : 0, overriddenColumnCount);
+
+            return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+        }
+
+        template class ChunkedSparseMatrixBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class ChunkedSparseMatrixBuilder<storm::RationalNumber>;
+        template class ChunkedSparseMatrixBuilder<storm::RationalFunction>;
+#endif
+    }
+}
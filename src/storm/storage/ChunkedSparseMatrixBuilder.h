@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A class that can be used to build a sparse matrix by adding value by value, similar to the
+         * SparseMatrixBuilder. However, the entries are stored in chunks of fixed size while building, so adding entries
+         * never reallocates (and copies) the entries added so far and no storage beyond the last chunk is over-allocated.
+         * When building the matrix, the entries are moved chunk by chunk into storage that is allocated with the exact
+         * size of the matrix, releasing each chunk right away. Note that this storage is allocated before the first chunk
+         * is released, so while building, the memory needed for the entries temporarily doubles.
+         *
+         * Entries must be added row by row and, within each row, with non-decreasing columns. Entries with the same row
+         * and column are added up.
+         */
+        template<typename ValueType>
+        class ChunkedSparseMatrixBuilder {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Constructs a builder that stores the entries in chunks of the given size.
+             *
+             * @param hasCustomRowGrouping A flag indicating whether the matrix has a custom row grouping.
+             * @param chunkSize The number of entries per chunk.
+             */
+            ChunkedSparseMatrixBuilder(bool hasCustomRowGrouping = false, index_type chunkSize = 1ull << 16);
+
+            /*!
+             * Sets the matrix entry at the given row and column to the given value. Rows must be non-decreasing and,
+             * within a row, columns must be non-decreasing.
+             *
+             * @param row The row in which the matrix entry is to be set.
+             * @param column The column in which the matrix entry is to be set.
+             * @param value The value that is to be set at the specified row and column.
+             */
+            void addNextValue(index_type row, index_type column, value_type const& value);
+
+            /*!
+             * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row
+             * group are added.
+             *
+             * @param startingRow The starting row of the new row group.
+             */
+            void newRowGroup(index_type startingRow);
+
+            /*!
+             * Retrieves the number of row groups that were started so far. Without a custom row grouping, this is the
+             * number of rows.
+             */
+            index_type getCurrentRowGroupCount() const;
+
+            /*!
+             * Replaces all columns with id >= offset according to replacements, i.e. column offset+i is replaced by
+             * replacements[i]. The replacement needs to be injective. As opposed to the SparseMatrixBuilder, the columns
+             * are not replaced right away, but while building the matrix, which saves a pass over the entries. No entries
+             * may be added afterwards.
+             *
+             * @param replacements Mapping indicating the replacements from offset+i -> value of i.
+             * @param offset Offset to add to each id in vector index.
+             */
+            void replaceColumns(std::vector<index_type> const& replacements, index_type offset);
+
+            /*!
+             * Finalizes the matrix by moving its entries into storage of the exact size and returns it. Afterwards, the
+             * builder must not be used anymore.
+             *
+             * @param overriddenRowCount If this is greater than the actual number of rows, empty rows are appended.
+             * @param overriddenColumnCount If this is greater than the actual number of columns, the matrix has this
+             * many columns.
+             * @param overriddenRowGroupCount If this is greater than the actual number of row groups, empty row groups
+             * are appended.
+             */
+            SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+        private:
+            // The number of entries per chunk.
+            index_type chunkSize;
+
+            // The chunks storing the entries. All but the last chunk are full.
+            std::vector<std::vector<MatrixEntry<index_type, value_type>>> chunks;
+
+            // Flags indicating whether the matrix has a custom row grouping.
+            bool hasCustomRowGrouping;
+
+            // The row indications and (if any) row group indices of the matrix.
+            std::vector<index_type> rowIndications;
+            boost::optional<std::vector<index_type>> rowGroupIndices;
+
+            // The replacement of columns that is applied when building the matrix (if any).
+            boost::optional<std::vector<index_type>> columnReplacements;
+            index_type columnReplacementOffset;
+
+            // Stores the number of entries.
+            index_type currentEntryCount;
+
+            // Stores the row and column of the most recently added entry.
+            index_type lastRow;
+            index_type lastColumn;
+
+            // Stores the highest column of all entries.
+            index_type highestColumn;
+
+            // Stores the number of row groups that were started.
+            index_type currentRowGroupCount;
+        };
+
+    }
+}
@@ -0,0 +1,355 @@
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+#include <algorithm>
+#include <thread>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // The number of buckets that one thread moves at once when the storage is increased.
+            static const uint64_t concurrentHashMapMoveChunkSize = 4096;
+
+            // Keys up to this number of words are handled without allocating memory.
+            static const uint64_t concurrentHashMapMaxLocalKeyWords = 4;
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket) : map(map), bucket(bucket) {
+            skipUnoccupiedBuckets();
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator==(ConcurrentBitVectorHashMapIterator const& other) {
+            return &map == &other.map && bucket == other.bucket;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator!=(ConcurrentBitVectorHashMapIterator const& other) {
+            return !(*this == other);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++(int) {
+            ++bucket;
+            skipUnoccupiedBuckets();
+            return *this;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator& ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator++() {
+            ++bucket;
+            skipUnoccupiedBuckets();
+            return *this;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::operator*() const {
+            return map.getBucketAndValue(bucket);
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMapIterator::skipUnoccupiedBuckets() {
+            Storage const& storage = *map.currentStorage.load(std::memory_order_acquire);
+            uint64_t numberOfBuckets = storage.getNumberOfBuckets();
+            while (bucket < numberOfBuckets && storage.states[bucket].load(std::memory_order_relaxed) != BucketState::Occupied) {
+                ++bucket;
+            }
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::Storage::Storage(uint64_t sizeExponent, uint64_t wordsPerBucket) : sizeExponent(sizeExponent), states(new std::atomic<BucketState>[1ull << sizeExponent]), keys(new uint64_t[wordsPerBucket << sizeExponent]), values(new ValueType[1ull << sizeExponent]), successor(nullptr), nextChunkToMove(0), numberOfMovedChunks(0) {
+            for (uint64_t bucket = 0, numberOfBuckets = getNumberOfBuckets(); bucket < numberOfBuckets; ++bucket) {
+                states[bucket].store(BucketState::Empty, std::memory_order_relaxed);
+            }
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::Storage::getNumberOfBuckets() const {
+            return 1ull << sizeExponent;
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::ConcurrentBitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), wordsPerBucket(bucketSize / 64), currentStorage(nullptr), numberOfElements(0) {
+            STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
+            STORM_LOG_ASSERT(loadFactor > 0 && loadFactor < 1, "Load factor must be in (0,1).");
+
+            uint64_t sizeExponent = 1;
+            while (initialSize > 0) {
+                ++sizeExponent;
+                initialSize >>= 1;
+            }
+            currentStorage.store(new Storage(sizeExponent, wordsPerBucket), std::memory_order_release);
+        }
+
+        template<class ValueType, class Hash>
+        ConcurrentBitVectorHashMap<ValueType, Hash>::~ConcurrentBitVectorHashMap() {
+            delete currentStorage.load(std::memory_order_acquire);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::size() const {
+            return numberOfElements.load(std::memory_order_relaxed);
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::capacity() const {
+            return currentStorage.load(std::memory_order_acquire)->getNumberOfBuckets();
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAdd(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrAddAndGetBucket(key, value).first;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<ValueType, uint64_t> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value) {
+            return findOrAddInternal(key, value, true).second;
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::contains(storm::storage::BitVector const& key) const {
+            return findOrAddInternal(key, ValueType(), false).first;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(storm::storage::BitVector const& key) const {
+            auto result = findOrAddInternal(key, ValueType(), false);
+            STORM_LOG_ASSERT(result.first, "Unknown key.");
+            return result.second.first;
+        }
+
+        template<class ValueType, class Hash>
+        ValueType ConcurrentBitVectorHashMap<ValueType, Hash>::getValue(uint64_t bucket) const {
+            return currentStorage.load(std::memory_order_acquire)->values[bucket];
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<storm::storage::BitVector, ValueType> ConcurrentBitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
+            Storage const& storage = *currentStorage.load(std::memory_order_acquire);
+            storm::storage::BitVector key(bucketSize);
+            uint64_t const* keyWords = storage.keys.get() + bucket * wordsPerBucket;
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                key.setFromInt(word * 64, 64, keyWords[word]);
+            }
+            return std::make_pair(std::move(key), storage.values[bucket]);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::begin() const {
+            return const_iterator(*this, 0);
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::const_iterator ConcurrentBitVectorHashMap<ValueType, Hash>::end() const {
+            return const_iterator(*this, capacity());
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::remap(std::function<ValueType(ValueType const&)> const& remapping) {
+            Storage& storage = *currentStorage.load(std::memory_order_acquire);
+            for (uint64_t bucket = 0, numberOfBuckets = storage.getNumberOfBuckets(); bucket < numberOfBuckets; ++bucket) {
+                if (storage.states[bucket].load(std::memory_order_relaxed) == BucketState::Occupied) {
+                    storage.values[bucket] = remapping(storage.values[bucket]);
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        uint64_t ConcurrentBitVectorHashMap<ValueType, Hash>::getInitialBucket(Storage const& storage, uint64_t hash) const {
+            return hash >> (sizeof(decltype(hasher(storm::storage::BitVector()))) * 8 - storage.sizeExponent);
+        }
+
+        template<class ValueType, class Hash>
+        bool ConcurrentBitVectorHashMap<ValueType, Hash>::keyMatches(Storage const& storage, uint64_t bucket, uint64_t const* keyWords) const {
+            uint64_t const* bucketWords = storage.keys.get() + bucket * wordsPerBucket;
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                if (bucketWords[word] != keyWords[word]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<class ValueType, class Hash>
+        std::pair<bool, std::pair<ValueType, uint64_t>> ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddInternal(storm::storage::BitVector const& key, ValueType const& value, bool insert) const {
+            STORM_LOG_ASSERT(key.size() == bucketSize, "Size of bit vector and size of buckets do not match");
+
+            // Extract the words of the key once, so they can be compared directly with the stored keys.
+            uint64_t localKeyWords[detail::concurrentHashMapMaxLocalKeyWords];
+            std::vector<uint64_t> allocatedKeyWords;
+            uint64_t* keyWords = localKeyWords;
+            if (wordsPerBucket > detail::concurrentHashMapMaxLocalKeyWords) {
+                allocatedKeyWords.resize(wordsPerBucket);
+                keyWords = allocatedKeyWords.data();
+            }
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                keyWords[word] = key.getAsInt(word * 64, 64);
+            }
+            uint64_t hash = hasher(key);
+
+            Storage* storage = currentStorage.load(std::memory_order_acquire);
+            while (true) {
+                // Increase the storage before inserting into a storage that is too full.
+                if (insert && numberOfElements.load(std::memory_order_relaxed) >= loadFactor * storage->getNumberOfBuckets()) {
+                    storage = moveToLargerStorage(storage);
+                }
+
+                ValueType resultValue = value;
+                uint64_t bucket = 0;
+                SearchResult result = findOrAddInStorage(*storage, keyWords, hash, resultValue, bucket, insert);
+                switch (result) {
+                    case SearchResult::Found:
+                        return std::make_pair(true, std::make_pair(resultValue, bucket));
+                    case SearchResult::NotFound:
+                        return std::make_pair(false, std::make_pair(resultValue, bucket));
+                    case SearchResult::Inserted:
+                        numberOfElements.fetch_add(1, std::memory_order_relaxed);
+                        return std::make_pair(true, std::make_pair(resultValue, bucket));
+                    case SearchResult::Moved:
+                        storage = moveToLargerStorage(storage);
+                        break;
+                }
+            }
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::SearchResult ConcurrentBitVectorHashMap<ValueType, Hash>::findOrAddInStorage(Storage& storage, uint64_t const* keyWords, uint64_t hash, ValueType& value, uint64_t& bucket, bool insert) const {
+            uint64_t numberOfBuckets = storage.getNumberOfBuckets();
+            bucket = getInitialBucket(storage, hash);
+
+            for (uint64_t probe = 0; probe < numberOfBuckets; ++probe) {
+                std::atomic<BucketState>& state = storage.states[bucket];
+                BucketState currentState = state.load(std::memory_order_acquire);
+
+                if (currentState == BucketState::Empty) {
+                    if (!insert) {
+                        return SearchResult::NotFound;
+                    }
+                    // Try to claim the bucket. If this fails, currentState holds the state another thread set.
+                    if (state.compare_exchange_strong(currentState, BucketState::Reserved, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        std::copy(keyWords, keyWords + wordsPerBucket, storage.keys.get() + bucket * wordsPerBucket);
+                        storage.values[bucket] = value;
+                        state.store(BucketState::Occupied, std::memory_order_release);
+                        return SearchResult::Inserted;
+                    }
+                }
+
+                // Wait for a concurrent insertion into this bucket to complete as it might insert the same key.
+                while (currentState == BucketState::Reserved) {
+                    std::this_thread::yield();
+                    currentState = state.load(std::memory_order_acquire);
+                }
+
+                if (currentState == BucketState::Moved) {
+                    return SearchResult::Moved;
+                }
+                STORM_LOG_ASSERT(currentState == BucketState::Occupied, "Unexpected bucket state.");
+                if (keyMatches(storage, bucket, keyWords)) {
+                    value = storage.values[bucket];
+                    return SearchResult::Found;
+                }
+
+                ++bucket;
+                if (bucket == numberOfBuckets) {
+                    bucket = 0;
+                }
+            }
+
+            // The storage is completely full. This can only happen if many threads insert at the same time, so we need
+            // a larger storage.
+            return SearchResult::Moved;
+        }
+
+        template<class ValueType, class Hash>
+        typename ConcurrentBitVectorHashMap<ValueType, Hash>::Storage* ConcurrentBitVectorHashMap<ValueType, Hash>::moveToLargerStorage(Storage* storage) const {
+            // Create the larger storage unless another thread already did.
+            Storage* newStorage = storage->successor.load(std::memory_order_acquire);
+            if (newStorage == nullptr) {
+                std::lock_guard<std::mutex> lock(storageMutex);
+                newStorage = storage->successor.load(std::memory_order_acquire);
+                if (newStorage == nullptr) {
+                    STORM_LOG_TRACE("Increasing size of concurrent hash map from " << storage->getNumberOfBuckets() << " to " << (storage->getNumberOfBuckets() << 1) << ".");
+                    newStorage = new Storage(storage->sizeExponent + 1, wordsPerBucket);
+                    storage->successor.store(newStorage, std::memory_order_release);
+                }
+            }
+
+            // Move chunks of buckets until there are no more chunks left.
+            uint64_t numberOfBuckets = storage->getNumberOfBuckets();
+            uint64_t numberOfChunks = (numberOfBuckets + detail::concurrentHashMapMoveChunkSize - 1) / detail::concurrentHashMapMoveChunkSize;
+            uint64_t chunk = storage->nextChunkToMove.fetch_add(1, std::memory_order_relaxed);
+            while (chunk < numberOfChunks) {
+                uint64_t lastBucket = std::min(numberOfBuckets, (chunk + 1) * detail::concurrentHashMapMoveChunkSize);
+                for (uint64_t bucket = chunk * detail::concurrentHashMapMoveChunkSize; bucket < lastBucket; ++bucket) {
+                    moveBucket(*storage, bucket, *newStorage);
+                }
+                storage->numberOfMovedChunks.fetch_add(1, std::memory_order_acq_rel);
+                chunk = storage->nextChunkToMove.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            // Wait for the other threads to finish their chunks. Only then, all keys are present in the new storage.
+            while (storage->numberOfMovedChunks.load(std::memory_order_acquire) < numberOfChunks) {
+                std::this_thread::yield();
+            }
+
+            // Publish the new storage. Exactly one thread succeeds and keeps the outgrown storage alive.
+            Storage* expected = storage;
+            if (currentStorage.compare_exchange_strong(expected, newStorage, std::memory_order_acq_rel)) {
+                std::lock_guard<std::mutex> lock(storageMutex);
+                outgrownStorages.emplace_back(storage);
+            }
+            return newStorage;
+        }
+
+        template<class ValueType, class Hash>
+        void ConcurrentBitVectorHashMap<ValueType, Hash>::moveBucket(Storage& storage, uint64_t bucket, Storage& newStorage) const {
+            std::atomic<BucketState>& state = storage.states[bucket];
+            BucketState currentState = state.load(std::memory_order_acquire);
+            while (true) {
+                if (currentState == BucketState::Empty) {
+                    // Seal the empty bucket, so no key can be inserted into it anymore.
+                    if (state.compare_exchange_weak(currentState, BucketState::Moved, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                        return;
+                    }
+                } else if (currentState == BucketState::Reserved) {
+                    std::this_thread::yield();
+                    currentState = state.load(std::memory_order_acquire);
+                } else if (currentState == BucketState::Moved) {
+                    return;
+                } else {
+                    break;
+                }
+            }
+
+            // Insert the key into the new storage. As all keys are distinct, we only need to find a free bucket.
+            uint64_t const* keyWords = storage.keys.get() + bucket * wordsPerBucket;
+            storm::storage::BitVector key(bucketSize);
+            for (uint64_t word = 0; word < wordsPerBucket; ++word) {
+                key.setFromInt(word * 64, 64, keyWords[word]);
+            }
+            uint64_t newBucket = getInitialBucket(newStorage, hasher(key));
+            uint64_t newNumberOfBuckets = newStorage.getNumberOfBuckets();
+            while (true) {
+                BucketState expectedState = BucketState::Empty;
+                if (newStorage.states[newBucket].compare_exchange_strong(expectedState, BucketState::Reserved, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                    break;
+                }
+                ++newBucket;
+                if (newBucket == newNumberOfBuckets) {
+                    newBucket = 0;
+                }
+            }
+            std::copy(keyWords, keyWords + wordsPerBucket, newStorage.keys.get() + newBucket * wordsPerBucket);
+            newStorage.values[newBucket] = storage.values[bucket];
+            newStorage.states[newBucket].store(BucketState::Occupied, std::memory_order_release);
+
+            state.store(BucketState::Moved, std::memory_order_release);
+        }
+
+        template class ConcurrentBitVectorHashMap<uint64_t>;
+        template class ConcurrentBitVectorHashMap<uint32_t>;
+    }
+}
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a hash-map whose keys are bit vectors and that can be queried and extended by several
+         * threads concurrently. As for the BitVectorHashMap, the keys must be bit vectors with a length that is a
+         * multiple of 64 and only queries and insertions are supported.
+         *
+         * Insertions claim buckets via compare-and-swap instead of locking the map. Note that the map is nevertheless not
+         * lock-free: a thread that encounters a bucket into which another thread is currently writing a key waits (by
+         * yielding) until the key is written. If the load of the map is too high, the entries are moved to a larger
+         * storage. All threads accessing the map during this time help moving the entries and wait until this is done.
+         * The storage that was outgrown is only released upon destruction of the map, because other threads may still
+         * read from it.
+         *
+         * The methods findOrAdd, findOrAddAndGetBucket, contains, getValue (for keys) and size may be called
+         * concurrently. All other methods require that no other thread accesses the map at the same time.
+         */
+        template<typename ValueType, typename Hash = Murmur3BitVectorHash<ValueType>>
+        class ConcurrentBitVectorHashMap {
+        private:
+            struct Storage;
+
+        public:
+            class ConcurrentBitVectorHashMapIterator {
+            public:
+                /*!
+                 * Creates an iterator that points to the given bucket (or the next occupied bucket after it).
+                 *
+                 * @param map The map of the iterator.
+                 * @param bucket The index of the bucket the iterator points to.
+                 */
+                ConcurrentBitVectorHashMapIterator(ConcurrentBitVectorHashMap const& map, uint64_t bucket);
+
+                // Methods to compare two iterators.
+                bool operator==(ConcurrentBitVectorHashMapIterator const& other);
+                bool operator!=(ConcurrentBitVectorHashMapIterator const& other);
+
+                // Methods to move iterator forward.
+                ConcurrentBitVectorHashMapIterator& operator++(int);
+                ConcurrentBitVectorHashMapIterator& operator++();
+
+                // Method to retrieve the currently pointed-to bit vector and its mapped-to value.
+                std::pair<storm::storage::BitVector, ValueType> operator*() const;
+
+            private:
+                // Moves the iterator to the next occupied bucket (starting from the current one).
+                void skipUnoccupiedBuckets();
+
+                // The map this iterator refers to.
+                ConcurrentBitVectorHashMap const& map;
+
+                // The bucket this iterator points to.
+                uint64_t bucket;
+            };
+
+            typedef ConcurrentBitVectorHashMapIterator const_iterator;
+
+            /*!
+             * Creates a new hash map with the given bucket size and initial size.
+             *
+             * @param bucketSize The size of the buckets that this map can hold. This value must be a multiple of 64.
+             * @param initialSize The number of buckets that is initially available.
+             * @param loadFactor The load factor that determines at which point the size of the underlying storage is
+             * increased.
+             */
+            ConcurrentBitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+
+            ~ConcurrentBitVectorHashMap();
+
+            ConcurrentBitVectorHashMap(ConcurrentBitVectorHashMap const&) = delete;
+            ConcurrentBitVectorHashMap& operator=(ConcurrentBitVectorHashMap const&) = delete;
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value. If several threads insert the same key concurrently, exactly one
+             * of the given values is inserted and returned to all of them.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return The found value if the key is already contained in the map and the provided new value otherwise.
+             */
+            ValueType findOrAdd(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Searches for the given key in the map. If it is found, the mapped-to value is returned. Otherwise, the
+             * key is inserted with the given value.
+             *
+             * @param key The key to search or insert.
+             * @param value The value that is inserted if the key is not already found in the map.
+             * @return A pair whose first component is the found value if the key is already contained in the map and
+             * the provided new value otherwise and whose second component is the index of the bucket into which the key
+             * was inserted. Note that the bucket index becomes invalid if the storage of the map is increased.
+             */
+            std::pair<ValueType, uint64_t> findOrAddAndGetBucket(storm::storage::BitVector const& key, ValueType const& value);
+
+            /*!
+             * Retrieves the key stored in the given bucket (if any) and the value it is mapped to.
+             *
+             * @param bucket The index of the bucket.
+             * @return The content and value of the named bucket.
+             */
+            std::pair<storm::storage::BitVector, ValueType> getBucketAndValue(uint64_t bucket) const;
+
+            /*!
+             * Retrieves the value associated with the given key (if any). If the key does not exist, the behaviour is
+             * undefined.
+             *
+             * @return The value associated with the given key (if any).
+             */
+            ValueType getValue(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves the value associated with the given bucket.
+             *
+             * @return The value associated with the given bucket (if any).
+             */
+            ValueType getValue(uint64_t bucket) const;
+
+            /*!
+             * Checks if the given key is already contained in the map.
+             *
+             * @param key The key to search
+             * @return True if the key is already contained in the map
+             */
+            bool contains(storm::storage::BitVector const& key) const;
+
+            /*!
+             * Retrieves an iterator to the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator begin() const;
+
+            /*!
+             * Retrieves an iterator that points one past the elements of the map.
+             *
+             * @return The iterator.
+             */
+            const_iterator end() const;
+
+            /*!
+             * Retrieves the size of the map in terms of the number of key-value pairs it stores.
+             *
+             * @return The size of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the capacity of the underlying container.
+             *
+             * @return The capacity of the underlying container.
+             */
+            uint64_t capacity() const;
+
+            /*!
+             * Performs a remapping of all values stored by applying the given remapping.
+             *
+             * @param remapping The remapping to apply.
+             */
+            void remap(std::function<ValueType(ValueType const&)> const& remapping);
+
+        private:
+            // The possible states of a bucket.
+            enum class BucketState : uint8_t {
+                // The bucket holds no key.
+                Empty,
+                // A thread claimed the bucket and is writing its key and value.
+                Reserved,
+                // The bucket holds a key and a value.
+                Occupied,
+                // The content of the bucket (if any) was moved to the next storage.
+                Moved
+            };
+
+            // The result of searching for (and possibly inserting) a key in one storage.
+            enum class SearchResult {
+                Found,
+                NotFound,
+                Inserted,
+                Moved
+            };
+
+            // The storage of the map. The number of buckets is 2^sizeExponent.
+            struct Storage {
+                Storage(uint64_t sizeExponent, uint64_t wordsPerBucket);
+
+                uint64_t getNumberOfBuckets() const;
+
+                // The number of buckets is 2^sizeExponent.
+                uint64_t sizeExponent;
+
+                // The state of each bucket. The key and value of a bucket may only be read once it is occupied.
+                std::unique_ptr<std::atomic<BucketState>[]> states;
+
+                // The keys, stored as consecutive 64-bit words per bucket.
+                std::unique_ptr<uint64_t[]> keys;
+
+                // The values of the buckets.
+                std::unique_ptr<ValueType[]> values;
+
+                // The storage the entries are moved to once this storage is outgrown.
+                std::atomic<Storage*> successor;
+
+                // The next chunk of buckets to move to the successor.
+                std::atomic<uint64_t> nextChunkToMove;
+
+                // The number of chunks that were completely moved to the successor.
+                std::atomic<uint64_t> numberOfMovedChunks;
+            };
+
+            /*!
+             * Searches for the key (given as its words) in the given storage and inserts it with the given value if it
+             * is not found.
+             *
+             * @param storage The storage in which to search.
+             * @param keyWords The words of the key.
+             * @param hash The hash value of the key.
+             * @param value The value to insert if the key is not found. Is set to the found value otherwise.
+             * @param bucket Is set to the bucket in which the key is stored.
+             * @param insert If false, the key is not inserted if it is not found.
+             * @return Whether the key was found, not found or inserted or whether the storage is being moved, in which
+             * case the operation needs to be repeated on the successor storage.
+             */
+            SearchResult findOrAddInStorage(Storage& storage, uint64_t const* keyWords, uint64_t hash, ValueType& value, uint64_t& bucket, bool insert) const;
+
+            /*!
+             * Searches for the given key and inserts it with the given value if requested and it is not found.
+             *
+             * @return A pair of a flag indicating whether the key was found or inserted and the (found or inserted)
+             * value and the bucket of the key.
+             */
+            std::pair<bool, std::pair<ValueType, uint64_t>> findOrAddInternal(storm::storage::BitVector const& key, ValueType const& value, bool insert) const;
+
+            /*!
+             * Helps moving the entries of the given storage to a larger one and returns once all entries are moved.
+             *
+             * @param storage The storage that is to be moved.
+             * @return The storage the entries were moved to.
+             */
+            Storage* moveToLargerStorage(Storage* storage) const;
+
+            /*!
+             * Moves the content of the given bucket to the given (larger) storage.
+             */
+            void moveBucket(Storage& storage, uint64_t bucket, Storage& newStorage) const;
+
+            /*!
+             * Determines the bucket at which the search for a key with the given hash value starts.
+             */
+            uint64_t getInitialBucket(Storage const& storage, uint64_t hash) const;
+
+            /*!
+             * Checks whether the given bucket holds the given key.
+             */
+            bool keyMatches(Storage const& storage, uint64_t bucket, uint64_t const* keyWords) const;
+
+            // The load factor determining when the size of the map is increased.
+            double loadFactor;
+
+            // The size of one bucket.
+            uint64_t bucketSize;
+
+            // The number of 64-bit words of one bucket.
+            uint64_t wordsPerBucket;
+
+            // The storage that currently holds the elements.
+            mutable std::atomic<Storage*> currentStorage;
+
+            // The storages that were outgrown. They are kept until the map is destroyed.
+            mutable std::vector<std::unique_ptr<Storage>> outgrownStorages;
+
+            // Protects the creation of larger storages and the list of outgrown storages.
+            mutable std::mutex storageMutex;
+
+            // The number of elements in this map.
+            mutable std::atomic<uint64_t> numberOfElements;
+
+            // Functor object that are used to perform the actual hashing.
+            Hash hasher;
+        };
+
+    }
+}
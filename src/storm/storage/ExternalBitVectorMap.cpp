@@ -0,0 +1,336 @@
+#include "storm/storage/ExternalBitVectorMap.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // The size of the buffers of the file streams.
+            static const uint64_t streamBufferSize = 1ull << 16;
+
+            // The number of entries of the blocks of a run. For each block, the first key is kept in memory.
+            static const uint64_t runBlockSize = 256;
+
+            static std::string createTemporaryFilename(std::string const& directory) {
+                return (boost::filesystem::path(directory) / boost::filesystem::unique_path("storm-%%%%-%%%%-%%%%-%%%%.tmp")).string();
+            }
+
+            static int compareKeys(uint64_t const* first, uint64_t const* second, uint64_t wordsPerKey) {
+                for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                    if (first[word] != second[word]) {
+                        return first[word] < second[word] ? -1 : 1;
+                    }
+                }
+                return 0;
+            }
+
+            /*!
+             * Reads the entries of a run one by one.
+             */
+            template<typename ValueType>
+            class RunReader {
+            public:
+                RunReader(std::string const& filename, uint64_t wordsPerKey, uint64_t numberOfEntries) : buffer(streamBufferSize), key(wordsPerKey), value(), remainingEntries(numberOfEntries) {
+                    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+                    stream.open(filename, std::ios::binary);
+                    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to read file '" << filename << "'.");
+                }
+
+                bool next() {
+                    if (remainingEntries == 0) {
+                        return false;
+                    }
+                    --remainingEntries;
+                    stream.read(reinterpret_cast<char*>(key.data()), key.size() * sizeof(uint64_t));
+                    stream.read(reinterpret_cast<char*>(&value), sizeof(ValueType));
+                    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to read temporary file.");
+                    return true;
+                }
+
+                std::vector<char> buffer;
+                std::ifstream stream;
+                std::vector<uint64_t> key;
+                ValueType value;
+                uint64_t remainingEntries;
+            };
+
+            /*!
+             * Writes the entries of a run one by one.
+             */
+            template<typename ValueType>
+            class RunWriter {
+            public:
+                RunWriter(std::string const& filename, uint64_t wordsPerKey) : buffer(streamBufferSize), wordsPerKey(wordsPerKey), numberOfEntries(0) {
+                    stream.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+                    stream.open(filename, std::ios::binary | std::ios::trunc);
+                    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to create file '" << filename << "'.");
+                }
+
+                void write(uint64_t const* key, ValueType const& value) {
+                    if (numberOfEntries % runBlockSize == 0) {
+                        blockKeyWords.insert(blockKeyWords.end(), key, key + wordsPerKey);
+                    }
+                    stream.write(reinterpret_cast<char const*>(key), wordsPerKey * sizeof(uint64_t));
+                    stream.write(reinterpret_cast<char const*>(&value), sizeof(ValueType));
+                    ++numberOfEntries;
+                }
+
+                void close() {
+                    stream.close();
+                    STORM_LOG_THROW(!stream.fail(), storm::exceptions::FileIoException, "Unable to write temporary file.");
+                }
+
+                std::vector<char> buffer;
+                std::ofstream stream;
+                uint64_t wordsPerKey;
+                uint64_t numberOfEntries;
+                std::vector<uint64_t> blockKeyWords;
+            };
+        }
+
+        template<typename ValueType>
+        ExternalBitVectorMap<ValueType>::ExternalBitVectorMap(uint64_t bucketSize, std::string const& directory) : wordsPerKey(bucketSize / 64), directory(directory), numberOfEntries(0) {
+            STORM_LOG_THROW(bucketSize % 64 == 0, storm::exceptions::InvalidArgumentException, "Bucket size must be a multiple of 64.");
+            STORM_LOG_THROW(boost::filesystem::is_directory(directory), storm::exceptions::InvalidArgumentException, "The directory '" << directory << "' does not exist.");
+        }
+
+        template<typename ValueType>
+        ExternalBitVectorMap<ValueType>::~ExternalBitVectorMap() {
+            for (auto const& run : runs) {
+                boost::system::error_code error;
+                boost::filesystem::remove(run.filename, error);
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::sort(std::vector<uint64_t>& keyWords, std::vector<ValueType>& values) const {
+            STORM_LOG_ASSERT(keyWords.size() == values.size() * wordsPerKey, "Mismatching number of keys and values.");
+            std::vector<uint64_t> order(values.size());
+            std::iota(order.begin(), order.end(), 0);
+            uint64_t const* keys = keyWords.data();
+            uint64_t const wordsPerKey = this->wordsPerKey;
+            std::sort(order.begin(), order.end(), [keys, wordsPerKey] (uint64_t const& first, uint64_t const& second) { return detail::compareKeys(keys + first * wordsPerKey, keys + second * wordsPerKey, wordsPerKey) < 0; });
+
+            std::vector<uint64_t> sortedKeyWords;
+            sortedKeyWords.reserve(keyWords.size());
+            std::vector<ValueType> sortedValues;
+            sortedValues.reserve(values.size());
+            for (auto const& position : order) {
+                sortedKeyWords.insert(sortedKeyWords.end(), keys + position * wordsPerKey, keys + (position + 1) * wordsPerKey);
+                sortedValues.push_back(values[position]);
+            }
+            keyWords = std::move(sortedKeyWords);
+            values = std::move(sortedValues);
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::find(std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType>& values, ValueType const& notFoundValue) const {
+            uint64_t numberOfKeys = sortedKeyWords.size() / wordsPerKey;
+            values.assign(numberOfKeys, notFoundValue);
+            if (numberOfKeys == 0) {
+                return;
+            }
+
+            // Search the keys in every run. As the runs are disjoint, every key is found in at most one of them.
+            for (auto const& run : runs) {
+                searchRun(run, sortedKeyWords, values);
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::searchRun(Run const& run, std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType>& values) const {
+            std::ifstream stream(run.filename, std::ios::binary);
+            STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to read file '" << run.filename << "'.");
+            uint64_t const recordSize = wordsPerKey * sizeof(uint64_t) + sizeof(ValueType);
+            uint64_t const numberOfBlocks = run.blockKeyWords.size() / wordsPerKey;
+            std::vector<char> block(detail::runBlockSize * recordSize);
+            uint64_t loadedBlock = numberOfBlocks;
+            uint64_t loadedBlockSize = 0;
+            std::vector<uint64_t> key(wordsPerKey);
+
+            // As the keys are sorted, the blocks that may contain them are visited in ascending order.
+            uint64_t currentBlock = 0;
+            for (uint64_t position = 0; position < values.size(); ++position) {
+                uint64_t const* currentKey = sortedKeyWords.data() + position * wordsPerKey;
+
+                // Find the last block whose first key is not greater than the current key.
+                while (currentBlock + 1 < numberOfBlocks && detail::compareKeys(run.blockKeyWords.data() + (currentBlock + 1) * wordsPerKey, currentKey, wordsPerKey) <= 0) {
+                    ++currentBlock;
+                }
+                if (detail::compareKeys(run.blockKeyWords.data() + currentBlock * wordsPerKey, currentKey, wordsPerKey) > 0) {
+                    continue;
+                }
+
+                if (loadedBlock != currentBlock) {
+                    loadedBlock = currentBlock;
+                    loadedBlockSize = std::min(detail::runBlockSize, run.size - currentBlock * detail::runBlockSize);
+                    stream.seekg(currentBlock * detail::runBlockSize * recordSize);
+                    stream.read(block.data(), loadedBlockSize * recordSize);
+                    STORM_LOG_THROW(stream.good(), storm::exceptions::FileIoException, "Unable to read file '" << run.filename << "'.");
+                }
+
+                // Search the key within the block.
+                uint64_t lowerBound = 0;
+                uint64_t upperBound = loadedBlockSize;
+                while (lowerBound < upperBound) {
+                    uint64_t middle = lowerBound + (upperBound - lowerBound) / 2;
+                    std::copy_n(block.data() + middle * recordSize, wordsPerKey * sizeof(uint64_t), reinterpret_cast<char*>(key.data()));
+                    int comparison = detail::compareKeys(key.data(), currentKey, wordsPerKey);
+                    if (comparison < 0) {
+                        lowerBound = middle + 1;
+                    } else if (comparison > 0) {
+                        upperBound = middle;
+                    } else {
+                        std::copy_n(block.data() + middle * recordSize + wordsPerKey * sizeof(uint64_t), sizeof(ValueType), reinterpret_cast<char*>(&values[position]));
+                        break;
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::add(std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType> const& values) {
+            STORM_LOG_ASSERT(sortedKeyWords.size() == values.size() * wordsPerKey, "Mismatching number of keys and values.");
+            if (values.empty()) {
+                return;
+            }
+            runs.push_back(createRun(sortedKeyWords.data(), values.data(), values.size()));
+            numberOfEntries += values.size();
+
+            // Merge runs of similar size to keep the number of runs logarithmic.
+            while (runs.size() >= 2 && 2 * runs.back().size >= runs[runs.size() - 2].size) {
+                mergeLastTwoRuns();
+            }
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& function) const {
+            storm::storage::BitVector key(wordsPerKey * 64);
+            for (auto const& run : runs) {
+                detail::RunReader<ValueType> reader(run.filename, wordsPerKey, run.size);
+                while (reader.next()) {
+                    for (uint64_t word = 0; word < wordsPerKey; ++word) {
+                        key.setFromInt(word * 64, 64, reader.key[word]);
+                    }
+                    function(key, reader.value);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t ExternalBitVectorMap<ValueType>::size() const {
+            return numberOfEntries;
+        }
+
+        template<typename ValueType>
+        uint64_t ExternalBitVectorMap<ValueType>::getNumberOfWordsPerKey() const {
+            return wordsPerKey;
+        }
+
+        template<typename ValueType>
+        typename ExternalBitVectorMap<ValueType>::Run ExternalBitVectorMap<ValueType>::createRun(uint64_t const* sortedKeyWords, ValueType const* values, uint64_t numberOfEntries) const {
+            Run run{detail::createTemporaryFilename(directory), numberOfEntries, std::vector<uint64_t>()};
+            detail::RunWriter<ValueType> writer(run.filename, wordsPerKey);
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                writer.write(sortedKeyWords + entry * wordsPerKey, values[entry]);
+            }
+            writer.close();
+            run.blockKeyWords = std::move(writer.blockKeyWords);
+            return run;
+        }
+
+        template<typename ValueType>
+        void ExternalBitVectorMap<ValueType>::mergeLastTwoRuns() {
+            Run second = std::move(runs.back());
+            runs.pop_back();
+            Run first = std::move(runs.back());
+            runs.pop_back();
+
+            Run merged{detail::createTemporaryFilename(directory), first.size + second.size, std::vector<uint64_t>()};
+            {
+                detail::RunReader<ValueType> firstReader(first.filename, wordsPerKey, first.size);
+                detail::RunReader<ValueType> secondReader(second.filename, wordsPerKey, second.size);
+                detail::RunWriter<ValueType> writer(merged.filename, wordsPerKey);
+                bool firstHasEntry = firstReader.next();
+                bool secondHasEntry = secondReader.next();
+                while (firstHasEntry || secondHasEntry) {
+                    if (!secondHasEntry || (firstHasEntry && detail::compareKeys(firstReader.key.data(), secondReader.key.data(), wordsPerKey) < 0)) {
+                        writer.write(firstReader.key.data(), firstReader.value);
+                        firstHasEntry = firstReader.next();
+                    } else {
+                        writer.write(secondReader.key.data(), secondReader.value);
+                        secondHasEntry = secondReader.next();
+                    }
+                }
+                writer.close();
+                merged.blockKeyWords = std::move(writer.blockKeyWords);
+            }
+            boost::filesystem::remove(first.filename);
+            boost::filesystem::remove(second.filename);
+            runs.push_back(std::move(merged));
+        }
+
+        ExternalBitVectorList::ExternalBitVectorList(uint64_t bucketSize, std::string const& directory) : wordsPerBitVector(bucketSize / 64), filename(detail::createTemporaryFilename(directory)), numberOfBitVectors(0), numberOfReadBitVectors(0), buffer(detail::streamBufferSize), words(bucketSize / 64) {
+            STORM_LOG_THROW(bucketSize % 64 == 0, storm::exceptions::InvalidArgumentException, "Bucket size must be a multiple of 64.");
+            output.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+            output.open(filename, std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(output.good(), storm::exceptions::FileIoException, "Unable to create file '" << filename << "'.");
+        }
+
+        ExternalBitVectorList::~ExternalBitVectorList() {
+            output.close();
+            input.close();
+            boost::system::error_code error;
+            boost::filesystem::remove(filename, error);
+        }
+
+        void ExternalBitVectorList::push_back(storm::storage::BitVector const& bitVector) {
+            STORM_LOG_THROW(output.is_open(), storm::exceptions::InvalidOperationException, "Unable to append to a list that is being read.");
+            for (uint64_t word = 0; word < wordsPerBitVector; ++word) {
+                words[word] = bitVector.getAsInt(word * 64, 64);
+            }
+            output.write(reinterpret_cast<char const*>(words.data()), wordsPerBitVector * sizeof(uint64_t));
+            ++numberOfBitVectors;
+        }
+
+        bool ExternalBitVectorList::readNext(storm::storage::BitVector& bitVector) {
+            if (output.is_open()) {
+                output.close();
+                STORM_LOG_THROW(!output.fail(), storm::exceptions::FileIoException, "Unable to write file '" << filename << "'.");
+                input.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+                input.open(filename, std::ios::binary);
+                STORM_LOG_THROW(input.good(), storm::exceptions::FileIoException, "Unable to read file '" << filename << "'.");
+            }
+            if (numberOfReadBitVectors == numberOfBitVectors) {
+                return false;
+            }
+            input.read(reinterpret_cast<char*>(words.data()), wordsPerBitVector * sizeof(uint64_t));
+            STORM_LOG_THROW(input.good(), storm::exceptions::FileIoException, "Unable to read file '" << filename << "'.");
+            for (uint64_t word = 0; word < wordsPerBitVector; ++word) {
+                bitVector.setFromInt(word * 64, 64, words[word]);
+            }
+            ++numberOfReadBitVectors;
+            return true;
+        }
+
+        uint64_t ExternalBitVectorList::size() const {
+            return numberOfBitVectors;
+        }
+
+        bool ExternalBitVectorList::empty() const {
+            return numberOfBitVectors == 0;
+        }
+
+        template class ExternalBitVectorMap<uint32_t>;
+        template class ExternalBitVectorMap<uint64_t>;
+    }
+}
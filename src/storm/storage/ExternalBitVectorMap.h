@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * This class represents a map from bit vectors to values whose entries are stored in files rather than in
+         * memory. The keys must be bit vectors with a length that is a multiple of 64.
+         *
+         * The map is meant for delayed duplicate detection: instead of querying single keys, a sorted batch of keys is
+         * looked up at once by merging it with the sorted runs of entries stored in the files. Each insertion of a
+         * batch creates a new run and runs of similar size are merged, so the number of runs (and thereby the cost of
+         * a lookup) stays logarithmic in the number of entries.
+         *
+         * Keys are passed as consecutive 64-bit words, i.e. the i-th word of the j-th key is the value of the bits
+         * [64 * i, 64 * (i + 1)) of the key.
+         */
+        template<typename ValueType>
+        class ExternalBitVectorMap {
+        public:
+            /*!
+             * Creates an empty map.
+             *
+             * @param bucketSize The size of the keys. This value must be a multiple of 64.
+             * @param directory The directory in which the files storing the entries are created.
+             */
+            ExternalBitVectorMap(uint64_t bucketSize, std::string const& directory);
+
+            ~ExternalBitVectorMap();
+
+            ExternalBitVectorMap(ExternalBitVectorMap const&) = delete;
+            ExternalBitVectorMap& operator=(ExternalBitVectorMap const&) = delete;
+
+            /*!
+             * Sorts the given keys (and the values associated with them) in the order that is required for lookups and
+             * insertions.
+             *
+             * @param keyWords The words of the keys.
+             * @param values The values associated with the keys. They are permuted along with the keys.
+             */
+            void sort(std::vector<uint64_t>& keyWords, std::vector<ValueType>& values) const;
+
+            /*!
+             * Looks up the given keys.
+             *
+             * @param sortedKeyWords The words of the keys. The keys must be sorted (see sort) and distinct.
+             * @param values Is set to the values of the keys or to the given value for keys that are not contained.
+             * @param notFoundValue The value that is used for keys that are not contained.
+             */
+            void find(std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType>& values, ValueType const& notFoundValue) const;
+
+            /*!
+             * Inserts the given entries into the map.
+             *
+             * @param sortedKeyWords The words of the keys. The keys must be sorted (see sort), distinct and must not be
+             * contained in the map.
+             * @param values The values of the keys.
+             */
+            void add(std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType> const& values);
+
+            /*!
+             * Calls the given function for all entries of the map (in no particular order).
+             */
+            void forEach(std::function<void (storm::storage::BitVector const&, ValueType const&)> const& function) const;
+
+            /*!
+             * Retrieves the number of entries of the map.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the number of words of each key.
+             */
+            uint64_t getNumberOfWordsPerKey() const;
+
+        private:
+            // A file storing entries sorted by their keys. The first key of each block of entries is kept in memory to
+            // find the block that may contain a key.
+            struct Run {
+                std::string filename;
+                uint64_t size;
+                std::vector<uint64_t> blockKeyWords;
+            };
+
+            /*!
+             * Writes the given (sorted) entries into a new run.
+             */
+            Run createRun(uint64_t const* sortedKeyWords, ValueType const* values, uint64_t numberOfEntries) const;
+
+            /*!
+             * Looks up the given keys in the given run and sets the values of the keys that are found.
+             */
+            void searchRun(Run const& run, std::vector<uint64_t> const& sortedKeyWords, std::vector<ValueType>& values) const;
+
+            /*!
+             * Merges the two most recently created runs.
+             */
+            void mergeLastTwoRuns();
+
+            // The number of words of each key.
+            uint64_t wordsPerKey;
+
+            // The directory in which the runs are stored.
+            std::string directory;
+
+            // The runs, from the oldest to the most recent one.
+            std::vector<Run> runs;
+
+            // The number of entries in all runs.
+            uint64_t numberOfEntries;
+        };
+
+        /*!
+         * This class represents a list of bit vectors (of a fixed size that is a multiple of 64) that is stored in a
+         * file. Bit vectors are first appended to the list and then read in the order in which they were appended.
+         */
+        class ExternalBitVectorList {
+        public:
+            /*!
+             * Creates an empty list.
+             *
+             * @param bucketSize The size of the bit vectors. This value must be a multiple of 64.
+             * @param directory The directory in which the file storing the list is created.
+             */
+            ExternalBitVectorList(uint64_t bucketSize, std::string const& directory);
+
+            ~ExternalBitVectorList();
+
+            ExternalBitVectorList(ExternalBitVectorList const&) = delete;
+            ExternalBitVectorList& operator=(ExternalBitVectorList const&) = delete;
+
+            /*!
+             * Appends the given bit vector to the list. This is only possible before the list is read.
+             */
+            void push_back(storm::storage::BitVector const& bitVector);
+
+            /*!
+             * Retrieves the next bit vector of the list. After the first call, no bit vectors can be appended.
+             *
+             * @param bitVector Is set to the next bit vector.
+             * @return False iff all bit vectors have been read.
+             */
+            bool readNext(storm::storage::BitVector& bitVector);
+
+            /*!
+             * Retrieves the number of bit vectors of the list.
+             */
+            uint64_t size() const;
+
+            /*!
+             * Retrieves whether the list is empty.
+             */
+            bool empty() const;
+
+        private:
+            // The number of words of each bit vector.
+            uint64_t wordsPerBitVector;
+
+            // The file storing the list.
+            std::string filename;
+
+            // The streams used to write or read the file.
+            std::ofstream output;
+            std::ifstream input;
+
+            // The number of bit vectors in the list and the number of bit vectors that were already read.
+            uint64_t numberOfBitVectors;
+            uint64_t numberOfReadBitVectors;
+
+            // Buffers for the streams and the words of one bit vector.
+            std::vector<char> buffer;
+            std::vector<uint64_t> words;
+        };
+
+    }
+}
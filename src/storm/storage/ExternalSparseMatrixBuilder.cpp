@@ -0,0 +1,181 @@
+#include "storm/storage/ExternalSparseMatrixBuilder.h"
+
+#include <type_traits>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        namespace detail {
+            // The size of the buffer of the file stream.
+            static const uint64_t matrixStreamBufferSize = 1ull << 20;
+
+            // The number of entries that are read from the file at once.
+            static const uint64_t matrixReadBlockSize = 1ull << 16;
+        }
+
+        template<typename ValueType>
+        ExternalSparseMatrixBuilder<ValueType>::ExternalSparseMatrixBuilder(std::string const& directory, bool hasCustomRowGrouping) : buffer(detail::matrixStreamBufferSize), hasCustomRowGrouping(hasCustomRowGrouping), rowIndications(), rowGroupIndices(), hasPendingEntry(false), pendingColumn(0), pendingValue(), currentEntryCount(0), lastRow(0), lastColumn(0), highestColumn(0), currentRowGroupCount(0) {
+            STORM_LOG_THROW(std::is_arithmetic<ValueType>::value, storm::exceptions::NotSupportedException, "Storing matrix entries in a file is only supported for numeric value types.");
+            STORM_LOG_THROW(boost::filesystem::is_directory(directory), storm::exceptions::InvalidArgumentException, "The directory '" << directory << "' does not exist.");
+            filename = (boost::filesystem::path(directory) / boost::filesystem::unique_path("storm-%%%%-%%%%-%%%%-%%%%.tmp")).string();
+            output.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+            output.open(filename, std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(output.good(), storm::exceptions::FileIoException, "Unable to create file '" << filename << "'.");
+
+            if (hasCustomRowGrouping) {
+                rowGroupIndices = std::vector<index_type>();
+            }
+            rowIndications.push_back(0);
+        }
+
+        template<typename ValueType>
+        ExternalSparseMatrixBuilder<ValueType>::~ExternalSparseMatrixBuilder() {
+            output.close();
+            boost::system::error_code error;
+            boost::filesystem::remove(filename, error);
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::addNextValue(index_type row, index_type column, value_type const& value) {
+            // Check that we did not move backwards wrt. the row or (within the row) the column.
+            STORM_LOG_THROW(row >= lastRow, storm::exceptions::InvalidArgumentException, "Adding an element in row " << row << ", but an element in row " << lastRow << " has already been added.");
+            STORM_LOG_THROW(row != lastRow || !hasPendingEntry || column >= lastColumn, storm::exceptions::InvalidArgumentException, "Adding an element in column " << column << " of row " << row << ", but an element in column " << lastColumn << " has already been added.");
+
+            // If the element is in the same row and column as the previous entry, we add them up.
+            if (row == lastRow && column == lastColumn && hasPendingEntry) {
+                pendingValue += value;
+                return;
+            }
+
+            flushPendingEntry();
+
+            // If we switched to another row, we have to adjust the missing entries in the row indices vector.
+            for (index_type i = lastRow + 1; i <= row; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+            lastRow = row;
+            lastColumn = column;
+
+            hasPendingEntry = true;
+            pendingColumn = column;
+            pendingValue = value;
+            highestColumn = std::max(highestColumn, column);
+            ++currentEntryCount;
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::newRowGroup(index_type startingRow) {
+            STORM_LOG_THROW(hasCustomRowGrouping, storm::exceptions::InvalidStateException, "Matrix was not created to have a custom row grouping.");
+            STORM_LOG_THROW(startingRow >= lastRow, storm::exceptions::InvalidStateException, "Illegal row group with negative size.");
+            rowGroupIndices.get().push_back(startingRow);
+            ++currentRowGroupCount;
+
+            // Close all rows from the most recent one to the starting row.
+            for (index_type i = lastRow + 1; i < startingRow; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+
+            if (lastRow + 1 < startingRow) {
+                // Reset the most recently seen row/column to allow for proper insertion of the following elements.
+                flushPendingEntry();
+                lastRow = startingRow - 1;
+                lastColumn = 0;
+            }
+        }
+
+        template<typename ValueType>
+        typename ExternalSparseMatrixBuilder<ValueType>::index_type ExternalSparseMatrixBuilder<ValueType>::getCurrentRowGroupCount() const {
+            return currentRowGroupCount;
+        }
+
+        template<typename ValueType>
+        SparseMatrix<ValueType> ExternalSparseMatrixBuilder<ValueType>::build(index_type overriddenRowCount, index_type overriddenColumnCount, index_type overriddenRowGroupCount) {
+            flushPendingEntry();
+            output.close();
+            STORM_LOG_THROW(!output.fail(), storm::exceptions::FileIoException, "Unable to write file '" << filename << "'.");
+
+            bool hasEntries = currentEntryCount != 0;
+            index_type rowCount = hasEntries ? lastRow + 1 : 0;
+
+            // If the last row group was empty, we need to add one more to the row count, because otherwise this empty row is not counted.
+            if (hasCustomRowGrouping && !rowGroupIndices->empty()) {
+                if (lastRow < rowGroupIndices->back()) {
+                    ++rowCount;
+                }
+            }
+            rowCount = std::max(rowCount, overriddenRowCount);
+
+            // If the current row count was overridden, we may need to add empty rows.
+            for (index_type i = lastRow + 1; i < rowCount; ++i) {
+                rowIndications.push_back(currentEntryCount);
+            }
+
+            // Put a sentinel element at the last position of the row indices array (as the SparseMatrixBuilder does).
+            if (rowCount > 0) {
+                rowIndications.push_back(currentEntryCount);
+            }
+            STORM_LOG_ASSERT(rowCount == rowIndications.size() - 1, "Wrong sizes of vectors: " << rowCount << " != " << (rowIndications.size() - 1) << ".");
+            index_type columnCount = std::max(hasEntries ? highestColumn + 1 : 0, overriddenColumnCount);
+
+            if (hasCustomRowGrouping) {
+                index_type rowGroupCount = std::max(currentRowGroupCount, overriddenRowGroupCount);
+                for (index_type i = currentRowGroupCount; i <= rowGroupCount; ++i) {
+                    rowGroupIndices.get().push_back(rowCount);
+                }
+            }
+
+            // Read back the entries into storage of the exact size.
+            std::vector<MatrixEntry<index_type, value_type>> columnsAndValues;
+            columnsAndValues.reserve(currentEntryCount);
+            {
+                std::ifstream input;
+                input.rdbuf()->pubsetbuf(buffer.data(), buffer.size());
+                input.open(filename, std::ios::binary);
+                STORM_LOG_THROW(input.good(), storm::exceptions::FileIoException, "Unable to read file '" << filename << "'.");
+                std::vector<index_type> columns(detail::matrixReadBlockSize);
+                std::vector<value_type> values(detail::matrixReadBlockSize);
+                for (index_type entry = 0; entry < currentEntryCount; entry += detail::matrixReadBlockSize) {
+                    index_type blockSize = std::min(currentEntryCount - entry, static_cast<index_type>(detail::matrixReadBlockSize));
+                    for (index_type position = 0; position < blockSize; ++position) {
+                        input.read(reinterpret_cast<char*>(&columns[position]), sizeof(index_type));
+                        input.read(reinterpret_cast<char*>(&values[position]), sizeof(value_type));
+                    }
+                    STORM_LOG_THROW(input.good(), storm::exceptions::FileIoException, "Unable to read file '" << filename << "'.");
+                    for (index_type position = 0; position < blockSize; ++position) {
+                        columnsAndValues.emplace_back(columns[position], values[position]);
+                    }
+                }
+            }
+            boost::system::error_code error;
+            boost::filesystem::remove(filename, error);
+
+            return SparseMatrix<ValueType>(columnCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+        }
+
+        template<typename ValueType>
+        void ExternalSparseMatrixBuilder<ValueType>::flushPendingEntry() {
+            if (hasPendingEntry) {
+                output.write(reinterpret_cast<char const*>(&pendingColumn), sizeof(index_type));
+                output.write(reinterpret_cast<char const*>(&pendingValue), sizeof(value_type));
+                hasPendingEntry = false;
+            }
+        }
+
+        template class ExternalSparseMatrixBuilder<double>;
+
+#ifdef STORM_HAVE_CARL
+        template class ExternalSparseMatrixBuilder<storm::RationalNumber>;
+        template class ExternalSparseMatrixBuilder<storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A class that can be used to build a sparse matrix by adding value by value, similar to the
+         * SparseMatrixBuilder. However, the entries of the matrix are written to a file while building, so the memory
+         * only needs to hold the row (group) indices while building. The resulting matrix, however, is an ordinary
+         * (in-memory) sparse matrix: its entries are read back into storage that is allocated with the exact size of
+         * the matrix.
+         *
+         * Entries must be added row by row and, within each row, with non-decreasing columns. Entries with the same row
+         * and column are added up. Only matrices with numeric value types (such as double) are supported.
+         */
+        template<typename ValueType>
+        class ExternalSparseMatrixBuilder {
+        public:
+            typedef SparseMatrixIndexType index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Constructs a builder that writes the entries of the matrix to a file in the given directory.
+             *
+             * @param directory The directory in which the file storing the entries is created.
+             * @param hasCustomRowGrouping A flag indicating whether the matrix has a custom row grouping.
+             */
+            ExternalSparseMatrixBuilder(std::string const& directory, bool hasCustomRowGrouping = false);
+
+            ~ExternalSparseMatrixBuilder();
+
+            ExternalSparseMatrixBuilder(ExternalSparseMatrixBuilder const&) = delete;
+            ExternalSparseMatrixBuilder& operator=(ExternalSparseMatrixBuilder const&) = delete;
+
+            /*!
+             * Sets the matrix entry at the given row and column to the given value. Rows must be non-decreasing and,
+             * within a row, columns must be non-decreasing.
+             *
+             * @param row The row in which the matrix entry is to be set.
+             * @param column The column in which the matrix entry is to be set.
+             * @param value The value that is to be set at the specified row and column.
+             */
+            void addNextValue(index_type row, index_type column, value_type const& value);
+
+            /*!
+             * Starts a new row group in the matrix. Note that this needs to be called before any entries in the new row
+             * group are added.
+             *
+             * @param startingRow The starting row of the new row group.
+             */
+            void newRowGroup(index_type startingRow);
+
+            /*!
+             * Retrieves the number of row groups that were started so far.
+             */
+            index_type getCurrentRowGroupCount() const;
+
+            /*!
+             * Finalizes the matrix by reading back its entries and returns it. The returned matrix is held in memory
+             * completely. Afterwards, the builder must not be used anymore.
+             *
+             * @param overriddenRowCount If this is greater than the actual number of rows, empty rows are appended.
+             * @param overriddenColumnCount If this is greater than the actual number of columns, the matrix has this
+             * many columns.
+             * @param overriddenRowGroupCount If this is greater than the actual number of row groups, empty row groups
+             * are appended.
+             */
+            SparseMatrix<value_type> build(index_type overriddenRowCount = 0, index_type overriddenColumnCount = 0, index_type overriddenRowGroupCount = 0);
+
+        private:
+            /*!
+             * Writes the pending entry (if any) to the file.
+             */
+            void flushPendingEntry();
+
+            // The file storing the entries and the stream writing to it.
+            std::string filename;
+            std::vector<char> buffer;
+            std::ofstream output;
+
+            // Flags indicating whether the matrix has a custom row grouping.
+            bool hasCustomRowGrouping;
+
+            // The row indications and (if any) row group indices of the matrix.
+            std::vector<index_type> rowIndications;
+            boost::optional<std::vector<index_type>> rowGroupIndices;
+
+            // The most recently added entry, which is kept in memory to add up entries with the same column.
+            bool hasPendingEntry;
+            index_type pendingColumn;
+            value_type pendingValue;
+
+            // Stores the number of entries (including the pending one).
+            index_type currentEntryCount;
+
+            // Stores the row and column of the most recently added entry.
+            index_type lastRow;
+            index_type lastColumn;
+
+            // Stores the highest column of all entries.
+            index_type highestColumn;
+
+            // Stores the number of row groups that were started.
+            index_type currentRowGroupCount;
+        };
+
+    }
+}
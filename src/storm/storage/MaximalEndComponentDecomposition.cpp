@@ -1,12 +1,13 @@
-#include <list>
-#include <queue>
-#include <numeric>
+#include <algorithm>
+#include <limits>
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
+#include "storm/utility/macros.h"
+
 namespace storm {
     namespace storage {
         
@@ -63,23 +64,342 @@ namespace storm {
             return *this;
         }
         
+        namespace detail {
+            // The block of states that are not (or no longer) part of any end component candidate.
+            uint64_t const noBlock = std::numeric_limits<uint64_t>::max();
+
+            /*!
+             * Refines candidate blocks of states into maximal end components. The refinement maintains the invariant that
+             * every state of a block has at least one included choice and that all included choices of a state only lead
+             * to states of the same block. Under this invariant, a block is an MEC iff it is strongly connected (with
+             * respect to the included choices).
+             *
+             * A block that is not known to be strongly connected is split by a lock-step forward/backward search from some
+             * pivot state. As soon as one of the searches converges, the visited states form a set that is closed under
+             * successors (or predecessors, respectively) within the block, so the block can be split along this set.
+             * Running both searches in lock-step bounds the work of a split by twice the size of the split-off part. Only
+             * blocks that lost states or were split are searched again, so the strongly connected parts are maintained
+             * incrementally instead of being recomputed from scratch.
+             */
+            template <typename ValueType>
+            class EndComponentRefinement {
+            public:
+                EndComponentRefinement(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector& includedChoices) : transitionMatrix(transitionMatrix), backwardTransitions(backwardTransitions), rowGroupIndices(transitionMatrix.getRowGroupIndices()), includedChoices(includedChoices), stateToBlock(transitionMatrix.getRowGroupCount(), noBlock), forwardVisited(transitionMatrix.getRowGroupCount()), backwardVisited(transitionMatrix.getRowGroupCount()) {
+                    // Intentionally left empty.
+                }
+
+                /*!
+                 * Adds a block of states that is to be refined. The states must not be part of any other block.
+                 */
+                template <typename InputIterator>
+                void addBlock(InputIterator first, InputIterator last) {
+                    uint64_t block = blocks.size();
+                    blocks.emplace_back(first, last);
+                    blockOrigins.push_back(block);
+                    blockQueued.resize(blocks.size());
+                    for (auto state : blocks.back()) {
+                        STORM_LOG_ASSERT(stateToBlock[state] == noBlock, "State " << state << " is part of two blocks.");
+                        stateToBlock[state] = block;
+                    }
+                    queueBlock(block);
+                }
+
+                /*!
+                 * Refines all added blocks until they are maximal end components.
+                 */
+                void refine() {
+                    // First establish the invariant for the added blocks.
+                    for (uint64_t block = 0; block < blocks.size(); ++block) {
+                        for (auto state : blocks[block]) {
+                            if (stateToBlock[state] == block) {
+                                excludeLeavingChoices(state);
+                            }
+                        }
+                    }
+                    removeScheduledStates();
+
+                    while (!blocksToRefine.empty()) {
+                        uint64_t block = blocksToRefine.back();
+                        blocksToRefine.pop_back();
+                        blockQueued.set(block, false);
+                        refineBlock(block);
+                    }
+                }
+
+                /*!
+                 * Retrieves the non-empty (refined) blocks with their states in ascending order. The blocks are ordered by
+                 * the added block they were obtained from and then by their smallest state.
+                 */
+                std::vector<std::vector<uint64_t>> getBlocks() {
+                    std::vector<uint64_t> blockOrder;
+                    for (uint64_t block = 0; block < blocks.size(); ++block) {
+                        compactBlock(block);
+                        if (!blocks[block].empty()) {
+                            std::sort(blocks[block].begin(), blocks[block].end());
+                            blockOrder.push_back(block);
+                        }
+                    }
+                    std::sort(blockOrder.begin(), blockOrder.end(), [this] (uint64_t first, uint64_t second) { return blockOrigins[first] < blockOrigins[second] || (blockOrigins[first] == blockOrigins[second] && blocks[first].front() < blocks[second].front()); });
+
+                    std::vector<std::vector<uint64_t>> result;
+                    result.reserve(blockOrder.size());
+                    for (auto block : blockOrder) {
+                        result.push_back(std::move(blocks[block]));
+                    }
+                    return result;
+                }
+
+            private:
+                void queueBlock(uint64_t block) {
+                    if (!blockQueued.get(block)) {
+                        blockQueued.set(block);
+                        blocksToRefine.push_back(block);
+                    }
+                }
+
+                /*!
+                 * Drops the states from the state list of the given block that are no longer part of it.
+                 */
+                void compactBlock(uint64_t block) {
+                    auto& states = blocks[block];
+                    states.erase(std::remove_if(states.begin(), states.end(), [&] (uint64_t state) { return stateToBlock[state] != block; }), states.end());
+                }
+
+                /*!
+                 * Excludes all choices of the given state that may leave its block. If no choice remains, the state is
+                 * scheduled for removal.
+                 */
+                void excludeLeavingChoices(uint64_t state) {
+                    uint64_t block = stateToBlock[state];
+                    bool choiceRemains = false;
+                    for (uint64_t choice = includedChoices.getNextSetIndex(rowGroupIndices[state]); choice < rowGroupIndices[state + 1]; choice = includedChoices.getNextSetIndex(choice + 1)) {
+                        for (auto const& entry : transitionMatrix.getRow(choice)) {
+                            if (stateToBlock[entry.getColumn()] != block && !storm::utility::isZero(entry.getValue())) {
+                                includedChoices.set(choice, false);
+                                break;
+                            }
+                        }
+                        choiceRemains |= includedChoices.get(choice);
+                    }
+                    if (!choiceRemains) {
+                        stateToBlock[state] = noBlock;
+                        statesToRemove.emplace_back(state, block);
+                    }
+                }
+
+                /*!
+                 * Removes the states that were scheduled for removal. The choices of other states of the same block that
+                 * lead to removed states are excluded, which may in turn schedule the removal of further states.
+                 */
+                void removeScheduledStates() {
+                    while (!statesToRemove.empty()) {
+                        uint64_t state = statesToRemove.back().first;
+                        uint64_t block = statesToRemove.back().second;
+                        statesToRemove.pop_back();
+                        queueBlock(block);
+                        for (auto const& entry : backwardTransitions.getRow(state)) {
+                            if (stateToBlock[entry.getColumn()] == block) {
+                                excludeLeavingChoices(entry.getColumn());
+                            }
+                        }
+                    }
+                }
+
+                /*!
+                 * Retrieves whether the given predecessor state has an included choice that leads to the given state.
+                 */
+                bool hasIncludedChoiceInto(uint64_t predecessor, uint64_t state) const {
+                    for (uint64_t choice = includedChoices.getNextSetIndex(rowGroupIndices[predecessor]); choice < rowGroupIndices[predecessor + 1]; choice = includedChoices.getNextSetIndex(choice + 1)) {
+                        auto row = transitionMatrix.getRow(choice);
+                        auto entryIt = std::lower_bound(row.begin(), row.end(), state, [] (storm::storage::MatrixEntry<typename storm::storage::SparseMatrix<ValueType>::index_type, ValueType> const& entry, uint64_t column) { return entry.getColumn() < column; });
+                        if (entryIt != row.end() && entryIt->getColumn() == state && !storm::utility::isZero(entryIt->getValue())) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                /*!
+                 * Performs one step of the forward search within the given block. Returns false iff the search converged.
+                 */
+                bool forwardStep(uint64_t block) {
+                    if (forwardStack.empty()) {
+                        return false;
+                    }
+                    uint64_t state = forwardStack.back();
+                    forwardStack.pop_back();
+                    for (uint64_t choice = includedChoices.getNextSetIndex(rowGroupIndices[state]); choice < rowGroupIndices[state + 1]; choice = includedChoices.getNextSetIndex(choice + 1)) {
+                        for (auto const& entry : transitionMatrix.getRow(choice)) {
+                            if (!forwardVisited.get(entry.getColumn()) && !storm::utility::isZero(entry.getValue())) {
+                                STORM_LOG_ASSERT(stateToBlock[entry.getColumn()] == block, "Included choice " << choice << " leaves its block.");
+                                forwardVisited.set(entry.getColumn());
+                                forwardStates.push_back(entry.getColumn());
+                                forwardStack.push_back(entry.getColumn());
+                            }
+                        }
+                    }
+                    return true;
+                }
+
+                /*!
+                 * Performs one step of the backward search within the given block. Returns false iff the search converged.
+                 */
+                bool backwardStep(uint64_t block) {
+                    if (backwardStack.empty()) {
+                        return false;
+                    }
+                    uint64_t state = backwardStack.back();
+                    backwardStack.pop_back();
+                    for (auto const& entry : backwardTransitions.getRow(state)) {
+                        uint64_t predecessor = entry.getColumn();
+                        if (!backwardVisited.get(predecessor) && stateToBlock[predecessor] == block && hasIncludedChoiceInto(predecessor, state)) {
+                            backwardVisited.set(predecessor);
+                            backwardStates.push_back(predecessor);
+                            backwardStack.push_back(predecessor);
+                        }
+                    }
+                    return true;
+                }
+
+                /*!
+                 * Moves the given states to a new block and re-establishes the invariant for the given block and the new
+                 * one.
+                 *
+                 * @param states The states to split off. They need to be closed under successors or under predecessors
+                 * within the block.
+                 * @param closedUnderSuccessors If true, the states are closed under successors and otherwise they are
+                 * closed under predecessors.
+                 */
+                void splitBlock(uint64_t block, std::vector<uint64_t>&& states, bool closedUnderSuccessors) {
+                    uint64_t newBlock = blocks.size();
+                    for (auto state : states) {
+                        stateToBlock[state] = newBlock;
+                    }
+                    blocks.push_back(std::move(states));
+                    blockOrigins.push_back(blockOrigins[block]);
+                    blockQueued.resize(blocks.size());
+
+                    // Choices can only cross the border of the split-off part in one direction, so it suffices to
+                    // consider the split-off part.
+                    if (closedUnderSuccessors) {
+                        for (auto state : blocks[newBlock]) {
+                            for (auto const& entry : backwardTransitions.getRow(state)) {
+                                if (stateToBlock[entry.getColumn()] == block) {
+                                    excludeLeavingChoices(entry.getColumn());
+                                }
+                            }
+                        }
+                    } else {
+                        for (auto state : blocks[newBlock]) {
+                            if (stateToBlock[state] == newBlock) {
+                                excludeLeavingChoices(state);
+                            }
+                        }
+                    }
+                    removeScheduledStates();
+
+                    queueBlock(block);
+                    queueBlock(newBlock);
+                }
+
+                /*!
+                 * Checks whether the given block is strongly connected and splits it if it is not.
+                 */
+                void refineBlock(uint64_t block) {
+                    compactBlock(block);
+                    std::vector<uint64_t> const& states = blocks[block];
+
+                    // By the invariant, single states are MECs.
+                    if (states.size() <= 1) {
+                        return;
+                    }
+
+                    uint64_t pivot = states.front();
+                    forwardVisited.set(pivot);
+                    forwardStates.push_back(pivot);
+                    forwardStack.push_back(pivot);
+                    backwardVisited.set(pivot);
+                    backwardStates.push_back(pivot);
+                    backwardStack.push_back(pivot);
+
+                    // Search in lock-step until one of the searches converges.
+                    bool forwardConverged = false;
+                    while (true) {
+                        if (!forwardStep(block)) {
+                            forwardConverged = true;
+                            break;
+                        }
+                        if (!backwardStep(block)) {
+                            break;
+                        }
+                    }
+
+                    // If the converged search did not visit the whole block, we split the block along its states.
+                    // Otherwise, we let the other search converge as well, which then decides the block.
+                    bool splitForward = forwardConverged;
+                    if ((forwardConverged ? forwardStates.size() : backwardStates.size()) == states.size()) {
+                        if (forwardConverged) {
+                            while (backwardStep(block)) {}
+                        } else {
+                            while (forwardStep(block)) {}
+                        }
+                        splitForward = !forwardConverged;
+                    }
+                    std::vector<uint64_t> splitStates = splitForward ? forwardStates : backwardStates;
+
+                    for (auto state : forwardStates) {
+                        forwardVisited.set(state, false);
+                    }
+                    for (auto state : backwardStates) {
+                        backwardVisited.set(state, false);
+                    }
+                    forwardStates.clear();
+                    forwardStack.clear();
+                    backwardStates.clear();
+                    backwardStack.clear();
+
+                    if (splitStates.size() < states.size()) {
+                        splitBlock(block, std::move(splitStates), splitForward);
+                    }
+                }
+
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix;
+                storm::storage::SparseMatrix<ValueType> const& backwardTransitions;
+                std::vector<uint_fast64_t> const& rowGroupIndices;
+                storm::storage::BitVector& includedChoices;
+
+                // The states of each block. The list of a block may contain states that were removed from the block
+                // afterwards. The block a state belongs to is given by the state-to-block mapping.
+                std::vector<std::vector<uint64_t>> blocks;
+                std::vector<uint64_t> stateToBlock;
+
+                // For each block, the added block it was obtained from.
+                std::vector<uint64_t> blockOrigins;
+
+                // The blocks that need to be checked for strong connectivity.
+                std::vector<uint64_t> blocksToRefine;
+                storm::storage::BitVector blockQueued;
+
+                // The states that are scheduled for removal together with the block they were removed from.
+                std::vector<std::pair<uint64_t, uint64_t>> statesToRemove;
+
+                // Data of the lock-step search.
+                storm::storage::BitVector forwardVisited;
+                storm::storage::BitVector backwardVisited;
+                std::vector<uint64_t> forwardStates;
+                std::vector<uint64_t> backwardStates;
+                std::vector<uint64_t> forwardStack;
+                std::vector<uint64_t> backwardStack;
+            };
+        }
+
         template <typename ValueType>
-        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
+        void MaximalEndComponentDecomposition<ValueType>::performMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
             // Get some data for convenient access.
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
             std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
-            
-            // Initialize the maximal end component list to be the full state space.
-            std::list<StateBlock> endComponentStateSets;
-            if (states) {
-                endComponentStateSets.emplace_back(states->begin(), states->end(), true);
-            } else {
-                std::vector<storm::storage::sparse::state_type> allStates;
-                allStates.resize(transitionMatrix.getRowGroupCount());
-                std::iota(allStates.begin(), allStates.end(), 0);
-                endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
-            }
-            storm::storage::BitVector statesToCheck(numberOfStates);
+
+            storm::storage::BitVector subsystem = states ? *states : storm::storage::BitVector(numberOfStates, true);
             storm::storage::BitVector includedChoices;
             if (choices) {
                 includedChoices = *choices;
@@ -93,135 +413,40 @@ namespace storm {
             } else {
                 includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
             }
-            storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
-                        
-            for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-                StateBlock const& mec = *mecIterator;
-                currMecAsBitVector.clear();
-                currMecAsBitVector.set(mec.begin(), mec.end(), true);
-                // Keep track of whether the MEC changed during this iteration.
-                bool mecChanged = false;
-                
-                // Get an SCC decomposition of the current MEC candidate.
-                
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
-                
-                // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-                // the MEC canditate itself.
-                mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
-                
-                // Check for each of the SCCs whether there is at least one action for each state that does not leave the SCC.
-                for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
-                    
-                    while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
-                        
-                        for (auto state : statesToCheck) {
-                            bool keepStateInMEC = false;
-                            
-                            for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                                
-                                // If the choice is not part of our subsystem, skip it.
-                                if (choices && !choices->get(choice)) {
-                                    continue;
-                                }
 
-                                // If the choice is not included any more, skip it.
-                                if (!includedChoices.get(choice)) {
-                                    continue;
-                                }
-                                
-                                bool choiceContainedInMEC = true;
-                                for (auto const& entry : transitionMatrix.getRow(choice)) {
-                                    if (storm::utility::isZero(entry.getValue())) {
-                                        continue;
-                                    }
-                                        
-                                    if (!scc.containsState(entry.getColumn())) {
-                                        includedChoices.set(choice, false);
-                                        choiceContainedInMEC = false;
-                                        break;
-                                    }
-                                }
-                                
-                                // If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                                if (choiceContainedInMEC) {
-                                    keepStateInMEC = true;
-                                }
-                            }
-                            
-                            if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
-                            }
-                        }
-                        
-                        // Now erase the states that have no option to stay inside the MEC with all successors.
-                        mecChanged |= !statesToRemove.empty();
-                        for (uint_fast64_t state : statesToRemove) {
-                            scc.erase(state);
-                        }
-                        
-                        // Now check which states should be reconsidered, because successors of them were removed.
-                        statesToCheck.clear();
-                        for (auto state : statesToRemove) {
-                            for (auto const& entry : backwardTransitions.getRow(state)) {
-                                if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
-                                }
-                            }
-                        }
-                    }
+            // The initial candidates are the non-trivial SCCs of the subsystem, which are then refined incrementally.
+            detail::EndComponentRefinement<ValueType> refinement(transitionMatrix, backwardTransitions, includedChoices);
+            {
+                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&subsystem).choices(&includedChoices).dropNaiveSccs());
+                for (auto const& scc : sccs) {
+                    refinement.addBlock(scc.begin(), scc.end());
                 }
-                
-                // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-                // the list instead.
-                if (mecChanged) {
-                    for (StronglyConnectedComponent& scc : sccs) {
-                        if (!scc.empty()) {
-                            endComponentStateSets.push_back(std::move(scc));
-                        }
-                    }
-                    
-                    std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-                    ++mecIterator;
-                    endComponentStateSets.erase(eraseIterator);
-                } else {
-                    // Otherwise, we proceed with the next MEC candidate.
-                    ++mecIterator;
-                }
-                
-            } // End of loop over all MEC candidates.
-            
+            }
+            refinement.refine();
+
             // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
             // contained in the MEC and store them as actual MECs.
+            std::vector<std::vector<uint64_t>> endComponentStateSets = refinement.getBlocks();
             this->blocks.reserve(endComponentStateSets.size());
             for (auto const& mecStateSet : endComponentStateSets) {
                 MaximalEndComponent newMec;
-                
+
                 for (auto state : mecStateSet) {
                     MaximalEndComponent::set_type containedChoices;
-                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // Skip the choice if it is not part of our subsystem. 
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
-                        
-                        if (includedChoices.get(choice)) {
-                            containedChoices.insert(choice);
-                        }
+                    for (uint_fast64_t choice = includedChoices.getNextSetIndex(nondeterministicChoiceIndices[state]); choice < nondeterministicChoiceIndices[state + 1]; choice = includedChoices.getNextSetIndex(choice + 1)) {
+                        containedChoices.insert(choice);
                     }
-                    
+
                     STORM_LOG_ASSERT(!containedChoices.empty(), "The contained choices of any state in an MEC must be non-empty.");
                     newMec.addState(state, std::move(containedChoices));
                 }
-                
+
                 this->blocks.emplace_back(std::move(newMec));
             }
-            
+
             STORM_LOG_DEBUG("MEC decomposition found " << this->size() << " MEC(s).");
         }
-        
+
         // Explicitly instantiate the MEC decomposition.
         template class MaximalEndComponentDecomposition<double>;
         template MaximalEndComponentDecomposition<double>::MaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<double> const& model);
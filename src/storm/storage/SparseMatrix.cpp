@@ -1543,6 +1543,79 @@ namespace storm {
         }
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            const_iterator it = this->begin(startRow);
+            for (index_type row = startRow; row < endRow; ++row) {
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (const_iterator ite = this->end(row); it != ite; ++it) {
+                    newValue += it->getValue() * vector[it->getColumn()];
+                }
+                result[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorBackwardBlock(index_type startRow, index_type endRow, std::vector<ValueType>& vector, std::vector<ValueType> const& outsideValues, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &outsideValues, "Vectors must not be aliased.");
+            for (index_type row = endRow; row > startRow;) {
+                --row;
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : this->getRow(row)) {
+                    index_type column = entry.getColumn();
+                    newValue += entry.getValue() * ((column >= startRow && column < endRow) ? vector[column] : outsideValues[column]);
+                }
+                vector[row] = newValue;
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorBatch(uint64_t batchSize, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            STORM_LOG_ASSERT(vector.size() == this->getColumnCount() * batchSize, "Vector block has unexpected size.");
+            STORM_LOG_ASSERT(result.size() == this->getRowCount() * batchSize, "Result block has unexpected size.");
+            auto resultIt = result.begin();
+            for (index_type row = 0; row < this->getRowCount(); ++row) {
+                auto rowResultIt = resultIt;
+                if (summand) {
+                    std::copy(summand->begin() + row * batchSize, summand->begin() + (row + 1) * batchSize, rowResultIt);
+                } else {
+                    std::fill(rowResultIt, rowResultIt + batchSize, storm::utility::zero<ValueType>());
+                }
+                resultIt += batchSize;
+                for (auto const& entry : this->getRow(row)) {
+                    auto vectorIt = vector.begin() + entry.getColumn() * batchSize;
+                    for (auto it = rowResultIt; it != resultIt; ++it, ++vectorIt) {
+                        *it += entry.getValue() * *vectorIt;
+                    }
+                }
+            }
+        }
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyWithVectorBatchBackward(uint64_t batchSize, std::vector<ValueType>& vector, std::vector<value_type> const* summand) const {
+            STORM_LOG_ASSERT(vector.size() == this->getRowCount() * batchSize, "Vector block has unexpected size.");
+            // The new values of a row must not be written before all of them are computed, since the row may have a
+            // self-loop.
+            std::vector<ValueType> newValues(batchSize);
+            for (index_type row = this->getRowCount(); row > 0;) {
+                --row;
+                if (summand) {
+                    std::copy(summand->begin() + row * batchSize, summand->begin() + (row + 1) * batchSize, newValues.begin());
+                } else {
+                    std::fill(newValues.begin(), newValues.end(), storm::utility::zero<ValueType>());
+                }
+                for (auto const& entry : this->getRow(row)) {
+                    auto vectorIt = vector.begin() + entry.getColumn() * batchSize;
+                    for (auto it = newValues.begin(), ite = newValues.end(); it != ite; ++it, ++vectorIt) {
+                        *it += entry.getValue() * *vectorIt;
+                    }
+                }
+                std::copy(newValues.begin(), newValues.end(), vector.begin() + row * batchSize);
+            }
+        }
+        
         template<typename ValueType>
         ValueType SparseMatrix<ValueType>::multiplyRowWithVector(index_type row, std::vector<ValueType> const& vector) const {
             ValueType result = storm::utility::zero<ValueType>();
@@ -1912,6 +1985,151 @@ namespace storm {
 #endif
 #endif
         
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceRange<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            } else {
+                multiplyAndReduceRange<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, summand, result, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            Compare compare;
+            
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+            
+            for (index_type group = startRowGroup; group < endRowGroup; ++group) {
+                uint64_t groupStart = rowGroupIndices[group];
+                uint64_t groupEnd = rowGroupIndices[group + 1];
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+                
+                ValueType currentValue = summand ? (*summand)[groupStart] : storm::utility::zero<ValueType>();
+                for (auto const& entry : this->getRow(groupStart)) {
+                    currentValue += entry.getValue() * vector[entry.getColumn()];
+                }
+                if (choices) {
+                    selectedChoice = 0;
+                    if ((*choices)[group] == 0) {
+                        oldSelectedChoiceValue = currentValue;
+                    }
+                }
+                
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (auto const& entry : this->getRow(row)) {
+                        newValue += entry.getValue() * vector[entry.getColumn()];
+                    }
+                    
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+                
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceRange(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<storm::RationalFunction> const& vector, std::vector<storm::RationalFunction> const* summand, std::vector<storm::RationalFunction>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
+        template<typename ValueType>
+        void SparseMatrix<ValueType>::multiplyAndReduceBackwardBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType>& vector, std::vector<ValueType> const& outsideValues, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices) const {
+            if (dir == OptimizationDirection::Minimize) {
+                multiplyAndReduceBackwardBlock<storm::utility::ElementLess<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, outsideValues, summand, choices);
+            } else {
+                multiplyAndReduceBackwardBlock<storm::utility::ElementGreater<ValueType>>(rowGroupIndices, startRowGroup, endRowGroup, vector, outsideValues, summand, choices);
+            }
+        }
+        
+        template<typename ValueType>
+        template<typename Compare>
+        void SparseMatrix<ValueType>::multiplyAndReduceBackwardBlock(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType>& vector, std::vector<ValueType> const& outsideValues, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(&vector != &outsideValues, "Vectors must not be aliased.");
+            Compare compare;
+            
+            auto multiplyRow = [&] (uint64_t row) {
+                ValueType result = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (auto const& entry : this->getRow(row)) {
+                    index_type column = entry.getColumn();
+                    result += entry.getValue() * ((column >= startRowGroup && column < endRowGroup) ? vector[column] : outsideValues[column]);
+                }
+                return result;
+            };
+            
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+            
+            for (index_type group = endRowGroup; group > startRowGroup;) {
+                --group;
+                uint64_t groupStart = rowGroupIndices[group];
+                uint64_t groupEnd = rowGroupIndices[group + 1];
+                
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+                
+                // As in the sequential backward variant, the rows of a group are processed from last to first.
+                uint64_t row = groupEnd - 1;
+                ValueType currentValue = multiplyRow(row);
+                if (choices) {
+                    selectedChoice = row - groupStart;
+                    if ((*choices)[group] == selectedChoice) {
+                        oldSelectedChoiceValue = currentValue;
+                    }
+                }
+                
+                while (row > groupStart) {
+                    --row;
+                    ValueType newValue = multiplyRow(row);
+                    
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+                
+                // Finally write value to target vector.
+                vector[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+        
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SparseMatrix<storm::RationalFunction>::multiplyAndReduceBackwardBlock(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<storm::RationalFunction>& vector, std::vector<storm::RationalFunction> const& outsideValues, std::vector<storm::RationalFunction> const* summand, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+        
         template<typename ValueType>
         void SparseMatrix<ValueType>::multiplyAndReduce(OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
             
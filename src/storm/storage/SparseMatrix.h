@@ -861,6 +861,58 @@ namespace storm {
             void multiplyWithVectorParallel(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
 #endif
             
+            /*!
+             * Performs the same multiplication as multiplyWithVector, but only for the rows in the given range. Only
+             * the entries of the result vector that correspond to these rows are written. The vector and the result
+             * must not be the same.
+             *
+             * @param startRow The first row to consider.
+             * @param endRow The first row that is not to be considered anymore.
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorRange(index_type startRow, index_type endRow, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Performs a Gauss-Seidel style (i.e. in-place and backward) multiplication restricted to the rows in the
+             * given range. For columns within the range, the (already updated) values of the given vector are used,
+             * whereas the values of all other columns are taken from the given vector of outside values. This way,
+             * several disjoint ranges can be processed concurrently on the same vector. The matrix is assumed to be
+             * square.
+             *
+             * @param startRow The first row to consider.
+             * @param endRow The first row that is not to be considered anymore.
+             * @param vector The vector with which to multiply the matrix. The entries corresponding to the rows in the
+             * range are overwritten with the result.
+             * @param outsideValues The values used for columns outside of the range. This vector must not be modified
+             * concurrently.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVectorBackwardBlock(index_type startRow, index_type endRow, std::vector<value_type>& vector, std::vector<value_type> const& outsideValues, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Multiplies the matrix with several vectors at once. The vectors are stored in a row-major block, i.e.,
+             * the entry of the k-th vector that belongs to column c is stored at index c * batchSize + k. This way,
+             * each matrix entry is only loaded once for all vectors. The result is stored in the same layout.
+             *
+             * @param batchSize The number of vectors.
+             * @param vector The block of vectors with which to multiply the matrix.
+             * @param result The block that is supposed to hold the results. It must not be the same as the input block.
+             * @param summand If given, this block of summands will be added to the results of the multiplication.
+             */
+            void multiplyWithVectorBatch(uint64_t batchSize, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+            
+            /*!
+             * Performs the same multiplication as multiplyWithVectorBatch, but in Gauss-Seidel style, i.e., in-place
+             * and backward. The matrix is assumed to be square.
+             *
+             * @param batchSize The number of vectors.
+             * @param vector The block of vectors with which to multiply the matrix. It is overwritten with the results.
+             * @param summand If given, this block of summands will be added to the results of the multiplication.
+             */
+            void multiplyWithVectorBatchBackward(uint64_t batchSize, std::vector<value_type>& vector, std::vector<value_type> const* summand = nullptr) const;
+            
             /*!
              * Multiplies the matrix with the given vector, reduces it according to the given direction and and writes
              * the result to the given result vector.
@@ -889,6 +941,46 @@ namespace storm {
             template<typename Compare>
             void multiplyAndReduceParallel(std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
 #endif
+            
+            /*!
+             * Performs the same operation as multiplyAndReduce, but only for the row groups in the given range. Only
+             * the entries of the result (and choice) vector that correspond to these row groups are written. The
+             * vector and the result must not be the same.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param startRowGroup The first row group to consider.
+             * @param endRowGroup The first row group that is not to be considered anymore.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector.
+             */
+            void multiplyAndReduceRange(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare>
+            void multiplyAndReduceRange(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const;
+            
+            /*!
+             * Performs a Gauss-Seidel style (i.e. in-place and backward) multiplication and reduction restricted to
+             * the row groups in the given range. For columns that correspond to row groups within the range, the
+             * (already updated) values of the given vector are used, whereas the values of all other columns are
+             * taken from the given vector of outside values. This way, several disjoint ranges can be processed
+             * concurrently on the same vector.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups for the reduction
+             * @param startRowGroup The first row group to consider.
+             * @param endRowGroup The first row group that is not to be considered anymore.
+             * @param vector The vector with which to multiply the matrix. The entries corresponding to the row groups
+             * in the range are overwritten with the result.
+             * @param outsideValues The values used for columns outside of the range. This vector must not be modified
+             * concurrently.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param choices If given, the choices made in the reduction process will be written to this vector.
+             */
+            void multiplyAndReduceBackwardBlock(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType>& vector, std::vector<ValueType> const& outsideValues, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare>
+            void multiplyAndReduceBackwardBlock(std::vector<uint64_t> const& rowGroupIndices, index_type startRowGroup, index_type endRowGroup, std::vector<ValueType>& vector, std::vector<ValueType> const& outsideValues, std::vector<ValueType> const* summand, std::vector<uint_fast64_t>* choices) const;
 
             /*!
              * Multiplies a single row of the matrix with the given vector and returns the result
@@ -0,0 +1,305 @@
+#include "storm/storage/SplitSparseMatrix.h"
+
+#include <limits>
+
+#include "storm/storage/SparseMatrix.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType, typename StorageType>
+        SplitSparseMatrix<ValueType, StorageType>::SplitSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices) : columnCount(matrix.getColumnCount()), narrowColumnIndices(allowNarrowColumnIndices && matrix.getColumnCount() <= std::numeric_limits<uint32_t>::max()) {
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            values.reserve(matrix.getEntryCount());
+            if (narrowColumnIndices) {
+                narrowColumns.reserve(matrix.getEntryCount());
+            } else {
+                wideColumns.reserve(matrix.getEntryCount());
+            }
+
+            rowIndications.push_back(0);
+            for (index_type row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (narrowColumnIndices) {
+                        narrowColumns.push_back(static_cast<uint32_t>(entry.getColumn()));
+                    } else {
+                        wideColumns.push_back(entry.getColumn());
+                    }
+                    values.push_back(static_cast<StorageType>(entry.getValue()));
+                }
+                rowIndications.push_back(values.size());
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        typename SplitSparseMatrix<ValueType, StorageType>::index_type SplitSparseMatrix<ValueType, StorageType>::getRowCount() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ValueType, typename StorageType>
+        typename SplitSparseMatrix<ValueType, StorageType>::index_type SplitSparseMatrix<ValueType, StorageType>::getColumnCount() const {
+            return columnCount;
+        }
+
+        template<typename ValueType, typename StorageType>
+        typename SplitSparseMatrix<ValueType, StorageType>::index_type SplitSparseMatrix<ValueType, StorageType>::getEntryCount() const {
+            return values.size();
+        }
+
+        template<typename ValueType, typename StorageType>
+        bool SplitSparseMatrix<ValueType, StorageType>::hasNarrowColumnIndices() const {
+            return narrowColumnIndices;
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyWithVector(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            if (narrowColumnIndices) {
+                multiplyWithVectorForward(narrowColumns.data(), vector, result, summand);
+            } else {
+                multiplyWithVectorForward(wideColumns.data(), vector, result, summand);
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyWithVectorBackward(std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            if (narrowColumnIndices) {
+                multiplyWithVectorBackward(narrowColumns.data(), vector, result, summand);
+            } else {
+                multiplyWithVectorBackward(wideColumns.data(), vector, result, summand);
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyWithVectorSimd(storm::utility::simd::InstructionSet, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            multiplyWithVector(vector, result, summand);
+        }
+
+        template<>
+        void SplitSparseMatrix<double>::multiplyWithVectorSimd(storm::utility::simd::InstructionSet instructionSet, std::vector<double> const& vector, std::vector<double>& result, std::vector<double> const* summand) const {
+            if (instructionSet == storm::utility::simd::InstructionSet::None || !narrowColumnIndices) {
+                multiplyWithVector(vector, result, summand);
+                return;
+            }
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            storm::utility::simd::multiplyWithVector(instructionSet, getRowCount(), rowIndications.data(), narrowColumns.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data());
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyAndReduceSimd(storm::utility::simd::InstructionSet, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            multiplyAndReduce(dir, rowGroupIndices, vector, summand, result, choices);
+        }
+
+        template<>
+        void SplitSparseMatrix<double>::multiplyAndReduceSimd(storm::utility::simd::InstructionSet instructionSet, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<double> const& vector, std::vector<double> const* summand, std::vector<double>& result, std::vector<uint_fast64_t>* choices) const {
+            if (instructionSet == storm::utility::simd::InstructionSet::None || !narrowColumnIndices) {
+                multiplyAndReduce(dir, rowGroupIndices, vector, summand, result, choices);
+                return;
+            }
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            storm::utility::simd::multiplyAndReduce(instructionSet, dir == storm::solver::OptimizationDirection::Minimize, result.size(), rowGroupIndices.data(), rowIndications.data(), narrowColumns.data(), values.data(), vector.data(), summand ? summand->data() : nullptr, result.data(), choices ? choices->data() : nullptr);
+        }
+
+        template<typename ValueType, typename StorageType>
+        template<typename ColumnType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyWithVectorForward(ColumnType const* columns, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            StorageType const* valueData = values.data();
+            index_type const rowCount = getRowCount();
+            for (index_type row = 0; row < rowCount; ++row) {
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                    newValue += valueData[entry] * vector[columns[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        template<typename ColumnType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyWithVectorBackward(ColumnType const* columns, std::vector<ValueType> const& vector, std::vector<ValueType>& result, std::vector<ValueType> const* summand) const {
+            StorageType const* valueData = values.data();
+            for (index_type row = getRowCount(); row > 0;) {
+                --row;
+                ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIndications[row + 1], entryBegin = rowIndications[row]; entry > entryBegin;) {
+                    --entry;
+                    newValue += valueData[entry] * vector[columns[entry]];
+                }
+                result[row] = newValue;
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            STORM_LOG_ASSERT(&vector != &result, "Vectors must not be aliased.");
+            if (dir == storm::solver::OptimizationDirection::Minimize) {
+                if (narrowColumnIndices) {
+                    multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(narrowColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceForward<storm::utility::ElementLess<ValueType>>(wideColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                }
+            } else {
+                if (narrowColumnIndices) {
+                    multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(narrowColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceForward<storm::utility::ElementGreater<ValueType>>(wideColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            if (dir == storm::solver::OptimizationDirection::Minimize) {
+                if (narrowColumnIndices) {
+                    multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(narrowColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceBackward<storm::utility::ElementLess<ValueType>>(wideColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                }
+            } else {
+                if (narrowColumnIndices) {
+                    multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(narrowColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                } else {
+                    multiplyAndReduceBackward<storm::utility::ElementGreater<ValueType>>(wideColumns.data(), rowGroupIndices, vector, summand, result, choices);
+                }
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        template<typename Compare, typename ColumnType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyAndReduceForward(ColumnType const* columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            StorageType const* valueData = values.data();
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+
+            index_type const groupCount = result.size();
+            for (index_type group = 0; group < groupCount; ++group) {
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                ValueType currentValue = summand ? (*summand)[groupStart] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIndications[groupStart], entryEnd = rowIndications[groupStart + 1]; entry < entryEnd; ++entry) {
+                    currentValue += valueData[entry] * vector[columns[entry]];
+                }
+                if (choices) {
+                    selectedChoice = 0;
+                    if ((*choices)[group] == 0) {
+                        oldSelectedChoiceValue = currentValue;
+                    }
+                }
+
+                for (uint64_t row = groupStart + 1; row < groupEnd; ++row) {
+                    ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIndications[row], entryEnd = rowIndications[row + 1]; entry < entryEnd; ++entry) {
+                        newValue += valueData[entry] * vector[columns[entry]];
+                    }
+
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+        template<typename ValueType, typename StorageType>
+        template<typename Compare, typename ColumnType>
+        void SplitSparseMatrix<ValueType, StorageType>::multiplyAndReduceBackward(ColumnType const* columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& vector, std::vector<ValueType> const* summand, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices) const {
+            Compare compare;
+            StorageType const* valueData = values.data();
+
+            // Variables for correctly tracking choices (only update if new choice is strictly better).
+            ValueType oldSelectedChoiceValue;
+            uint64_t selectedChoice;
+
+            for (index_type group = result.size(); group > 0;) {
+                --group;
+                uint64_t const groupStart = rowGroupIndices[group];
+                uint64_t const groupEnd = rowGroupIndices[group + 1];
+
+                // Only multiply and reduce if there is at least one row in the group.
+                if (groupStart == groupEnd) {
+                    continue;
+                }
+
+                uint64_t row = groupEnd - 1;
+                ValueType currentValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                for (index_type entry = rowIndications[row + 1], entryBegin = rowIndications[row]; entry > entryBegin;) {
+                    --entry;
+                    currentValue += valueData[entry] * vector[columns[entry]];
+                }
+                if (choices) {
+                    selectedChoice = row - groupStart;
+                    if ((*choices)[group] == selectedChoice) {
+                        oldSelectedChoiceValue = currentValue;
+                    }
+                }
+
+                while (row > groupStart) {
+                    --row;
+                    ValueType newValue = summand ? (*summand)[row] : storm::utility::zero<ValueType>();
+                    for (index_type entry = rowIndications[row + 1], entryBegin = rowIndications[row]; entry > entryBegin;) {
+                        --entry;
+                        newValue += valueData[entry] * vector[columns[entry]];
+                    }
+
+                    if (choices && row - groupStart == (*choices)[group]) {
+                        oldSelectedChoiceValue = newValue;
+                    }
+                    if (compare(newValue, currentValue)) {
+                        currentValue = newValue;
+                        selectedChoice = row - groupStart;
+                    }
+                }
+
+                // Finally write value to target vector.
+                result[group] = currentValue;
+                if (choices && compare(currentValue, oldSelectedChoiceValue)) {
+                    (*choices)[group] = selectedChoice;
+                }
+            }
+        }
+
+#ifdef STORM_HAVE_CARL
+        template<>
+        void SplitSparseMatrix<storm::RationalFunction>::multiplyAndReduce(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+
+        template<>
+        void SplitSparseMatrix<storm::RationalFunction>::multiplyAndReduceBackward(storm::solver::OptimizationDirection const&, std::vector<uint64_t> const&, std::vector<storm::RationalFunction> const&, std::vector<storm::RationalFunction> const*, std::vector<storm::RationalFunction>&, std::vector<uint_fast64_t>*) const {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "This operation is not supported.");
+        }
+#endif
+
+        template class SplitSparseMatrix<double>;
+        template class SplitSparseMatrix<double, float>;
+#ifdef STORM_HAVE_CARL
+        template class SplitSparseMatrix<storm::RationalNumber>;
+        template class SplitSparseMatrix<storm::RationalFunction>;
+#endif
+
+    }
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/simd.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        class SparseMatrix;
+
+        /*!
+         * A read-only copy of a sparse matrix that stores the column indices and the values of the entries in two
+         * separate arrays instead of one array of column-value pairs. If the number of columns permits it, column
+         * indices are stored with 32 bits. Compared to the layout of SparseMatrix, this reduces the number of bytes
+         * that need to be transferred per entry in (memory-bound) matrix-vector multiplications.
+         *
+         * The values of the entries can be stored with a different (typically less precise) type than the one of the
+         * vectors, e.g., float instead of double. All arithmetic is still performed with the value type.
+         */
+        template<typename ValueType, typename StorageType = ValueType>
+        class SplitSparseMatrix {
+        public:
+            typedef uint_fast64_t index_type;
+            typedef ValueType value_type;
+
+            /*!
+             * Creates a split copy of the given matrix.
+             *
+             * @param matrix The matrix to copy.
+             * @param allowNarrowColumnIndices If set, 32 bit column indices are used whenever the column count permits it.
+             */
+            SplitSparseMatrix(SparseMatrix<ValueType> const& matrix, bool allowNarrowColumnIndices = true);
+
+            index_type getRowCount() const;
+            index_type getColumnCount() const;
+            index_type getEntryCount() const;
+
+            /*!
+             * Retrieves whether the column indices are stored with 32 bits.
+             */
+            bool hasNarrowColumnIndices() const;
+
+            /*!
+             * Multiplies the matrix with the given vector and writes the result to the given result vector. The
+             * vector and the result must not be the same.
+             *
+             * @param vector The vector with which to multiply the matrix.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             */
+            void multiplyWithVector(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Same as multiplyWithVector, but processes the rows from last to first. The vector and the result may be
+             * the same, which yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyWithVectorBackward(std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Multiplies the matrix with the given vector, reduces the result over the given row groups and writes it
+             * to the given result vector. The vector and the result must not be the same.
+             *
+             * @param dir The optimization direction for the reduction.
+             * @param rowGroupIndices The row groups over which to reduce.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If given, this summand will be added to the result of the multiplication.
+             * @param result The vector that is supposed to hold the result of the multiplication after the operation.
+             * @param choices If given, the choices made in the reduction process will be written to this vector. Note
+             * that previous choices are only overwritten if the new choice is strictly better.
+             */
+            void multiplyAndReduce(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Same as multiplyAndReduce, but processes the row groups from last to first. The vector and the result
+             * may be the same, which yields a Gauss-Seidel style multiplication.
+             */
+            void multiplyAndReduceBackward(storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            /*!
+             * Same as multiplyWithVector, but uses vectorized kernels for the given instruction set. These are only
+             * available for double values and 32 bit column indices. In all other cases (or if the instruction set is
+             * None), this falls back to multiplyWithVector.
+             *
+             * @param instructionSet The instruction set to use. This must be supported by the machine.
+             */
+            void multiplyWithVectorSimd(storm::utility::simd::InstructionSet instructionSet, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand = nullptr) const;
+
+            /*!
+             * Same as multiplyAndReduce, but uses vectorized kernels for the given instruction set. These are only
+             * available for double values and 32 bit column indices. In all other cases (or if the instruction set is
+             * None), this falls back to multiplyAndReduce.
+             *
+             * @param instructionSet The instruction set to use. This must be supported by the machine.
+             */
+            void multiplyAndReduceSimd(storm::utility::simd::InstructionSet instructionSet, storm::solver::OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+        private:
+            template<typename ColumnType>
+            void multiplyWithVectorForward(ColumnType const* columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            template<typename ColumnType>
+            void multiplyWithVectorBackward(ColumnType const* columns, std::vector<value_type> const& vector, std::vector<value_type>& result, std::vector<value_type> const* summand) const;
+            template<typename Compare, typename ColumnType>
+            void multiplyAndReduceForward(ColumnType const* columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+            template<typename Compare, typename ColumnType>
+            void multiplyAndReduceBackward(ColumnType const* columns, std::vector<uint64_t> const& rowGroupIndices, std::vector<value_type> const& vector, std::vector<value_type> const* summand, std::vector<value_type>& result, std::vector<uint_fast64_t>* choices) const;
+
+            // The number of columns of the matrix.
+            index_type columnCount;
+
+            // The indices at which the rows begin in the column and value arrays (plus the total number of entries).
+            std::vector<index_type> rowIndications;
+
+            // A flag indicating whether the column indices are stored with 32 bits.
+            bool narrowColumnIndices;
+
+            // The column indices of all entries if they are stored with 32 bits (empty otherwise).
+            std::vector<uint32_t> narrowColumns;
+
+            // The column indices of all entries if they are stored with 64 bits (empty otherwise).
+            std::vector<index_type> wideColumns;
+
+            // The values of all entries.
+            std::vector<StorageType> values;
+        };
+
+    }
+}
@@ -1,5 +1,14 @@
 #include <storm/utility/vector.h>
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <numeric>
+
+#include "storm/utility/ThreadPool.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
@@ -151,24 +160,509 @@ namespace storm {
             }
         }
 
+        namespace detail {
+            // Systems with fewer states are decomposed sequentially, even if several threads are available.
+            uint64_t const minimalNumberOfStatesForParallelSccDecomposition = 4096;
+            
+            // Subproblems of the parallel decomposition with fewer states are decomposed sequentially.
+            uint64_t const minimalSubproblemSizeForForwardBackwardStep = 512;
+            
+            // If a forward-backward step finds an SCC that contains less than this fraction of the states, the subproblem
+            // most likely consists of many small SCCs, for which further forward-backward steps are not worth their cost.
+            // The resulting subproblems are then decomposed sequentially (but still in parallel to each other).
+            uint64_t const minimalSccFractionForForwardBackwardStep = 16;
+            
+            // The number of states that are handled at once when building the graph for the parallel decomposition.
+            uint64_t const parallelSccDecompositionChunkSize = 1024;
+            
+            // Marks states that do not (or no longer) belong to a subproblem.
+            uint64_t const noSubproblem = std::numeric_limits<uint64_t>::max();
+            
+            /*!
+             * The graph of the system that is considered by the parallel SCC decomposition, i.e., the transitions with
+             * non-zero probability between the states of the subsystem using the selected choices. Selfloops are not
+             * stored as edges.
+             */
+            struct SccGraph {
+                std::vector<uint64_t> forwardIndices;
+                std::vector<uint64_t> forwardStates;
+                std::vector<uint64_t> backwardIndices;
+                std::vector<uint64_t> backwardStates;
+                std::vector<char> hasSelfloop;
+            };
+            
+            template <typename ValueType>
+            SccGraph buildSccGraph(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices, storm::utility::ThreadPool& pool) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                uint64_t numberOfChunks = (numberOfStates + parallelSccDecompositionChunkSize - 1) / parallelSccDecompositionChunkSize;
+                SccGraph graph;
+                graph.hasSelfloop.resize(numberOfStates, 0);
+                
+                auto forEachEdge = [&] (uint64_t state, auto const& callback) {
+                    if (subsystem && !subsystem->get(state)) {
+                        return;
+                    }
+                    for (uint64_t row = transitionMatrix.getRowGroupIndices()[state], rowEnd = transitionMatrix.getRowGroupIndices()[state + 1]; row != rowEnd; ++row) {
+                        if (choices && !choices->get(row)) {
+                            continue;
+                        }
+                        for (auto const& successor : transitionMatrix.getRow(row)) {
+                            if ((!subsystem || subsystem->get(successor.getColumn())) && successor.getValue() != storm::utility::zero<ValueType>()) {
+                                callback(successor.getColumn());
+                            }
+                        }
+                    }
+                };
+                
+                // Count the outgoing and incoming edges of each state.
+                std::vector<uint64_t> outDegrees(numberOfStates, 0);
+                std::unique_ptr<std::atomic<uint64_t>[]> inDegrees(new std::atomic<uint64_t>[numberOfStates]);
+                pool.parallelFor(numberOfChunks, [&] (uint64_t chunk) {
+                    for (uint64_t state = chunk * parallelSccDecompositionChunkSize, end = std::min(state + parallelSccDecompositionChunkSize, numberOfStates); state < end; ++state) {
+                        inDegrees[state].store(0, std::memory_order_relaxed);
+                    }
+                });
+                pool.parallelFor(numberOfChunks, [&] (uint64_t chunk) {
+                    for (uint64_t state = chunk * parallelSccDecompositionChunkSize, end = std::min(state + parallelSccDecompositionChunkSize, numberOfStates); state < end; ++state) {
+                        forEachEdge(state, [&] (uint64_t successor) {
+                            if (successor == state) {
+                                graph.hasSelfloop[state] = 1;
+                            } else {
+                                ++outDegrees[state];
+                                inDegrees[successor].fetch_add(1, std::memory_order_relaxed);
+                            }
+                        });
+                    }
+                });
+                
+                graph.forwardIndices.resize(numberOfStates + 1);
+                graph.backwardIndices.resize(numberOfStates + 1);
+                graph.forwardIndices[0] = 0;
+                graph.backwardIndices[0] = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    graph.forwardIndices[state + 1] = graph.forwardIndices[state] + outDegrees[state];
+                    graph.backwardIndices[state + 1] = graph.backwardIndices[state] + inDegrees[state].load(std::memory_order_relaxed);
+                    // From now on, the in-degrees serve as the next free position for the predecessors of each state.
+                    inDegrees[state].store(graph.backwardIndices[state], std::memory_order_relaxed);
+                }
+                
+                // Fill in the edges.
+                graph.forwardStates.resize(graph.forwardIndices.back());
+                graph.backwardStates.resize(graph.backwardIndices.back());
+                pool.parallelFor(numberOfChunks, [&] (uint64_t chunk) {
+                    for (uint64_t state = chunk * parallelSccDecompositionChunkSize, end = std::min(state + parallelSccDecompositionChunkSize, numberOfStates); state < end; ++state) {
+                        uint64_t position = graph.forwardIndices[state];
+                        forEachEdge(state, [&] (uint64_t successor) {
+                            if (successor != state) {
+                                graph.forwardStates[position++] = successor;
+                                graph.backwardStates[inDegrees[successor].fetch_add(1, std::memory_order_relaxed)] = state;
+                            }
+                        });
+                    }
+                });
+                return graph;
+            }
+            
+            struct Subproblem {
+                // The identifier of the subproblem, which is stored for all its states.
+                uint64_t identifier;
+                std::vector<uint64_t> states;
+                bool useForwardBackwardStep;
+            };
+            
+            /*!
+             * The state that is shared by the threads of the parallel SCC decomposition.
+             */
+            struct ParallelSccDecompositionState {
+                ParallelSccDecompositionState(uint64_t numberOfStates) : subproblemOf(new std::atomic<uint64_t>[numberOfStates]), localIndices(numberOfStates), stateToSccMapping(numberOfStates), nextSubproblem(1), nextScc(0) {
+                    // Intentionally left empty.
+                }
+                
+                bool isInSubproblem(uint64_t state, uint64_t subproblem) const {
+                    return subproblemOf[state].load(std::memory_order_relaxed) == subproblem;
+                }
+                
+                // For each state, the subproblem it currently belongs to. The states of a subproblem are exclusively
+                // owned by the thread that processes the subproblem.
+                std::unique_ptr<std::atomic<uint64_t>[]> subproblemOf;
+                
+                // For each state, its index within the subproblem it currently belongs to.
+                std::vector<uint64_t> localIndices;
+                
+                // For each state, the (preliminary) index of its SCC.
+                std::vector<uint_fast64_t> stateToSccMapping;
+                
+                std::atomic<uint64_t> nextSubproblem;
+                std::atomic<uint64_t> nextScc;
+            };
+            
+            /*!
+             * Decomposes the remaining states of the given subproblem with the path-based algorithm. This is used for
+             * subproblems that are too small for further forward-backward steps.
+             */
+            void decomposeSubproblemSequentially(SccGraph const& graph, ParallelSccDecompositionState& state, std::vector<uint64_t> const& states, uint64_t subproblem) {
+                for (uint64_t localIndex = 0; localIndex < states.size(); ++localIndex) {
+                    state.localIndices[states[localIndex]] = localIndex;
+                }
+                
+                uint64_t const unvisited = std::numeric_limits<uint64_t>::max();
+                std::vector<uint64_t> preorderNumbers(states.size(), unvisited);
+                std::vector<char> hasScc(states.size(), 0);
+                std::vector<uint64_t> s;
+                std::vector<uint64_t> p;
+                // Each entry consists of a (local) state and the position of its next edge that is to be explored.
+                std::vector<std::pair<uint64_t, uint64_t>> recursionStack;
+                uint64_t currentIndex = 0;
+                
+                auto visit = [&] (uint64_t localIndex) {
+                    preorderNumbers[localIndex] = currentIndex++;
+                    s.push_back(localIndex);
+                    p.push_back(localIndex);
+                    recursionStack.emplace_back(localIndex, graph.forwardIndices[states[localIndex]]);
+                };
+                
+                for (uint64_t root = 0; root < states.size(); ++root) {
+                    if (preorderNumbers[root] != unvisited) {
+                        continue;
+                    }
+                    visit(root);
+                    while (!recursionStack.empty()) {
+                        uint64_t currentLocalIndex = recursionStack.back().first;
+                        uint64_t& edge = recursionStack.back().second;
+                        if (edge != graph.forwardIndices[states[currentLocalIndex] + 1]) {
+                            uint64_t successor = graph.forwardStates[edge++];
+                            if (!state.isInSubproblem(successor, subproblem)) {
+                                continue;
+                            }
+                            uint64_t successorLocalIndex = state.localIndices[successor];
+                            if (preorderNumbers[successorLocalIndex] == unvisited) {
+                                visit(successorLocalIndex);
+                            } else if (!hasScc[successorLocalIndex]) {
+                                while (preorderNumbers[p.back()] > preorderNumbers[successorLocalIndex]) {
+                                    p.pop_back();
+                                }
+                            }
+                        } else {
+                            recursionStack.pop_back();
+                            if (currentLocalIndex == p.back()) {
+                                p.pop_back();
+                                uint64_t scc = state.nextScc++;
+                                uint64_t poppedLocalIndex;
+                                do {
+                                    poppedLocalIndex = s.back();
+                                    s.pop_back();
+                                    hasScc[poppedLocalIndex] = 1;
+                                    state.stateToSccMapping[states[poppedLocalIndex]] = scc;
+                                } while (poppedLocalIndex != currentLocalIndex);
+                            }
+                        }
+                    }
+                }
+                
+                for (auto const& currentState : states) {
+                    state.subproblemOf[currentState].store(noSubproblem, std::memory_order_relaxed);
+                }
+            }
+            
+            /*!
+             * Processes the given subproblem. First, states without predecessors or successors in the subproblem are
+             * trimmed as they form singleton SCCs. Then, the SCC of a pivot state is obtained as the intersection of its
+             * forward and backward reachable states. Every other SCC of the subproblem is contained in either the forward
+             * reachable states, the backward reachable states, or the remaining states, which yields the new subproblems.
+             * Small subproblems (and those for which forward-backward steps are not expected to pay off) are decomposed
+             * sequentially instead.
+             *
+             * @return The new subproblems.
+             */
+            std::vector<Subproblem> processSubproblem(SccGraph const& graph, ParallelSccDecompositionState& state, Subproblem const& currentSubproblem) {
+                std::vector<Subproblem> result;
+                std::vector<uint64_t> const& states = currentSubproblem.states;
+                uint64_t const subproblem = currentSubproblem.identifier;
+                
+                // Trim the subproblem.
+                std::vector<uint64_t> outDegrees(states.size(), 0);
+                std::vector<uint64_t> inDegrees(states.size(), 0);
+                std::vector<uint64_t> trimStack;
+                for (uint64_t localIndex = 0; localIndex < states.size(); ++localIndex) {
+                    state.localIndices[states[localIndex]] = localIndex;
+                }
+                for (uint64_t localIndex = 0; localIndex < states.size(); ++localIndex) {
+                    uint64_t const currentState = states[localIndex];
+                    for (uint64_t edge = graph.forwardIndices[currentState]; edge < graph.forwardIndices[currentState + 1]; ++edge) {
+                        if (state.isInSubproblem(graph.forwardStates[edge], subproblem)) {
+                            ++outDegrees[localIndex];
+                        }
+                    }
+                    for (uint64_t edge = graph.backwardIndices[currentState]; edge < graph.backwardIndices[currentState + 1]; ++edge) {
+                        if (state.isInSubproblem(graph.backwardStates[edge], subproblem)) {
+                            ++inDegrees[localIndex];
+                        }
+                    }
+                    if (outDegrees[localIndex] == 0 || inDegrees[localIndex] == 0) {
+                        trimStack.push_back(localIndex);
+                    }
+                }
+                std::vector<char> isTrimmed(states.size(), 0);
+                while (!trimStack.empty()) {
+                    uint64_t localIndex = trimStack.back();
+                    trimStack.pop_back();
+                    if (isTrimmed[localIndex]) {
+                        continue;
+                    }
+                    isTrimmed[localIndex] = 1;
+                    uint64_t const currentState = states[localIndex];
+                    state.subproblemOf[currentState].store(noSubproblem, std::memory_order_relaxed);
+                    state.stateToSccMapping[currentState] = state.nextScc++;
+                    for (uint64_t edge = graph.forwardIndices[currentState]; edge < graph.forwardIndices[currentState + 1]; ++edge) {
+                        uint64_t successor = graph.forwardStates[edge];
+                        if (state.isInSubproblem(successor, subproblem) && --inDegrees[state.localIndices[successor]] == 0) {
+                            trimStack.push_back(state.localIndices[successor]);
+                        }
+                    }
+                    for (uint64_t edge = graph.backwardIndices[currentState]; edge < graph.backwardIndices[currentState + 1]; ++edge) {
+                        uint64_t predecessor = graph.backwardStates[edge];
+                        if (state.isInSubproblem(predecessor, subproblem) && --outDegrees[state.localIndices[predecessor]] == 0) {
+                            trimStack.push_back(state.localIndices[predecessor]);
+                        }
+                    }
+                }
+                
+                // As pivot, we take the remaining state that maximizes the product of its in- and out-degree as it is
+                // likely to belong to a large SCC.
+                std::vector<uint64_t> remainingStates;
+                uint64_t pivotLocalIndex = 0;
+                uint64_t pivotDegree = 0;
+                for (uint64_t localIndex = 0; localIndex < states.size(); ++localIndex) {
+                    if (!isTrimmed[localIndex]) {
+                        if (remainingStates.empty() || inDegrees[localIndex] * outDegrees[localIndex] > pivotDegree) {
+                            pivotLocalIndex = remainingStates.size();
+                            pivotDegree = inDegrees[localIndex] * outDegrees[localIndex];
+                        }
+                        remainingStates.push_back(states[localIndex]);
+                    }
+                }
+                if (remainingStates.empty()) {
+                    return result;
+                }
+                if (!currentSubproblem.useForwardBackwardStep || remainingStates.size() < minimalSubproblemSizeForForwardBackwardStep) {
+                    decomposeSubproblemSequentially(graph, state, remainingStates, subproblem);
+                    return result;
+                }
+                
+                // Perform a forward-backward step for the pivot.
+                for (uint64_t localIndex = 0; localIndex < remainingStates.size(); ++localIndex) {
+                    state.localIndices[remainingStates[localIndex]] = localIndex;
+                }
+                auto search = [&] (std::vector<uint64_t> const& indices, std::vector<uint64_t> const& edges) {
+                    std::vector<char> reached(remainingStates.size(), 0);
+                    std::vector<uint64_t> stack = {remainingStates[pivotLocalIndex]};
+                    reached[pivotLocalIndex] = 1;
+                    while (!stack.empty()) {
+                        uint64_t currentState = stack.back();
+                        stack.pop_back();
+                        for (uint64_t edge = indices[currentState]; edge < indices[currentState + 1]; ++edge) {
+                            uint64_t otherState = edges[edge];
+                            if (state.isInSubproblem(otherState, subproblem) && !reached[state.localIndices[otherState]]) {
+                                reached[state.localIndices[otherState]] = 1;
+                                stack.push_back(otherState);
+                            }
+                        }
+                    }
+                    return reached;
+                };
+                std::vector<char> forwardReached = search(graph.forwardIndices, graph.forwardStates);
+                std::vector<char> backwardReached = search(graph.backwardIndices, graph.backwardStates);
+                
+                uint64_t scc = state.nextScc++;
+                uint64_t sccSize = 0;
+                for (uint64_t localIndex = 0; localIndex < remainingStates.size(); ++localIndex) {
+                    if (forwardReached[localIndex] && backwardReached[localIndex]) {
+                        ++sccSize;
+                    }
+                }
+                bool useForwardBackwardStep = sccSize * minimalSccFractionForForwardBackwardStep >= remainingStates.size();
+                uint64_t firstNewSubproblem = state.nextSubproblem.fetch_add(3);
+                for (uint64_t newSubproblem = 0; newSubproblem < 3; ++newSubproblem) {
+                    result.push_back(Subproblem{firstNewSubproblem + newSubproblem, std::vector<uint64_t>(), useForwardBackwardStep});
+                }
+                for (uint64_t localIndex = 0; localIndex < remainingStates.size(); ++localIndex) {
+                    uint64_t const currentState = remainingStates[localIndex];
+                    if (forwardReached[localIndex] && backwardReached[localIndex]) {
+                        state.subproblemOf[currentState].store(noSubproblem, std::memory_order_relaxed);
+                        state.stateToSccMapping[currentState] = scc;
+                    } else {
+                        // The new subproblems consist of the states that are only forward reachable, only backward reachable, or neither.
+                        auto& newSubproblem = result[forwardReached[localIndex] ? 0 : (backwardReached[localIndex] ? 1 : 2)];
+                        state.subproblemOf[currentState].store(newSubproblem.identifier, std::memory_order_relaxed);
+                        newSubproblem.states.push_back(currentState);
+                    }
+                }
+                result.erase(std::remove_if(result.begin(), result.end(), [] (Subproblem const& newSubproblem) { return newSubproblem.states.empty(); }), result.end());
+                return result;
+            }
+        }
+
+        /*!
+         * Computes a mapping of states to their SCCs using a parallel forward-backward algorithm with trimming. The SCCs
+         * are numbered such that SCCs only reach SCCs with a lower index, just like the path-based algorithm does.
+         * Among the valid orders, the SCCs are ordered by their depth and (for SCCs of equal depth) by their
+         * smallest state, so the result does not depend on the number of threads.
+         *
+         * @param transitionMatrix The transition matrix of the system to decompose.
+         * @param subsystem An optional bit vector indicating which subsystem to consider.
+         * @param choices An optional bit vector indicating which choices belong to the subsystem.
+         * @param numberOfThreads The number of threads to use.
+         * @param nonTrivialStates A bit vector where entries for non-trivial states (states that either have a selfloop or whose SCC is not a singleton) will be set to true
+         * @param stateToSccMapping A mapping from states to the SCC indices they belong to, which is filled by this function.
+         * @param sccCount Is set to the number of SCCs.
+         * @param sccDepths Is set to the depths of the SCCs.
+         */
+        template <typename ValueType>
+        void performSccDecompositionParallel(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const* subsystem, storm::storage::BitVector const* choices, uint64_t numberOfThreads, storm::storage::BitVector& nonTrivialStates, std::vector<uint_fast64_t>& stateToSccMapping, uint_fast64_t& sccCount, std::vector<uint_fast64_t>& sccDepths) {
+            uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+            storm::utility::ThreadPool pool(numberOfThreads);
+            detail::SccGraph graph = detail::buildSccGraph(transitionMatrix, subsystem, choices, pool);
+            
+            // Initially, there is one subproblem that consists of all states of the subsystem.
+            detail::ParallelSccDecompositionState state(numberOfStates);
+            std::vector<detail::Subproblem> pendingSubproblems(1);
+            pendingSubproblems.front().identifier = 0;
+            pendingSubproblems.front().useForwardBackwardStep = true;
+            for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                if (!subsystem || subsystem->get(currentState)) {
+                    state.subproblemOf[currentState].store(0, std::memory_order_relaxed);
+                    pendingSubproblems.front().states.push_back(currentState);
+                } else {
+                    state.subproblemOf[currentState].store(detail::noSubproblem, std::memory_order_relaxed);
+                }
+            }
+            
+            // The threads take pending subproblems until there are neither pending subproblems nor threads that might create new ones.
+            std::mutex mutex;
+            std::condition_variable pendingSubproblemsChanged;
+            uint64_t numberOfBusyThreads = 0;
+            bool aborted = false;
+            pool.execute([&] (uint64_t) {
+                while (true) {
+                    detail::Subproblem subproblem;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        pendingSubproblemsChanged.wait(lock, [&] { return aborted || !pendingSubproblems.empty() || numberOfBusyThreads == 0; });
+                        if (aborted || pendingSubproblems.empty()) {
+                            return;
+                        }
+                        subproblem = std::move(pendingSubproblems.back());
+                        pendingSubproblems.pop_back();
+                        ++numberOfBusyThreads;
+                    }
+                    
+                    std::vector<detail::Subproblem> newSubproblems;
+                    try {
+                        newSubproblems = detail::processSubproblem(graph, state, subproblem);
+                    } catch (...) {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            aborted = true;
+                            --numberOfBusyThreads;
+                        }
+                        pendingSubproblemsChanged.notify_all();
+                        throw;
+                    }
+                    
+                    {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        for (auto& newSubproblem : newSubproblems) {
+                            pendingSubproblems.push_back(std::move(newSubproblem));
+                        }
+                        --numberOfBusyThreads;
+                    }
+                    pendingSubproblemsChanged.notify_all();
+                }
+            });
+            sccCount = state.nextScc.load();
+            
+            // Collect the states of each SCC in ascending order.
+            std::vector<uint64_t> sccIndices(sccCount + 1, 0);
+            std::vector<uint64_t> sccStates;
+            sccStates.reserve(numberOfStates);
+            for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                if (!subsystem || subsystem->get(currentState)) {
+                    ++sccIndices[state.stateToSccMapping[currentState] + 1];
+                }
+            }
+            for (uint64_t scc = 0; scc < sccCount; ++scc) {
+                sccIndices[scc + 1] += sccIndices[scc];
+            }
+            sccStates.resize(sccIndices.back());
+            std::vector<uint64_t> nextPositions(sccIndices.begin(), sccIndices.end() - 1);
+            for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                if (!subsystem || subsystem->get(currentState)) {
+                    uint64_t scc = state.stateToSccMapping[currentState];
+                    sccStates[nextPositions[scc]++] = currentState;
+                    if (graph.hasSelfloop[currentState] || sccIndices[scc + 1] - sccIndices[scc] > 1) {
+                        nonTrivialStates.set(currentState, true);
+                    }
+                }
+            }
+            
+            // Compute the depths of the SCCs by processing an SCC once all its successor SCCs have been processed.
+            std::vector<uint64_t> remainingSuccessors(sccCount, 0);
+            for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                for (uint64_t edge = graph.forwardIndices[currentState]; edge < graph.forwardIndices[currentState + 1]; ++edge) {
+                    if (state.stateToSccMapping[graph.forwardStates[edge]] != state.stateToSccMapping[currentState]) {
+                        ++remainingSuccessors[state.stateToSccMapping[currentState]];
+                    }
+                }
+            }
+            std::vector<uint64_t> depths(sccCount, 0);
+            std::vector<uint64_t> stack;
+            for (uint64_t scc = 0; scc < sccCount; ++scc) {
+                if (remainingSuccessors[scc] == 0) {
+                    stack.push_back(scc);
+                }
+            }
+            while (!stack.empty()) {
+                uint64_t scc = stack.back();
+                stack.pop_back();
+                for (uint64_t position = sccIndices[scc]; position < sccIndices[scc + 1]; ++position) {
+                    uint64_t currentState = sccStates[position];
+                    for (uint64_t edge = graph.backwardIndices[currentState]; edge < graph.backwardIndices[currentState + 1]; ++edge) {
+                        uint64_t predecessorScc = state.stateToSccMapping[graph.backwardStates[edge]];
+                        if (predecessorScc != scc) {
+                            depths[predecessorScc] = std::max(depths[predecessorScc], depths[scc] + 1);
+                            if (--remainingSuccessors[predecessorScc] == 0) {
+                                stack.push_back(predecessorScc);
+                            }
+                        }
+                    }
+                }
+            }
+            
+            // Finally, renumber the SCCs.
+            std::vector<uint64_t> sccOrder(sccCount);
+            std::iota(sccOrder.begin(), sccOrder.end(), 0);
+            std::sort(sccOrder.begin(), sccOrder.end(), [&] (uint64_t const& first, uint64_t const& second) {
+                return std::make_pair(depths[first], sccStates[sccIndices[first]]) < std::make_pair(depths[second], sccStates[sccIndices[second]]);
+            });
+            std::vector<uint64_t> newSccIndices(sccCount);
+            sccDepths.resize(sccCount);
+            for (uint64_t newScc = 0; newScc < sccCount; ++newScc) {
+                newSccIndices[sccOrder[newScc]] = newScc;
+                sccDepths[newScc] = depths[sccOrder[newScc]];
+            }
+            for (uint64_t currentState = 0; currentState < numberOfStates; ++currentState) {
+                if (!subsystem || subsystem->get(currentState)) {
+                    stateToSccMapping[currentState] = newSccIndices[state.stateToSccMapping[currentState]];
+                }
+            }
+        }
+
         template <typename ValueType>
         void StronglyConnectedComponentDecomposition<ValueType>::performSccDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, StronglyConnectedComponentDecompositionOptions const& options) {
             
             STORM_LOG_ASSERT(!options.choicesPtr || options.subsystemPtr, "Expecting subsystem if choices are given.");
             
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
-            
-            // Set up the environment of the algorithm.
-            // Start with the two stacks it maintains.
-            std::vector<uint_fast64_t> s;
-            s.reserve(numberOfStates);
-            std::vector<uint_fast64_t> p;
-            p.reserve(numberOfStates);
-            
-            // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
-            std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
-            storm::storage::BitVector hasPreorderNumber(numberOfStates);
-            storm::storage::BitVector stateHasScc(numberOfStates);
             std::vector<uint_fast64_t> stateToSccMapping(numberOfStates);
             uint_fast64_t sccCount = 0;
             
@@ -183,18 +677,40 @@ namespace storm {
             // Finally, we need to keep of trivial states (singleton SCCs without selfloop).
             storm::storage::BitVector nonTrivialStates(numberOfStates, false);
             
-            // Start the search for SCCs from every state in the block.
-            uint_fast64_t currentIndex = 0;
-            if (options.subsystemPtr) {
-                for (auto state : *options.subsystemPtr) {
-                    if (!hasPreorderNumber.get(state)) {
-                        performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount, options.isTopologicalSortForced, sccDepthsPtr);
-                    }
+            uint_fast64_t numberOfConsideredStates = options.subsystemPtr ? options.subsystemPtr->getNumberOfSetBits() : numberOfStates;
+            if (options.numberOfThreadsValue > 1 && numberOfConsideredStates >= detail::minimalNumberOfStatesForParallelSccDecomposition) {
+                STORM_LOG_TRACE("Decomposing " << numberOfConsideredStates << " states into SCCs using " << options.numberOfThreadsValue << " threads.");
+                std::vector<uint_fast64_t> parallelSccDepths;
+                performSccDecompositionParallel(transitionMatrix, options.subsystemPtr, options.choicesPtr, options.numberOfThreadsValue, nonTrivialStates, stateToSccMapping, sccCount, parallelSccDepths);
+                if (sccDepthsPtr) {
+                    *sccDepthsPtr = std::move(parallelSccDepths);
                 }
             } else {
-                for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
-                    if (!hasPreorderNumber.get(state)) {
-                        performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount, options.isTopologicalSortForced, sccDepthsPtr);
+                // Set up the environment of the algorithm.
+                // Start with the two stacks it maintains.
+                std::vector<uint_fast64_t> s;
+                s.reserve(numberOfStates);
+                std::vector<uint_fast64_t> p;
+                p.reserve(numberOfStates);
+                
+                // We also need to store the preorder numbers of states and which states have been assigned to which SCC.
+                std::vector<uint_fast64_t> preorderNumbers(numberOfStates);
+                storm::storage::BitVector hasPreorderNumber(numberOfStates);
+                storm::storage::BitVector stateHasScc(numberOfStates);
+                
+                // Start the search for SCCs from every state in the block.
+                uint_fast64_t currentIndex = 0;
+                if (options.subsystemPtr) {
+                    for (auto state : *options.subsystemPtr) {
+                        if (!hasPreorderNumber.get(state)) {
+                            performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount, options.isTopologicalSortForced, sccDepthsPtr);
+                        }
+                    }
+                } else {
+                    for (uint64_t state = 0; state < transitionMatrix.getRowGroupCount(); ++state) {
+                        if (!hasPreorderNumber.get(state)) {
+                            performSccDecompositionGCM(transitionMatrix, state, nonTrivialStates, options.subsystemPtr, options.choicesPtr, currentIndex, hasPreorderNumber, preorderNumbers, s, p, stateHasScc, stateToSccMapping, sccCount, options.isTopologicalSortForced, sccDepthsPtr);
+                        }
                     }
                 }
             }
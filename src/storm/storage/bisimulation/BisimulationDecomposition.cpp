@@ -1,6 +1,7 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 
 #include <chrono>
+#include <type_traits>
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -18,6 +19,7 @@
 #include "storm/logic/FormulaInformation.h"
 #include "storm/logic/FragmentSpecification.h"
 
+#include "storm/utility/ThreadPool.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
 #include "storm/exceptions/InvalidOptionException.h"
@@ -27,6 +29,24 @@ namespace storm {
         
         using namespace bisimulation;
         
+        namespace detail {
+            // The number of states whose signatures are computed as one unit of work by a thread.
+            uint64_t const statesPerSignatureChunk = 1ull << 12;
+            
+            /*!
+             * Executes the given task for all indices in [0, count), in parallel if a thread pool is given.
+             */
+            inline void forEachIndex(storm::utility::ThreadPool* pool, uint64_t count, std::function<void(uint64_t)> const& task) {
+                if (pool) {
+                    pool->parallelFor(count, task);
+                } else {
+                    for (uint64_t index = 0; index < count; ++index) {
+                        task(index);
+                    }
+                }
+            }
+        }
+        
         template<typename ModelType, typename BlockDataType>
         BisimulationDecomposition<ModelType, BlockDataType>::Options::Options(ModelType const& model, storm::logic::Formula const& formula) : Options() {
             this->preserveSingleFormula(model, formula);
@@ -47,8 +67,13 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
-            // Intentionally left empty.
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), signatureRefinement(false), numberOfThreads(1), minimalNumberOfStatesForParallelRefinement(1ull << 14), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+            if (storm::settings::hasModule<storm::settings::modules::BisimulationSettings>()) {
+                signatureRefinement = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMode() == storm::settings::modules::BisimulationSettings::SparseRefinementMode::Signature;
+            }
+            if (storm::settings::hasModule<storm::settings::modules::CoreSettings>()) {
+                numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+            }
         }
         
         template<typename ModelType, typename BlockDataType>
@@ -196,7 +221,12 @@ namespace storm {
             this->initialize();
             
             std::chrono::high_resolution_clock::time_point refinementStart = std::chrono::high_resolution_clock::now();
-            this->performPartitionRefinement();
+            STORM_LOG_WARN_COND(!options.signatureRefinement || options.getType() == BisimulationType::Strong, "Signature-based refinement is only available for strong bisimulation. Falling back to splitter-based refinement.");
+            if (this->useSignatureRefinement()) {
+                this->performSignatureRefinement();
+            } else {
+                this->performPartitionRefinement();
+            }
             std::chrono::high_resolution_clock::duration refinementTime = std::chrono::high_resolution_clock::now() - refinementStart;
             
             std::chrono::high_resolution_clock::time_point extractionStart = std::chrono::high_resolution_clock::now();
@@ -253,6 +283,65 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::useSignatureRefinement() const {
+            return options.signatureRefinement && options.getType() == BisimulationType::Strong;
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureRefinement() {
+            uint64_t numberOfStates = model.getNumberOfStates();
+            
+            // Computations on exact values are not thread-safe, so only double precision signatures are computed
+            // concurrently.
+            std::unique_ptr<storm::utility::ThreadPool> pool;
+            uint64_t statesPerChunk = detail::statesPerSignatureChunk;
+            if (std::is_same<ValueType, double>::value && options.numberOfThreads > 1 && numberOfStates >= options.minimalNumberOfStatesForParallelRefinement) {
+                pool = std::make_unique<storm::utility::ThreadPool>(options.numberOfThreads);
+                // Make sure that every thread gets some work, even if there are only few states.
+                statesPerChunk = std::max<uint64_t>(1, std::min(statesPerChunk, (numberOfStates + options.numberOfThreads - 1) / options.numberOfThreads));
+            }
+            
+            std::function<bool (storm::storage::sparse::state_type, storm::storage::sparse::state_type)> less = [this] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) { return this->signatureLess(state1, state2); };
+            uint64_t numberOfChunks = (numberOfStates + statesPerChunk - 1) / statesPerChunk;
+            std::vector<Block<BlockDataType>*> blocksToSplit;
+            
+            uint_fast64_t iterations = 0;
+            bool split = true;
+            while (split) {
+                ++iterations;
+                
+                // Compute the signatures of all states wrt. the current partition.
+                detail::forEachIndex(pool.get(), numberOfChunks, [&] (uint64_t chunk) {
+                    this->computeSignatures(chunk * statesPerChunk, std::min((chunk + 1) * statesPerChunk, numberOfStates));
+                });
+                
+                // Sort the states of every block that may be split according to their signatures. As the blocks occupy
+                // disjoint ranges of the partition, they can be sorted concurrently.
+                blocksToSplit.clear();
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        blocksToSplit.push_back(block.get());
+                    }
+                }
+                detail::forEachIndex(pool.get(), blocksToSplit.size(), [&] (uint64_t index) {
+                    partition.sortBlock(*blocksToSplit[index], less);
+                });
+                
+                // Finally, split the blocks at the borders of the ranges of equal signatures. The new blocks are
+                // created sequentially, because they are appended to the partition.
+                split = false;
+                for (auto block : blocksToSplit) {
+                    std::vector<uint_fast64_t> rangeBegins = partition.computeRangesOfEqualValue(block->getBeginIndex(), block->getEndIndex(), less);
+                    for (uint_fast64_t index = 1; index + 1 < rangeBegins.size(); ++index) {
+                        partition.splitBlock(*block, rangeBegins[index]);
+                        split = true;
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Signature-based refinement took " << iterations << " rounds and yielded " << partition.size() << " blocks.");
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
@@ -132,6 +132,17 @@ namespace storm {
                 /// A flag that governs whether the quotient model is actually built or only the decomposition is computed.
                 bool buildQuotient;
                 
+                /// A flag that indicates whether the partition is refined by repeatedly splitting all blocks according
+                /// to the signatures of their states (rather than by processing splitters). This only applies to strong
+                /// bisimulation.
+                bool signatureRefinement;
+                
+                /// The number of threads used by the signature-based refinement (only used for double precision).
+                uint64_t numberOfThreads;
+                
+                /// The signatures of models with fewer states are computed sequentially, even if several threads are available.
+                uint64_t minimalNumberOfStatesForParallelRefinement;
+                
             private:
                 boost::optional<OptimizationDirection> optimalityType;
                 
@@ -213,6 +224,33 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement in rounds. In every round, the signatures of all states are computed
+             * wrt. the current partition and every block is split into the states with equal signatures. The
+             * refinement stops once a round does not split any block.
+             */
+            void performSignatureRefinement();
+            
+            /*!
+             * Retrieves whether the partition is to be refined using signatures.
+             */
+            bool useSignatureRefinement() const;
+            
+            /*!
+             * Computes the signatures of the given range of states wrt. the current partition. This may be called
+             * concurrently for disjoint ranges, so only data associated with the given states may be modified.
+             *
+             * @param firstState The first state whose signature is computed.
+             * @param lastState The state after the last state whose signature is computed.
+             */
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) = 0;
+            
+            /*!
+             * Retrieves whether the signature of the first state is considered to be less than the signature of the
+             * second state.
+             */
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const = 0;
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
@@ -559,6 +559,36 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+            if (this->useSignatureRefinement()) {
+                signatures.resize(this->model.getNumberOfStates());
+            }
+        }
+        
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) {
+            for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+                // States of blocks that cannot be split do not need a signature.
+                if (!possiblyNeedsRefinement(this->partition.getBlock(state))) {
+                    continue;
+                }
+                
+                storm::storage::Distribution<ValueType> signature;
+                for (auto const& entry : this->model.getTransitionMatrix().getRow(state)) {
+                    if (!this->comparator.isZero(entry.getValue())) {
+                        signature.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                    }
+                }
+                signatures[state] = std::move(signature);
+            }
+        }
+        
+        template<typename ModelType>
+        bool DeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
+            return signatures[state1].less(signatures[state2], this->comparator);
+        }
+        
         template<typename ModelType>
         void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
             // In order to create the quotient model, we need to construct
@@ -4,6 +4,8 @@
 #include "storm/storage/bisimulation/BisimulationDecomposition.h"
 #include "storm/storage/bisimulation/DeterministicBlockData.h"
 
+#include "storm/storage/Distribution.h"
+
 namespace storm {
     namespace utility {
         template <typename ValueType> class ConstantsComparator;
@@ -40,6 +42,12 @@ namespace storm {
             virtual void buildQuotient() override;
             
             virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
+            
+            virtual void initialize() override;
+            
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+            
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
 
         private:
             // Post-processes the initial partition to properly initialize it.
@@ -129,6 +137,10 @@ namespace storm {
             
             // A vector mapping each state to its silent probability.
             std::vector<ValueType> silentProbabilities;
+            
+            // A vector mapping each state to its distribution over the blocks of the partition (only used by the
+            // signature-based refinement).
+            std::vector<storm::storage::Distribution<ValueType>> signatures;
         };
     }
 }
@@ -38,7 +38,7 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             for (storm::storage::sparse::state_type state = 0; state < this->model.getNumberOfStates(); ++state) {
                 for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
                     choiceToStateMapping[choice] = state;
@@ -48,7 +48,7 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::initializeQuotientDistributions() {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             
             for (auto const& block : this->partition.getBlocks()) {
                 if (block->data().absorbing()) {
@@ -62,20 +62,7 @@ namespace storm {
                 } else {
                     // Otherwise, we compute the probabilities from the transition matrix.
                     for (auto stateIt = this->partition.begin(*block), stateIte = this->partition.end(*block); stateIt != stateIte; ++stateIt) {
-                        for (uint_fast64_t choice = nondeterministicChoiceIndices[*stateIt]; choice < nondeterministicChoiceIndices[*stateIt + 1]; ++choice) {
-                            if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
-                                auto const& rewardModel = this->model.getUniqueRewardModel();
-                                if (rewardModel.hasStateActionRewards()) {
-                                    this->quotientDistributions[choice].setReward(rewardModel.getStateActionReward(choice));
-                                }
-                            }
-                            for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
-                                if (!this->comparator.isZero(entry.getValue())) {
-                                    this->quotientDistributions[choice].addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
-                                }
-                            }
-                            orderedQuotientDistributions[choice] = &this->quotientDistributions[choice];
-                        }
+                        computeQuotientDistributions(*stateIt);
                     }
                 }
             }
@@ -85,9 +72,47 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::computeQuotientDistributions(storm::storage::sparse::state_type state) {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                storm::storage::DistributionWithReward<ValueType> distribution;
+                if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
+                    auto const& rewardModel = this->model.getUniqueRewardModel();
+                    if (rewardModel.hasStateActionRewards()) {
+                        distribution.setReward(rewardModel.getStateActionReward(choice));
+                    }
+                }
+                for (auto entry : this->model.getTransitionMatrix().getRow(choice)) {
+                    if (!this->comparator.isZero(entry.getValue())) {
+                        distribution.addProbability(this->partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                    }
+                }
+                this->quotientDistributions[choice] = std::move(distribution);
+                orderedQuotientDistributions[choice] = &this->quotientDistributions[choice];
+            }
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) {
+            // The quotient distributions serve as signatures. They are also computed for states that cannot be split,
+            // because they are used for building the quotient.
+            for (storm::storage::sparse::state_type state = firstState; state < lastState; ++state) {
+                if (!this->partition.getBlock(state).data().absorbing()) {
+                    computeQuotientDistributions(state);
+                    updateOrderedQuotientDistributions(state);
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
+            return quotientDistributionsLess(state1, state2);
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state], this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
                       [this] (storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
                           return dist1->less(*dist2, this->comparator);
@@ -129,7 +154,7 @@ namespace storm {
             
             // Now build (a) and (b) by traversing all blocks.
             uint_fast64_t currentRow = 0;
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
                 auto const& block = this->blocks[blockIndex];
                 
@@ -269,7 +294,7 @@ namespace storm {
         
         template<typename ModelType>
         bool NondeterministicModelBisimulationDecomposition<ModelType>::checkQuotientDistributions() const {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             for (decltype(this->model.getNumberOfStates()) state = 0; state < this->model.getNumberOfStates(); ++state) {
                 for (auto choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
                     storm::storage::DistributionWithReward<ValueType> distribution;
@@ -312,7 +337,7 @@ namespace storm {
         
         template<typename ModelType>
         bool NondeterministicModelBisimulationDecomposition<ModelType>::printDistributions(uint_fast64_t state) const {
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             for (auto choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
                 std::cout << quotientDistributions[choice] << std::endl;
             }
@@ -383,7 +408,7 @@ namespace storm {
         template<typename ModelType>
         bool NondeterministicModelBisimulationDecomposition<ModelType>::quotientDistributionsLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const {
             STORM_LOG_TRACE("Comparing the quotient distributions of state " << state1 << " and " << state2 << ".");
-            std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             
             auto firstIt = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1];
             auto firstIte = orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state1 + 1];
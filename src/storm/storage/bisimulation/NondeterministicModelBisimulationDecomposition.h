@@ -41,6 +41,10 @@ namespace storm {
             
             virtual void initialize() override;
             
+            virtual void computeSignatures(storm::storage::sparse::state_type firstState, storm::storage::sparse::state_type lastState) override;
+            
+            virtual bool signatureLess(storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) const override;
+            
         private:
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
@@ -48,6 +52,10 @@ namespace storm {
             // Initializes the quotient distributions wrt. to the current partition.
             void initializeQuotientDistributions();
             
+            // Computes the quotient distributions of the choices of the given (non-absorbing) state wrt. to the
+            // current partition.
+            void computeQuotientDistributions(storm::storage::sparse::state_type state);
+            
             // Retrieves whether the given block possibly needs refinement.
             bool possiblyNeedsRefinement(bisimulation::Block<BlockDataType> const& block) const;
             
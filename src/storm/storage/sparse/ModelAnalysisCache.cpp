@@ -0,0 +1,241 @@
+#include "storm/storage/sparse/ModelAnalysisCache.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            namespace detail {
+                // The size of the cache (in MB) if the model checker settings are not available.
+                static const uint64_t defaultMaximalAnalysisCacheSize = 512;
+
+                uint64_t getMaximalAnalysisCacheSizeInBytes() {
+                    uint64_t sizeInMegabytes = defaultMaximalAnalysisCacheSize;
+                    if (storm::settings::hasModule<storm::settings::modules::ModelCheckerSettings>()) {
+                        sizeInMegabytes = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getMaximalAnalysisCacheSize();
+                    }
+                    return sizeInMegabytes * 1024 * 1024;
+                }
+
+                template <typename ValueType>
+                uint64_t estimateSizeInBytes(storm::storage::SparseMatrix<ValueType> const& matrix) {
+                    typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+                    uint64_t result = sizeof(matrix) + matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<index_type, ValueType>) + (matrix.getRowCount() + 1) * sizeof(index_type);
+                    if (!matrix.hasTrivialRowGrouping()) {
+                        result += (matrix.getRowGroupCount() + 1) * sizeof(index_type);
+                    }
+                    return result;
+                }
+
+                template <typename ValueType>
+                uint64_t estimateSizeInBytes(storm::storage::StronglyConnectedComponentDecomposition<ValueType> const& decomposition) {
+                    uint64_t result = sizeof(decomposition);
+                    for (auto const& block : decomposition) {
+                        result += sizeof(block) + block.size() * sizeof(storm::storage::sparse::state_type);
+                    }
+                    return result;
+                }
+
+                template <typename ValueType>
+                uint64_t estimateSizeInBytes(storm::storage::MaximalEndComponentDecomposition<ValueType> const& decomposition) {
+                    // Each state of a MEC is stored in a node of a hash map together with the set of its choices.
+                    uint64_t const bytesPerState = 4 * sizeof(uint64_t) + sizeof(storm::storage::MaximalEndComponent::set_type);
+                    uint64_t result = sizeof(decomposition);
+                    for (auto const& mec : decomposition) {
+                        result += sizeof(mec);
+                        for (auto const& stateChoicesPair : mec) {
+                            result += bytesPerState + stateChoicesPair.second.size() * sizeof(uint64_t);
+                        }
+                    }
+                    return result;
+                }
+            }
+
+            template <typename ValueType>
+            ModelAnalysisCache<ValueType>::Entry::Entry(AnalysisType type, std::size_t phiStatesHash, std::size_t psiStatesHash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) : type(type), phiStatesHash(phiStatesHash), psiStatesHash(psiStatesHash), phiStates(phiStates), psiStates(psiStates), sizeInBytes(0) {
+                // Intentionally left empty.
+            }
+
+            template <typename ValueType>
+            ModelAnalysisCache<ValueType>::ModelAnalysisCache() : ModelAnalysisCache(detail::getMaximalAnalysisCacheSizeInBytes()) {
+                // Intentionally left empty.
+            }
+
+            template <typename ValueType>
+            ModelAnalysisCache<ValueType>::ModelAnalysisCache(uint64_t maximalSizeInBytes) : maximalSizeInBytes(maximalSizeInBytes), sizeInBytes(0), numberOfHits(0) {
+                // Intentionally left empty.
+            }
+
+            template <typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ModelAnalysisCache<ValueType>::getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                std::lock_guard<std::mutex> lock(mutex);
+                return getBackwardTransitionsUnlocked(transitionMatrix);
+            }
+
+            template <typename ValueType>
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ModelAnalysisCache<ValueType>::getBackwardTransitionsUnlocked(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                storm::storage::BitVector noStates;
+                std::size_t noStatesHash = std::hash<storm::storage::BitVector>()(noStates);
+                if (Entry* entry = findEntry(AnalysisType::BackwardTransitions, noStatesHash, noStatesHash, noStates, noStates)) {
+                    STORM_LOG_ASSERT(entry->backwardTransitions->getRowCount() == transitionMatrix.getColumnCount(), "The cached backward transitions do not match the given transition matrix.");
+                    return entry->backwardTransitions;
+                }
+
+                Entry entry(AnalysisType::BackwardTransitions, noStatesHash, noStatesHash, noStates, noStates);
+                entry.backwardTransitions = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(transitionMatrix.transpose(true));
+                entry.sizeInBytes = detail::estimateSizeInBytes(*entry.backwardTransitions);
+                auto result = entry.backwardTransitions;
+                addEntry(std::move(entry));
+                return result;
+            }
+
+            template <typename ValueType>
+            std::shared_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType> const> ModelAnalysisCache<ValueType>::getBottomStronglyConnectedComponents(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                std::lock_guard<std::mutex> lock(mutex);
+                storm::storage::BitVector noStates;
+                std::size_t noStatesHash = std::hash<storm::storage::BitVector>()(noStates);
+                if (Entry* entry = findEntry(AnalysisType::BottomStronglyConnectedComponents, noStatesHash, noStatesHash, noStates, noStates)) {
+                    return entry->sccDecomposition;
+                }
+
+                Entry entry(AnalysisType::BottomStronglyConnectedComponents, noStatesHash, noStatesHash, noStates, noStates);
+                entry.sccDecomposition = std::make_shared<storm::storage::StronglyConnectedComponentDecomposition<ValueType>>(transitionMatrix, storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs());
+                entry.sizeInBytes = detail::estimateSizeInBytes(*entry.sccDecomposition);
+                auto result = entry.sccDecomposition;
+                addEntry(std::move(entry));
+                return result;
+            }
+
+            template <typename ValueType>
+            std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> ModelAnalysisCache<ValueType>::getMaximalEndComponents(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                std::lock_guard<std::mutex> lock(mutex);
+                storm::storage::BitVector noStates;
+                std::size_t noStatesHash = std::hash<storm::storage::BitVector>()(noStates);
+                if (Entry* entry = findEntry(AnalysisType::MaximalEndComponents, noStatesHash, noStatesHash, noStates, noStates)) {
+                    return entry->mecDecomposition;
+                }
+
+                Entry entry(AnalysisType::MaximalEndComponents, noStatesHash, noStatesHash, noStates, noStates);
+                entry.mecDecomposition = std::make_shared<storm::storage::MaximalEndComponentDecomposition<ValueType>>(transitionMatrix, *getBackwardTransitionsUnlocked(transitionMatrix));
+                entry.sizeInBytes = detail::estimateSizeInBytes(*entry.mecDecomposition);
+                auto result = entry.mecDecomposition;
+                addEntry(std::move(entry));
+                return result;
+            }
+
+            template <typename ValueType>
+            typename ModelAnalysisCache<ValueType>::QualitativeStateSets ModelAnalysisCache<ValueType>::getProb01(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return getQualitativeStateSets(AnalysisType::Prob01, transitionMatrix, phiStates, psiStates);
+            }
+
+            template <typename ValueType>
+            typename ModelAnalysisCache<ValueType>::QualitativeStateSets ModelAnalysisCache<ValueType>::getProb01Min(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return getQualitativeStateSets(AnalysisType::Prob01Min, transitionMatrix, phiStates, psiStates);
+            }
+
+            template <typename ValueType>
+            typename ModelAnalysisCache<ValueType>::QualitativeStateSets ModelAnalysisCache<ValueType>::getProb01Max(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return getQualitativeStateSets(AnalysisType::Prob01Max, transitionMatrix, phiStates, psiStates);
+            }
+
+            template <typename ValueType>
+            typename ModelAnalysisCache<ValueType>::QualitativeStateSets ModelAnalysisCache<ValueType>::getQualitativeStateSets(AnalysisType type, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                std::lock_guard<std::mutex> lock(mutex);
+                std::size_t phiStatesHash = std::hash<storm::storage::BitVector>()(phiStates);
+                std::size_t psiStatesHash = std::hash<storm::storage::BitVector>()(psiStates);
+                if (Entry* entry = findEntry(type, phiStatesHash, psiStatesHash, phiStates, psiStates)) {
+                    return entry->qualitativeStateSets;
+                }
+
+                // Keep the backward transitions alive, as they may be evicted when adding the new entry.
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitionsPointer = getBackwardTransitionsUnlocked(transitionMatrix);
+                storm::storage::SparseMatrix<ValueType> const& backwardTransitions = *backwardTransitionsPointer;
+                Entry entry(type, phiStatesHash, psiStatesHash, phiStates, psiStates);
+                if (type == AnalysisType::Prob01) {
+                    entry.qualitativeStateSets = storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, phiStates, psiStates);
+                } else if (type == AnalysisType::Prob01Min) {
+                    entry.qualitativeStateSets = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+                } else {
+                    STORM_LOG_ASSERT(type == AnalysisType::Prob01Max, "Unexpected type of analysis.");
+                    entry.qualitativeStateSets = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+                }
+                entry.sizeInBytes = sizeof(Entry) + 2 * phiStates.getSizeInBytes() + 2 * psiStates.getSizeInBytes();
+                QualitativeStateSets result = entry.qualitativeStateSets;
+                addEntry(std::move(entry));
+                return result;
+            }
+
+            template <typename ValueType>
+            typename ModelAnalysisCache<ValueType>::Entry* ModelAnalysisCache<ValueType>::findEntry(AnalysisType type, std::size_t phiStatesHash, std::size_t psiStatesHash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                for (auto entryIt = entries.begin(); entryIt != entries.end(); ++entryIt) {
+                    if (entryIt->type == type && entryIt->phiStatesHash == phiStatesHash && entryIt->psiStatesHash == psiStatesHash && entryIt->phiStates == phiStates && entryIt->psiStates == psiStates) {
+                        // Move the entry to the front.
+                        entries.splice(entries.begin(), entries, entryIt);
+                        ++numberOfHits;
+                        return &entries.front();
+                    }
+                }
+                return nullptr;
+            }
+
+            template <typename ValueType>
+            void ModelAnalysisCache<ValueType>::addEntry(Entry&& entry) {
+                if (entry.sizeInBytes > maximalSizeInBytes) {
+                    STORM_LOG_DEBUG("Not caching analysis result of " << entry.sizeInBytes << " bytes as it exceeds the size of the analysis cache.");
+                    return;
+                }
+                while (sizeInBytes + entry.sizeInBytes > maximalSizeInBytes) {
+                    STORM_LOG_DEBUG("Evicting least recently used entry from the analysis cache.");
+                    sizeInBytes -= entries.back().sizeInBytes;
+                    entries.pop_back();
+                }
+                sizeInBytes += entry.sizeInBytes;
+                entries.push_front(std::move(entry));
+            }
+
+            template <typename ValueType>
+            uint64_t ModelAnalysisCache<ValueType>::getSizeInBytes() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return sizeInBytes;
+            }
+
+            template <typename ValueType>
+            uint64_t ModelAnalysisCache<ValueType>::getNumberOfHits() const {
+                std::lock_guard<std::mutex> lock(mutex);
+                return numberOfHits;
+            }
+
+            template <typename ValueType>
+            void ModelAnalysisCache<ValueType>::clear() {
+                std::lock_guard<std::mutex> lock(mutex);
+                entries.clear();
+                sizeInBytes = 0;
+                numberOfHits = 0;
+            }
+
+            template class ModelAnalysisCache<double>;
+
+            // The graph analyses are not available for float, so only the backward transitions are cached.
+            template ModelAnalysisCache<float>::ModelAnalysisCache();
+            template ModelAnalysisCache<float>::ModelAnalysisCache(uint64_t maximalSizeInBytes);
+            template std::shared_ptr<storm::storage::SparseMatrix<float> const> ModelAnalysisCache<float>::getBackwardTransitions(storm::storage::SparseMatrix<float> const& transitionMatrix);
+            template uint64_t ModelAnalysisCache<float>::getSizeInBytes() const;
+            template uint64_t ModelAnalysisCache<float>::getNumberOfHits() const;
+            template void ModelAnalysisCache<float>::clear();
+
+#ifdef STORM_HAVE_CARL
+            template class ModelAnalysisCache<storm::RationalNumber>;
+            template class ModelAnalysisCache<storm::RationalFunction>;
+#endif
+        }
+    }
+}
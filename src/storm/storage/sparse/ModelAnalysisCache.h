@@ -0,0 +1,151 @@
+#ifndef STORM_STORAGE_SPARSE_MODELANALYSISCACHE_H_
+#define STORM_STORAGE_SPARSE_MODELANALYSISCACHE_H_
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace storage {
+        template <typename ValueType>
+        class StronglyConnectedComponentDecomposition;
+
+        template <typename ValueType>
+        class MaximalEndComponentDecomposition;
+
+        namespace sparse {
+
+            /*!
+             * Stores the results of graph analyses of a sparse model, such that several queries on the same model (e.g.,
+             * the properties of a batch) do not recompute them. All results refer to the transition matrix that is passed
+             * to the methods, which therefore has to be the same for all calls.
+             *
+             * All results (including the backward transitions) are evicted, least recently used first, once their
+             * estimated size exceeds the bound given by the model checker settings. Results are handed out as shared
+             * pointers, so they remain valid after their eviction.
+             * Qualitative state sets are identified by the hashes of the given phi and psi states (and, if the hashes
+             * coincide, by comparing the sets). The methods may be called concurrently.
+             */
+            template <typename ValueType>
+            class ModelAnalysisCache {
+            public:
+                typedef std::pair<storm::storage::BitVector, storm::storage::BitVector> QualitativeStateSets;
+
+                /*!
+                 * Creates a cache whose size is bounded as given by the model checker settings.
+                 */
+                ModelAnalysisCache();
+
+                /*!
+                 * Creates a cache whose results occupy at most the given number of bytes.
+                 */
+                ModelAnalysisCache(uint64_t maximalSizeInBytes);
+
+                ModelAnalysisCache(ModelAnalysisCache const& other) = delete;
+                ModelAnalysisCache& operator=(ModelAnalysisCache const& other) = delete;
+
+                /*!
+                 * Retrieves the backward transitions (as given by transpose(true)) of the given transition matrix.
+                 */
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+                /*!
+                 * Retrieves the decomposition of the given transition matrix into its bottom SCCs.
+                 */
+                std::shared_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType> const> getBottomStronglyConnectedComponents(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+                /*!
+                 * Retrieves the decomposition of the given (nondeterministic) transition matrix into its MECs.
+                 */
+                std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> getMaximalEndComponents(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+                /*!
+                 * Retrieves the states with probability 0 and 1 of satisfying phi until psi in the given deterministic
+                 * transition matrix (see storm::utility::graph::performProb01).
+                 */
+                QualitativeStateSets getProb01(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the states with minimal probability 0 and 1 of satisfying phi until psi in the given
+                 * nondeterministic transition matrix (see storm::utility::graph::performProb01Min).
+                 */
+                QualitativeStateSets getProb01Min(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the states with maximal probability 0 and 1 of satisfying phi until psi in the given
+                 * nondeterministic transition matrix (see storm::utility::graph::performProb01Max).
+                 */
+                QualitativeStateSets getProb01Max(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the estimated size of the cached results.
+                 */
+                uint64_t getSizeInBytes() const;
+
+                /*!
+                 * Retrieves how often a result was found in the cache.
+                 */
+                uint64_t getNumberOfHits() const;
+
+                /*!
+                 * Removes all results from the cache.
+                 */
+                void clear();
+
+            private:
+                enum class AnalysisType { BackwardTransitions, BottomStronglyConnectedComponents, MaximalEndComponents, Prob01, Prob01Min, Prob01Max };
+
+                struct Entry {
+                    Entry(AnalysisType type, std::size_t phiStatesHash, std::size_t psiStatesHash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                    // The analysis and (for qualitative state sets) its arguments.
+                    AnalysisType type;
+                    std::size_t phiStatesHash;
+                    std::size_t psiStatesHash;
+                    storm::storage::BitVector phiStates;
+                    storm::storage::BitVector psiStates;
+
+                    // The result of the analysis. Only the member corresponding to the type is set.
+                    QualitativeStateSets qualitativeStateSets;
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+                    std::shared_ptr<storm::storage::StronglyConnectedComponentDecomposition<ValueType> const> sccDecomposition;
+                    std::shared_ptr<storm::storage::MaximalEndComponentDecomposition<ValueType> const> mecDecomposition;
+
+                    // The estimated size of the entry.
+                    uint64_t sizeInBytes;
+                };
+
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitionsUnlocked(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+                QualitativeStateSets getQualitativeStateSets(AnalysisType type, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Retrieves the entry with the given type and arguments and nullptr if there is none. A retrieved entry
+                 * counts as most recently used.
+                 */
+                Entry* findEntry(AnalysisType type, std::size_t phiStatesHash, std::size_t psiStatesHash, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+                /*!
+                 * Adds the given entry, evicting the least recently used entries as needed. Entries that are larger than
+                 * the cache are dropped.
+                 */
+                void addEntry(Entry&& entry);
+
+                uint64_t maximalSizeInBytes;
+                uint64_t sizeInBytes;
+                uint64_t numberOfHits;
+
+                // The entries, most recently used first.
+                std::list<Entry> entries;
+
+                mutable std::mutex mutex;
+            };
+        }
+    }
+}
+
+#endif /* STORM_STORAGE_SPARSE_MODELANALYSISCACHE_H_ */
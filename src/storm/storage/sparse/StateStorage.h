@@ -15,7 +15,8 @@ namespace storm {
                 // Creates an empty state storage structure for storing states of the given bit width.
                 StateStorage(uint64_t bitsPerState);
                 
-                // This member stores all the states and maps them to their unique indices.
+                // This member stores all the states and maps them to their unique indices. The builders using this
+                // structure explore sequentially, so they do not need the ConcurrentBitVectorHashMap.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
                 
                 // A list of initial states in terms of their global indices.
@@ -0,0 +1,313 @@
+#include "storm/transformer/StateReordering.h"
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/optional.hpp>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace transformer {
+
+        std::ostream& operator<<(std::ostream& out, StateReorderingMethod const& method) {
+            switch (method) {
+                case StateReorderingMethod::Bfs:
+                    out << "bfs";
+                    break;
+                case StateReorderingMethod::ReverseCuthillMcKee:
+                    out << "rcm";
+                    break;
+            }
+            return out;
+        }
+
+        namespace detail {
+
+            template <typename ValueType>
+            std::vector<uint64_t> computeBfsOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                std::vector<uint64_t> order;
+                order.reserve(numberOfStates);
+                storm::storage::BitVector visited(numberOfStates, false);
+
+                // The order also serves as the queue of the search.
+                uint64_t head = 0;
+                auto explore = [&] () {
+                    while (head < order.size()) {
+                        uint64_t state = order[head++];
+                        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                            if (!visited.get(entry.getColumn())) {
+                                visited.set(entry.getColumn());
+                                order.push_back(entry.getColumn());
+                            }
+                        }
+                    }
+                };
+
+                for (auto state : initialStates) {
+                    visited.set(state);
+                    order.push_back(state);
+                }
+                explore();
+
+                // Unreachable states are appended, again in the order of a breadth-first search.
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    if (!visited.get(state)) {
+                        visited.set(state);
+                        order.push_back(state);
+                        explore();
+                    }
+                }
+                return order;
+            }
+
+            template <typename ValueType>
+            std::vector<uint64_t> computeReverseCuthillMcKeeOrder(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                uint64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+                // The degree of a state in the undirected graph. Parallel edges are counted multiple times, which is
+                // sufficient for a heuristic.
+                std::vector<uint64_t> degrees(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    degrees[state] = transitionMatrix.getRowGroup(state).getNumberOfEntries() + backwardTransitions.getRow(state).getNumberOfEntries();
+                }
+                auto hasSmallerDegree = [&degrees] (uint64_t const& first, uint64_t const& second) { return degrees[first] < degrees[second]; };
+
+                // Each connected component is started at a state of minimal degree.
+                std::vector<uint64_t> startCandidates(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    startCandidates[state] = state;
+                }
+                std::stable_sort(startCandidates.begin(), startCandidates.end(), hasSmallerDegree);
+
+                std::vector<uint64_t> order;
+                order.reserve(numberOfStates);
+                storm::storage::BitVector visited(numberOfStates, false);
+                std::vector<uint64_t> neighbors;
+                uint64_t head = 0;
+                for (auto startState : startCandidates) {
+                    if (visited.get(startState)) {
+                        continue;
+                    }
+                    visited.set(startState);
+                    order.push_back(startState);
+                    while (head < order.size()) {
+                        uint64_t state = order[head++];
+                        neighbors.clear();
+                        for (auto const& entry : transitionMatrix.getRowGroup(state)) {
+                            if (!visited.get(entry.getColumn())) {
+                                visited.set(entry.getColumn());
+                                neighbors.push_back(entry.getColumn());
+                            }
+                        }
+                        for (auto const& entry : backwardTransitions.getRow(state)) {
+                            if (!visited.get(entry.getColumn())) {
+                                visited.set(entry.getColumn());
+                                neighbors.push_back(entry.getColumn());
+                            }
+                        }
+                        std::stable_sort(neighbors.begin(), neighbors.end(), hasSmallerDegree);
+                        order.insert(order.end(), neighbors.begin(), neighbors.end());
+                    }
+                }
+
+                std::reverse(order.begin(), order.end());
+                return order;
+            }
+
+            /*!
+             * Builds the matrix whose i-th row is the newToOldRowMapping[i]-th row of the given matrix, where column j
+             * of the given matrix is moved to column oldToNewColumnMapping[j].
+             */
+            template <typename MatrixValueType>
+            storm::storage::SparseMatrix<MatrixValueType> permuteMatrix(storm::storage::SparseMatrix<MatrixValueType> const& matrix, std::vector<uint64_t> const& newToOldRowMapping, std::vector<uint64_t> const& oldToNewColumnMapping, std::vector<uint64_t> const* newRowGroupIndices) {
+                uint64_t numberOfRowGroups = newRowGroupIndices ? newRowGroupIndices->size() - 1 : 0;
+                storm::storage::SparseMatrixBuilder<MatrixValueType> builder(newToOldRowMapping.size(), matrix.getColumnCount(), matrix.getEntryCount(), true, newRowGroupIndices != nullptr, numberOfRowGroups);
+                std::vector<std::pair<uint64_t, MatrixValueType>> rowEntries;
+                uint64_t rowGroup = 0;
+                for (uint64_t newRow = 0; newRow < newToOldRowMapping.size(); ++newRow) {
+                    if (newRowGroupIndices && (*newRowGroupIndices)[rowGroup] == newRow) {
+                        builder.newRowGroup(newRow);
+                        ++rowGroup;
+                    }
+
+                    // The builder requires the entries of a row to be sorted by column.
+                    rowEntries.clear();
+                    for (auto const& entry : matrix.getRow(newToOldRowMapping[newRow])) {
+                        rowEntries.emplace_back(oldToNewColumnMapping[entry.getColumn()], entry.getValue());
+                    }
+                    std::sort(rowEntries.begin(), rowEntries.end(), [] (std::pair<uint64_t, MatrixValueType> const& first, std::pair<uint64_t, MatrixValueType> const& second) { return first.first < second.first; });
+                    for (auto const& entry : rowEntries) {
+                        builder.addNextValue(newRow, entry.first, entry.second);
+                    }
+                }
+                return builder.build();
+            }
+
+            template <typename T>
+            std::vector<T> permuteVector(std::vector<T> const& vector, std::vector<uint64_t> const& newToOldMapping) {
+                std::vector<T> result;
+                result.reserve(newToOldMapping.size());
+                for (auto const& oldIndex : newToOldMapping) {
+                    result.push_back(vector[oldIndex]);
+                }
+                return result;
+            }
+
+            storm::storage::BitVector permuteBitVector(storm::storage::BitVector const& bitVector, std::vector<uint64_t> const& oldToNewMapping) {
+                storm::storage::BitVector result(bitVector.size(), false);
+                for (auto const& oldIndex : bitVector) {
+                    result.set(oldToNewMapping[oldIndex]);
+                }
+                return result;
+            }
+
+            storm::models::sparse::StateLabeling permuteStateLabeling(storm::models::sparse::StateLabeling const& labeling, std::vector<uint64_t> const& oldToNewStateIndexMapping) {
+                storm::models::sparse::StateLabeling result(oldToNewStateIndexMapping.size());
+                for (auto const& label : labeling.getLabels()) {
+                    result.addLabel(label, permuteBitVector(labeling.getStates(label), oldToNewStateIndexMapping));
+                }
+                return result;
+            }
+
+            storm::models::sparse::ChoiceLabeling permuteChoiceLabeling(storm::models::sparse::ChoiceLabeling const& labeling, std::vector<uint64_t> const& oldToNewChoiceIndexMapping) {
+                storm::models::sparse::ChoiceLabeling result(oldToNewChoiceIndexMapping.size());
+                for (auto const& label : labeling.getLabels()) {
+                    result.addLabel(label, permuteBitVector(labeling.getChoices(label), oldToNewChoiceIndexMapping));
+                }
+                return result;
+            }
+        }
+
+        template <typename ValueType>
+        std::vector<uint64_t> computeStateReordering(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, StateReorderingMethod method) {
+            switch (method) {
+                case StateReorderingMethod::Bfs:
+                    return detail::computeBfsOrder(transitionMatrix, initialStates);
+                case StateReorderingMethod::ReverseCuthillMcKee:
+                    return detail::computeReverseCuthillMcKeeOrder(transitionMatrix);
+            }
+            STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown state reordering method.");
+        }
+
+        template <typename ValueType, typename RewardModelType>
+        StateReorderingReturnType<ValueType, RewardModelType> reorderStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping) {
+            STORM_LOG_THROW(!originalModel.isOfType(storm::models::ModelType::S2pg), storm::exceptions::NotSupportedException, "Reordering the states of a " << originalModel.getType() << " is not supported.");
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = originalModel.getTransitionMatrix();
+            uint64_t numberOfStates = originalModel.getNumberOfStates();
+            STORM_LOG_THROW(newToOldStateIndexMapping.size() == numberOfStates, storm::exceptions::InvalidArgumentException, "The state mapping has " << newToOldStateIndexMapping.size() << " entries, but the model has " << numberOfStates << " states.");
+
+            StateReorderingReturnType<ValueType, RewardModelType> result;
+            result.newToOldStateIndexMapping = newToOldStateIndexMapping;
+            result.oldToNewStateIndexMapping.assign(numberOfStates, std::numeric_limits<uint64_t>::max());
+            for (uint64_t newState = 0; newState < numberOfStates; ++newState) {
+                uint64_t oldState = newToOldStateIndexMapping[newState];
+                STORM_LOG_THROW(oldState < numberOfStates && result.oldToNewStateIndexMapping[oldState] == std::numeric_limits<uint64_t>::max(), storm::exceptions::InvalidArgumentException, "The state mapping is not a permutation.");
+                result.oldToNewStateIndexMapping[oldState] = newState;
+            }
+
+            // The choices of each state keep their relative order.
+            boost::optional<std::vector<uint64_t>> newRowGroupIndices;
+            if (!transitionMatrix.hasTrivialRowGrouping()) {
+                newRowGroupIndices = std::vector<uint64_t>();
+                newRowGroupIndices->reserve(numberOfStates + 1);
+            }
+            result.newToOldChoiceIndexMapping.reserve(transitionMatrix.getRowCount());
+            for (auto const& oldState : newToOldStateIndexMapping) {
+                if (newRowGroupIndices) {
+                    newRowGroupIndices->push_back(result.newToOldChoiceIndexMapping.size());
+                }
+                for (uint64_t oldChoice = transitionMatrix.getRowGroupIndices()[oldState]; oldChoice < transitionMatrix.getRowGroupIndices()[oldState + 1]; ++oldChoice) {
+                    result.newToOldChoiceIndexMapping.push_back(oldChoice);
+                }
+            }
+            if (newRowGroupIndices) {
+                newRowGroupIndices->push_back(result.newToOldChoiceIndexMapping.size());
+            }
+            std::vector<uint64_t> const* newRowGroupIndicesPointer = newRowGroupIndices ? &newRowGroupIndices.get() : nullptr;
+            std::vector<uint64_t> oldToNewChoiceIndexMapping(result.newToOldChoiceIndexMapping.size());
+            for (uint64_t newChoice = 0; newChoice < result.newToOldChoiceIndexMapping.size(); ++newChoice) {
+                oldToNewChoiceIndexMapping[result.newToOldChoiceIndexMapping[newChoice]] = newChoice;
+            }
+
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(detail::permuteMatrix(transitionMatrix, result.newToOldChoiceIndexMapping, result.oldToNewStateIndexMapping, newRowGroupIndicesPointer));
+            components.stateLabeling = detail::permuteStateLabeling(originalModel.getStateLabeling(), result.oldToNewStateIndexMapping);
+            for (auto const& rewardModel : originalModel.getRewardModels()) {
+                typedef typename RewardModelType::ValueType RewardValueType;
+                boost::optional<std::vector<RewardValueType>> stateRewardVector;
+                boost::optional<std::vector<RewardValueType>> stateActionRewardVector;
+                boost::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewardMatrix;
+                if (rewardModel.second.hasStateRewards()) {
+                    stateRewardVector = detail::permuteVector(rewardModel.second.getStateRewardVector(), newToOldStateIndexMapping);
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    stateActionRewardVector = detail::permuteVector(rewardModel.second.getStateActionRewardVector(), result.newToOldChoiceIndexMapping);
+                }
+                if (rewardModel.second.hasTransitionRewards()) {
+                    auto const& oldTransitionRewardMatrix = rewardModel.second.getTransitionRewardMatrix();
+                    transitionRewardMatrix = detail::permuteMatrix(oldTransitionRewardMatrix, result.newToOldChoiceIndexMapping, result.oldToNewStateIndexMapping, oldTransitionRewardMatrix.hasTrivialRowGrouping() ? nullptr : newRowGroupIndicesPointer);
+                }
+                components.rewardModels.emplace(rewardModel.first, RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix)));
+            }
+            if (originalModel.hasChoiceLabeling()) {
+                components.choiceLabeling = detail::permuteChoiceLabeling(originalModel.getChoiceLabeling(), oldToNewChoiceIndexMapping);
+            }
+            if (originalModel.hasStateValuations()) {
+                components.stateValuations = originalModel.getStateValuations().selectStates(newToOldStateIndexMapping);
+            }
+            if (originalModel.hasChoiceOrigins()) {
+                components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(result.newToOldChoiceIndexMapping);
+            }
+
+            if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+                auto const& ctmc = *originalModel.template as<storm::models::sparse::Ctmc<ValueType, RewardModelType>>();
+                components.exitRates = detail::permuteVector(ctmc.getExitRateVector(), newToOldStateIndexMapping);
+                components.rateTransitions = true;
+            } else if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                auto const& ma = *originalModel.template as<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType>>();
+                components.markovianStates = detail::permuteBitVector(ma.getMarkovianStates(), result.oldToNewStateIndexMapping);
+                components.exitRates = detail::permuteVector(ma.getExitRates(), newToOldStateIndexMapping);
+                components.rateTransitions = false; // Note that the transition matrix of a Markov automaton contains probabilities.
+            } else if (originalModel.isOfType(storm::models::ModelType::Pomdp)) {
+                auto const& pomdp = *originalModel.template as<storm::models::sparse::Pomdp<ValueType, RewardModelType>>();
+                components.observabilityClasses = detail::permuteVector(pomdp.getObservations(), newToOldStateIndexMapping);
+            }
+
+            result.model = storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+            return result;
+        }
+
+        template <typename ValueType, typename RewardModelType>
+        StateReorderingReturnType<ValueType, RewardModelType> reorderStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, StateReorderingMethod method) {
+            std::vector<uint64_t> newToOldStateIndexMapping = computeStateReordering(originalModel.getTransitionMatrix(), originalModel.getInitialStates(), method);
+            STORM_LOG_DEBUG("Reordering the states of the model with method '" << method << "'.");
+            return reorderStates(originalModel, newToOldStateIndexMapping);
+        }
+
+        template std::vector<uint64_t> computeStateReordering(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& initialStates, StateReorderingMethod method);
+        template StateReorderingReturnType<double> reorderStates(storm::models::sparse::Model<double> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+        template StateReorderingReturnType<double> reorderStates(storm::models::sparse::Model<double> const& originalModel, StateReorderingMethod method);
+
+#ifdef STORM_HAVE_CARL
+        template std::vector<uint64_t> computeStateReordering(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& initialStates, StateReorderingMethod method);
+        template StateReorderingReturnType<storm::RationalNumber> reorderStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+        template StateReorderingReturnType<storm::RationalNumber> reorderStates(storm::models::sparse::Model<storm::RationalNumber> const& originalModel, StateReorderingMethod method);
+
+        template std::vector<uint64_t> computeStateReordering(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& initialStates, StateReorderingMethod method);
+        template StateReorderingReturnType<storm::RationalFunction> reorderStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+        template StateReorderingReturnType<storm::RationalFunction> reorderStates(storm::models::sparse::Model<storm::RationalFunction> const& originalModel, StateReorderingMethod method);
+#endif
+    }
+}
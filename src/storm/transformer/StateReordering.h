@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/Scheduler.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+namespace storm {
+    namespace transformer {
+
+        /*!
+         * The methods to compute a new order of the states of a model.
+         */
+        enum class StateReorderingMethod {
+            // States are ordered as they are discovered by a breadth-first search from the initial states.
+            Bfs,
+            // The reverse Cuthill-McKee order of the (undirected) graph underlying the model, which reduces the bandwidth of the transition matrix.
+            ReverseCuthillMcKee
+        };
+
+        std::ostream& operator<<(std::ostream& out, StateReorderingMethod const& method);
+
+        template <typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        struct StateReorderingReturnType {
+            // The resulting model
+            std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+            // Gives for each state in the resulting model the corresponding state in the original model.
+            std::vector<uint64_t> newToOldStateIndexMapping;
+            // Gives for each state in the original model the corresponding state in the resulting model.
+            std::vector<uint64_t> oldToNewStateIndexMapping;
+            // Gives for each choice in the resulting model the corresponding choice in the original model.
+            std::vector<uint64_t> newToOldChoiceIndexMapping;
+        };
+
+        /*!
+         * Computes a new order of the states of the model with the given transition matrix such that the states that
+         * are connected by a transition tend to have nearby indices. This improves the locality of memory accesses
+         * when multiplying the matrix with a vector.
+         *
+         * @param transitionMatrix The transition matrix of the model.
+         * @param initialStates The initial states of the model.
+         * @param method The method used to compute the order.
+         * @return For each position in the new order the corresponding (old) state.
+         */
+        template <typename ValueType>
+        std::vector<uint64_t> computeStateReordering(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& initialStates, StateReorderingMethod method);
+
+        /*!
+         * Renumbers the states of the given model according to the given mapping. The choices of each state keep
+         * their relative order. All components of the model (labelings, reward models, state valuations, choice origins,
+         * etc.) are renumbered accordingly, so the resulting model is isomorphic to the original one.
+         *
+         * @param originalModel The original model.
+         * @param newToOldStateIndexMapping For each state of the resulting model the corresponding state of the original model. This has to be a permutation.
+         */
+        template <typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        StateReorderingReturnType<ValueType, RewardModelType> reorderStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<uint64_t> const& newToOldStateIndexMapping);
+
+        /*!
+         * Renumbers the states of the given model according to the order computed by the given method.
+         */
+        template <typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        StateReorderingReturnType<ValueType, RewardModelType> reorderStates(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, StateReorderingMethod method);
+
+        /*!
+         * Maps values that refer to the states of a reordered model back to the states of the original model.
+         *
+         * @param values The values for the states of the reordered model.
+         * @param newToOldStateIndexMapping For each state of the reordered model the corresponding state of the original model.
+         * @return The values for the states of the original model.
+         */
+        template <typename T>
+        std::vector<T> mapStateValuesToOriginalModel(std::vector<T> const& values, std::vector<uint64_t> const& newToOldStateIndexMapping) {
+            std::vector<T> result(values.size());
+            for (uint64_t newState = 0; newState < newToOldStateIndexMapping.size(); ++newState) {
+                result[newToOldStateIndexMapping[newState]] = values[newState];
+            }
+            return result;
+        }
+
+        /*!
+         * Maps a scheduler for a reordered model back to the states of the original model. As the choices of each
+         * state keep their relative order, the choices themselves remain unchanged.
+         *
+         * @param scheduler The scheduler for the reordered model.
+         * @param newToOldStateIndexMapping For each state of the reordered model the corresponding state of the original model.
+         * @return The scheduler for the original model.
+         */
+        template <typename ValueType>
+        storm::storage::Scheduler<ValueType> mapSchedulerToOriginalModel(storm::storage::Scheduler<ValueType> const& scheduler, std::vector<uint64_t> const& newToOldStateIndexMapping) {
+            storm::storage::Scheduler<ValueType> result(newToOldStateIndexMapping.size(), scheduler.getMemoryStructure());
+            for (uint64_t memoryState = 0; memoryState < scheduler.getNumberOfMemoryStates(); ++memoryState) {
+                for (uint64_t newState = 0; newState < newToOldStateIndexMapping.size(); ++newState) {
+                    result.setChoice(scheduler.getChoice(newState, memoryState), newToOldStateIndexMapping[newState], memoryState);
+                }
+            }
+            return result;
+        }
+    }
+}
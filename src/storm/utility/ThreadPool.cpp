@@ -0,0 +1,120 @@
+#include "storm/utility/ThreadPool.h"
+
+#include <atomic>
+
+namespace storm {
+    namespace utility {
+
+        ThreadPool::ThreadPool(uint64_t numberOfThreads) : currentTask(nullptr), taskCounter(0), runningWorkers(0), shutdown(false) {
+            for (uint64_t threadIndex = 1; threadIndex < numberOfThreads; ++threadIndex) {
+                workers.emplace_back(&ThreadPool::work, this, threadIndex);
+            }
+        }
+
+        ThreadPool::~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                shutdown = true;
+            }
+            taskAvailable.notify_all();
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        }
+
+        uint64_t ThreadPool::getNumberOfThreads() const {
+            return workers.size() + 1;
+        }
+
+        void ThreadPool::execute(std::function<void(uint64_t)> const& task) {
+            if (workers.empty()) {
+                task(0);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                currentTask = &task;
+                runningWorkers = workers.size();
+                workerException = nullptr;
+                ++taskCounter;
+            }
+            taskAvailable.notify_all();
+
+            // The calling thread takes its share of the work.
+            std::exception_ptr callerException;
+            try {
+                task(0);
+            } catch (...) {
+                callerException = std::current_exception();
+            }
+
+            std::exception_ptr exception;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                taskFinished.wait(lock, [this] { return runningWorkers == 0; });
+                currentTask = nullptr;
+                exception = callerException ? callerException : workerException;
+                workerException = nullptr;
+            }
+            if (exception) {
+                std::rethrow_exception(exception);
+            }
+        }
+
+        void ThreadPool::parallelFor(uint64_t count, std::function<void(uint64_t)> const& task) {
+            if (count == 0) {
+                return;
+            }
+            if (workers.empty() || count == 1) {
+                for (uint64_t index = 0; index < count; ++index) {
+                    task(index);
+                }
+                return;
+            }
+
+            std::atomic<uint64_t> nextIndex(0);
+            execute([&] (uint64_t) {
+                for (uint64_t index = nextIndex.fetch_add(1, std::memory_order_relaxed); index < count; index = nextIndex.fetch_add(1, std::memory_order_relaxed)) {
+                    task(index);
+                }
+            });
+        }
+
+        void ThreadPool::work(uint64_t threadIndex) {
+            uint64_t lastTask = 0;
+            while (true) {
+                std::function<void(uint64_t)> const* task;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    taskAvailable.wait(lock, [this, lastTask] { return shutdown || taskCounter != lastTask; });
+                    if (shutdown) {
+                        return;
+                    }
+                    lastTask = taskCounter;
+                    task = currentTask;
+                }
+
+                std::exception_ptr exception;
+                try {
+                    (*task)(threadIndex);
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+
+                bool lastWorker;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (exception && !workerException) {
+                        workerException = exception;
+                    }
+                    lastWorker = --runningWorkers == 0;
+                }
+                if (lastWorker) {
+                    taskFinished.notify_one();
+                }
+            }
+        }
+
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * A simple fork-join pool of worker threads. The threads are started upon construction and sleep until a task
+         * is submitted. The thread submitting a task participates in its execution, i.e., a pool with n threads
+         * starts n - 1 additional threads.
+         *
+         * Tasks must not submit further tasks to the same pool and a pool must not be used by several threads at once.
+         */
+        class ThreadPool {
+        public:
+            /*!
+             * Creates a pool with the given number of threads (including the calling thread).
+             *
+             * @param numberOfThreads The number of threads. A value of zero is treated as one.
+             */
+            ThreadPool(uint64_t numberOfThreads);
+
+            ~ThreadPool();
+
+            ThreadPool(ThreadPool const& other) = delete;
+            ThreadPool& operator=(ThreadPool const& other) = delete;
+
+            /*!
+             * Retrieves the number of threads of this pool (including the calling thread).
+             */
+            uint64_t getNumberOfThreads() const;
+
+            /*!
+             * Executes the given task once on every thread of the pool and returns after all threads have finished.
+             * The task is given the index of the executing thread, where the calling thread has index zero. If a task
+             * throws, the (first) exception is rethrown after all threads have finished.
+             *
+             * @param task The task to execute.
+             */
+            void execute(std::function<void(uint64_t)> const& task);
+
+            /*!
+             * Executes the given task for all indices in [0, count). The indices are dynamically distributed over the
+             * threads of the pool, so the task must be safe to execute concurrently for different indices.
+             *
+             * @param count The number of indices.
+             * @param task The task to execute for each index.
+             */
+            void parallelFor(uint64_t count, std::function<void(uint64_t)> const& task);
+
+        private:
+            void work(uint64_t threadIndex);
+
+            // The additional threads of the pool.
+            std::vector<std::thread> workers;
+
+            // Protects all of the following members.
+            std::mutex mutex;
+
+            // Used to wake up the workers if a new task is available (or the pool is shut down).
+            std::condition_variable taskAvailable;
+
+            // Used to notify the submitting thread that all workers finished the current task.
+            std::condition_variable taskFinished;
+
+            // The currently executed task.
+            std::function<void(uint64_t)> const* currentTask;
+
+            // Counts the submitted tasks so that workers can distinguish new tasks from the one they already executed.
+            uint64_t taskCounter;
+
+            // The number of workers that have not finished the current task.
+            uint64_t runningWorkers;
+
+            // A flag indicating whether the workers are supposed to terminate.
+            bool shutdown;
+
+            // The first exception thrown by a worker for the current task (if any).
+            std::exception_ptr workerException;
+        };
+
+    }
+}
@@ -20,10 +20,17 @@
 #include "storm/models/sparse/NondeterministicModel.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/ThreadPool.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <algorithm>
+#include <functional>
+#include <memory>
 #include <queue>
 
 namespace storm {
@@ -293,62 +300,243 @@ namespace storm {
                 return distances;
             }
             
-            template <typename T>
-            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-                // Prepare the resulting bit vector.
-                uint_fast64_t numberOfStates = phiStates.size();
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as they already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states.
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
+            namespace detail {
+                // A level is processed bottom-up if the edges leaving its frontier exceed this fraction of the edges of
+                // the candidate states that were not yet added.
+                uint64_t const bottomUpEdgeFactor = 14;
+
+                // A bottom-up search switches back to top-down once the frontier has less than this fraction of the
+                // candidate states.
+                uint64_t const topDownStateFactor = 24;
+
+                // Searches over fewer candidate states are performed sequentially, even if several threads are available.
+                uint64_t const minimalNumberOfStatesForParallelSearch = 1ull << 16;
+
+                // The number of states (a multiple of the word size) or frontier states that are handled as one unit of
+                // work by a thread.
+                uint64_t const statesPerChunk = 1ull << 14;
+
+                /*!
+                 * Executes the given task for all chunks of the given number of items, in parallel if a thread pool is
+                 * given. The task is given the index of the chunk and the range of its items.
+                 */
+                inline void forEachChunk(storm::utility::ThreadPool* pool, uint64_t numberOfItems, std::function<void(uint64_t, uint64_t, uint64_t)> const& task) {
+                    uint64_t numberOfChunks = (numberOfItems + statesPerChunk - 1) / statesPerChunk;
+                    auto chunkTask = [&] (uint64_t chunk) { task(chunk, chunk * statesPerChunk, std::min((chunk + 1) * statesPerChunk, numberOfItems)); };
+                    if (pool) {
+                        pool->parallelFor(numberOfChunks, chunkTask);
+                    } else {
+                        for (uint64_t chunk = 0; chunk < numberOfChunks; ++chunk) {
+                            chunkTask(chunk);
+                        }
                     }
                 }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while (!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                        if(currentStepBound == 0) {
-                            continue;
+
+                /*!
+                 * Creates a thread pool for searches over the given candidate states with a transition matrix if several
+                 * threads are given by the core settings and there are enough candidates. Otherwise, nullptr is returned
+                 * and the searches are performed sequentially.
+                 */
+                inline std::unique_ptr<storm::utility::ThreadPool> createSearchThreadPool(storm::storage::BitVector const& candidateStates) {
+                    if (storm::settings::hasModule<storm::settings::modules::CoreSettings>() && candidateStates.getNumberOfSetBits() >= minimalNumberOfStatesForParallelSearch) {
+                        uint64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::CoreSettings>().getNumberOfThreads();
+                        if (numberOfThreads > 1) {
+                            return std::make_unique<storm::utility::ThreadPool>(numberOfThreads);
                         }
-                        
                     }
-                    
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
-                        if (phiStates[entryIt->getColumn()] && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                            statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // As there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
+                    return nullptr;
+                }
+
+                /*!
+                 * Computes the least set of states that contains the given initial states and every candidate state that
+                 * satisfies the given condition with respect to the set. The condition must be monotone and may only hold
+                 * for states that have a successor in the set.
+                 *
+                 * The set is computed by a level-synchronous breadth-first search. Levels with small frontiers are
+                 * processed top-down, i.e., the condition is checked for the predecessors of the frontier. If the
+                 * transition matrix is given, levels with large frontiers are processed bottom-up, i.e., the condition is
+                 * checked once for each remaining candidate (obtained by word-level operations on bit vectors), which
+                 * avoids checking the same candidate for many of its successors. If a thread pool is given, the levels of
+                 * searches with a transition matrix are processed by its threads.
+                 *
+                 * @param transitionMatrix If given, the transition matrix used to determine the cost of bottom-up levels.
+                 * @param backwardTransitions The reversed transition relation.
+                 * @param candidateStates The states that may be added to the set.
+                 * @param initialStates The initial states of the set.
+                 * @param condition A function that decides whether the given candidate state is added given the set found
+                 * in the previous levels. The function is called concurrently and must thus not modify shared data.
+                 * @param pool If given, the thread pool used for the search (see createSearchThreadPool). It is created by the
+                 * caller, so that fixpoint computations performing many searches only start the threads once.
+                 * @param maximalSteps If given, at most this many levels are performed.
+                 * @return The computed set of states.
+                 */
+                template <typename T, typename Condition>
+                storm::storage::BitVector performBackwardSearch(storm::storage::SparseMatrix<T> const* transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& candidateStates, storm::storage::BitVector const& initialStates, Condition const& condition, storm::utility::ThreadPool* pool, boost::optional<uint_fast64_t> const& maximalSteps = boost::none) {
+                    uint64_t numberOfStates = initialStates.size();
+                    storm::storage::BitVector states(initialStates);
+                    std::vector<uint64_t> frontier(initialStates.begin(), initialStates.end());
+
+                    // If neither bottom-up levels nor a step bound are relevant, the levels do not matter and we perform
+                    // a depth-first search, which needs less memory for its stack.
+                    if (!transitionMatrix && !maximalSteps) {
+                        while (!frontier.empty()) {
+                            uint64_t state = frontier.back();
+                            frontier.pop_back();
+                            for (auto const& entry : backwardTransitions.getRow(state)) {
+                                uint64_t predecessor = entry.getColumn();
+                                if (candidateStates.get(predecessor) && !states.get(predecessor) && condition(predecessor, states)) {
+                                    states.set(predecessor);
+                                    frontier.push_back(predecessor);
+                                }
                             }
-                            stack.push_back(entryIt->getColumn());
                         }
+                        return states;
                     }
+
+                    std::vector<uint64_t> nextFrontier;
+                    storm::storage::BitVector inNextFrontier(numberOfStates);
+
+                    // Without the transition matrix, the condition is cheap, so the search is performed sequentially.
+                    uint64_t numberOfCandidates = candidateStates.getNumberOfSetBits();
+                    if (!transitionMatrix) {
+                        pool = nullptr;
+                    }
+
+                    // Keep track of the number of edges that need to be considered by the two kinds of levels. For the
+                    // bottom-up levels, we use the edges of all states not yet added as an upper bound.
+                    uint64_t frontierEdges = 0;
+                    uint64_t remainingEdges = 0;
+                    if (transitionMatrix) {
+                        for (auto state : frontier) {
+                            frontierEdges += backwardTransitions.getRow(state).getNumberOfEntries();
+                            remainingEdges -= transitionMatrix->getRowGroupEntryCount(state);
+                        }
+                        remainingEdges += transitionMatrix->getEntryCount();
+                    }
+
+                    bool bottomUp = false;
+                    std::vector<std::vector<uint64_t>> chunkResults;
+                    for (uint_fast64_t level = 0; !frontier.empty() && (!maximalSteps || level < maximalSteps.get()); ++level) {
+                        if (transitionMatrix) {
+                            if (!bottomUp && frontierEdges > remainingEdges / bottomUpEdgeFactor) {
+                                bottomUp = true;
+                            } else if (bottomUp && frontier.size() < numberOfCandidates / topDownStateFactor) {
+                                bottomUp = false;
+                            }
+                        }
+
+                        nextFrontier.clear();
+                        if (bottomUp) {
+                            // As the chunks are aligned to the words of the bit vectors, the threads set disjoint words.
+                            storm::storage::BitVector remainingStates = candidateStates & ~states;
+                            forEachChunk(pool, numberOfStates, [&] (uint64_t, uint64_t begin, uint64_t end) {
+                                for (uint64_t state = remainingStates.getNextSetIndex(begin); state < end; state = remainingStates.getNextSetIndex(state + 1)) {
+                                    if (condition(state, states)) {
+                                        inNextFrontier.set(state);
+                                    }
+                                }
+                            });
+                            nextFrontier.insert(nextFrontier.end(), inNextFrontier.begin(), inNextFrontier.end());
+                        } else if (pool) {
+                            // The threads collect the states they found and the frontier is assembled afterwards.
+                            chunkResults.resize((frontier.size() + statesPerChunk - 1) / statesPerChunk);
+                            forEachChunk(pool, frontier.size(), [&] (uint64_t chunk, uint64_t begin, uint64_t end) {
+                                chunkResults[chunk].clear();
+                                for (uint64_t position = begin; position < end; ++position) {
+                                    for (auto const& entry : backwardTransitions.getRow(frontier[position])) {
+                                        uint64_t predecessor = entry.getColumn();
+                                        if (candidateStates.get(predecessor) && !states.get(predecessor) && condition(predecessor, states)) {
+                                            chunkResults[chunk].push_back(predecessor);
+                                        }
+                                    }
+                                }
+                            });
+                            for (uint64_t chunk = 0; chunk < (frontier.size() + statesPerChunk - 1) / statesPerChunk; ++chunk) {
+                                for (auto state : chunkResults[chunk]) {
+                                    if (!inNextFrontier.get(state)) {
+                                        inNextFrontier.set(state);
+                                        nextFrontier.push_back(state);
+                                    }
+                                }
+                            }
+                        } else if (!maximalSteps) {
+                            // Without a step bound, the condition may also consider the states of the current level, so we
+                            // add the states right away.
+                            for (auto state : frontier) {
+                                for (auto const& entry : backwardTransitions.getRow(state)) {
+                                    uint64_t predecessor = entry.getColumn();
+                                    if (candidateStates.get(predecessor) && !states.get(predecessor) && condition(predecessor, states)) {
+                                        states.set(predecessor);
+                                        nextFrontier.push_back(predecessor);
+                                    }
+                                }
+                            }
+                        } else {
+                            for (auto state : frontier) {
+                                for (auto const& entry : backwardTransitions.getRow(state)) {
+                                    uint64_t predecessor = entry.getColumn();
+                                    if (candidateStates.get(predecessor) && !states.get(predecessor) && !inNextFrontier.get(predecessor) && condition(predecessor, states)) {
+                                        inNextFrontier.set(predecessor);
+                                        nextFrontier.push_back(predecessor);
+                                    }
+                                }
+                            }
+                        }
+
+                        // Otherwise, we only add the found states now, so the condition is checked against the previous levels.
+                        frontierEdges = 0;
+                        for (auto state : nextFrontier) {
+                            states.set(state);
+                            inNextFrontier.set(state, false);
+                            if (transitionMatrix) {
+                                frontierEdges += backwardTransitions.getRow(state).getNumberOfEntries();
+                                remainingEdges -= transitionMatrix->getRowGroupEntryCount(state);
+                            }
+                        }
+                        std::swap(frontier, nextFrontier);
+                    }
+
+                    return states;
+                }
+
+                /*!
+                 * Computes the phi states that can reach a psi state with positive probability (under some choice, if the
+                 * model is nondeterministic). If the transition matrix is given, the search may process its levels
+                 * bottom-up and in parallel (see performBackwardSearch).
+                 */
+                template <typename T>
+                storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const* transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, storm::utility::ThreadPool* pool) {
+                    boost::optional<uint_fast64_t> stepBound = useStepBound ? boost::optional<uint_fast64_t>(maximalSteps) : boost::none;
+                    if (!transitionMatrix) {
+                        // Every phi state with a successor that has a positive probability has a positive probability itself.
+                        return performBackwardSearch<T>(nullptr, backwardTransitions, phiStates, psiStates, [] (uint64_t, storm::storage::BitVector const&) { return true; }, nullptr, stepBound);
+                    }
+
+                    // The (possibly trivial) row grouping is created on demand, so we make sure it exists before the threads access it.
+                    transitionMatrix->getRowGroupIndices();
+
+                    // Bottom-up levels need to check whether a candidate has a (non-zero) transition into the states found so far.
+                    auto condition = [transitionMatrix] (uint64_t state, storm::storage::BitVector const& states) {
+                        for (auto const& entry : transitionMatrix->getRowGroup(state)) {
+                            if (states.get(entry.getColumn()) && !storm::utility::isZero(entry.getValue())) {
+                                return true;
+                            }
+                        }
+                        return false;
+                    };
+                    return performBackwardSearch(transitionMatrix, backwardTransitions, phiStates, psiStates, condition, pool, stepBound);
                 }
-                
-                // Return result.
-                return statesWithProbabilityGreater0;
+            }
+
+            template <typename T>
+            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                return detail::performProbGreater0<T>(nullptr, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps, nullptr);
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                return detail::performProbGreater0(&transitionMatrix, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps, pool.get());
             }
             
             template <typename T>
@@ -368,10 +556,17 @@ namespace storm {
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<T> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                return performProb01(model.getTransitionMatrix(), model.getBackwardTransitions(), phiStates, psiStates);
+            }
+            
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-                storm::storage::SparseMatrix<T> backwardTransitions = model.getBackwardTransitions();
-                result.first = performProbGreater0(backwardTransitions, phiStates, psiStates);
-                result.second = performProb1(backwardTransitions, phiStates, psiStates, result.first);
+                // Both searches share the threads.
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                result.first = detail::performProbGreater0(&transitionMatrix, backwardTransitions, phiStates, psiStates, false, 0, pool.get());
+                result.second = detail::performProbGreater0(&transitionMatrix, backwardTransitions, ~psiStates, ~result.first, false, 0, pool.get());
+                result.second.complement();
                 result.first.complement();
                 return result;
             }
@@ -603,58 +798,14 @@ namespace storm {
             
             template <typename T>
             storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
-                size_t numberOfStates = phiStates.size();
-                
-                // Prepare resulting bit vector.
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as the already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
-                    }
-                }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while (!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                        if (currentStepBound == 0) {
-                            continue;
-                        }
-                    }
-                    
-                    for (typename storm::storage::SparseMatrix<T>::const_iterator entryIt = backwardTransitions.begin(currentState), entryIte = backwardTransitions.end(currentState); entryIt != entryIte; ++entryIt) {
-                        if (phiStates.get(entryIt->getColumn()) && (!statesWithProbabilityGreater0.get(entryIt->getColumn()) || (useStepBound && remainingSteps[entryIt->getColumn()] < currentStepBound - 1))) {
-                            // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                            if (useStepBound) {
-                                // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                remainingSteps[entryIt->getColumn()] = currentStepBound - 1;
-                                stepStack.push_back(currentStepBound - 1);
-                            }
-                            statesWithProbabilityGreater0.set(entryIt->getColumn(), true);
-                            stack.push_back(entryIt->getColumn());
-                        }
-                    }
-                }
-                
-                return statesWithProbabilityGreater0;
+                // Every phi state with a choice that leads to a state with positive probability has a positive probability itself.
+                return detail::performProbGreater0<T>(nullptr, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps, nullptr);
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps) {
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                return detail::performProbGreater0(&transitionMatrix, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps, pool.get());
             }
             
             template <typename T>
@@ -670,51 +821,35 @@ namespace storm {
                 
                 // Initialize the environment for the iterative algorithm.
                 storm::storage::BitVector currentStates(numberOfStates, true);
-                std::vector<uint_fast64_t> stack;
-                stack.reserve(numberOfStates);
                 
-                // Perform the loop as long as the set of states gets larger.
-                bool done = false;
-                uint_fast64_t currentState;
-                while (!done) {
-                    stack.clear();
-                    storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-                    
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
-                        
-                        for (typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for one of the
-                                // nondeterminstic choices.
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    if (!choiceConstraint || choiceConstraint.get().get(row)) {
-                                        bool allSuccessorsInCurrentStates = true;
-                                        bool hasNextStateSuccessor = false;
-                                        for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                            if (!currentStates.get(successorEntryIt->getColumn())) {
-                                                allSuccessorsInCurrentStates = false;
-                                                break;
-                                            } else if (nextStates.get(successorEntryIt->getColumn())) {
-                                                hasNextStateSuccessor = true;
-                                            }
-                                        }
-                                        
-                                        // If all successors for a given nondeterministic choice are in the current state set, we
-                                        // add it to the set of states for the next iteration and perform a backward search from
-                                        // that state.
-                                        if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
-                                            nextStates.set(predecessorEntryIt->getColumn(), true);
-                                            stack.push_back(predecessorEntryIt->getColumn());
-                                            break;
-                                        }
-                                    }
+                // A state is added if one of its nondeterministic choices has only successors in the current state set
+                // and at least one successor in the states found so far.
+                auto condition = [&] (uint64_t state, storm::storage::BitVector const& nextStates) {
+                    for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                        if (!choiceConstraint || choiceConstraint.get().get(row)) {
+                            bool allSuccessorsInCurrentStates = true;
+                            bool hasNextStateSuccessor = false;
+                            for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                if (!currentStates.get(successorEntry.getColumn())) {
+                                    allSuccessorsInCurrentStates = false;
+                                    break;
+                                } else if (nextStates.get(successorEntry.getColumn())) {
+                                    hasNextStateSuccessor = true;
                                 }
                             }
+                            if (allSuccessorsInCurrentStates && hasNextStateSuccessor) {
+                                return true;
+                            }
                         }
                     }
+                    return false;
+                };
+                
+                // Perform the loop as long as the set of states gets smaller. All searches share the threads.
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                bool done = false;
+                while (!done) {
+                    storm::storage::BitVector nextStates = detail::performBackwardSearch(&transitionMatrix, backwardTransitions, phiStates, psiStates, condition, pool.get());
                     
                     // Check whether we need to perform an additional iteration.
                     if (currentStates == nextStates) {
@@ -736,7 +871,8 @@ namespace storm {
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
                 
-                result.first = performProb0A(backwardTransitions, phiStates, psiStates);
+                result.first = performProbGreater0E(transitionMatrix, backwardTransitions, phiStates, psiStates);
+                result.first.complement();
                 result.second = performProb1E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
                 return result;
             }
@@ -746,116 +882,42 @@ namespace storm {
                 return performProb01Max(model.getTransitionMatrix(), model.getTransitionMatrix().getRowGroupIndices(), model.getBackwardTransitions(), phiStates, psiStates);
             }
             
-            template <typename T>
-            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
-                size_t numberOfStates = phiStates.size();
-                
-                // Prepare resulting bit vector.
-                storm::storage::BitVector statesWithProbabilityGreater0(numberOfStates);
-                
-                // Add all psi states as the already satisfy the condition.
-                statesWithProbabilityGreater0 |= psiStates;
-                
-                // Initialize the stack used for the DFS with the states
-                std::vector<uint_fast64_t> stack(psiStates.begin(), psiStates.end());
-                
-                // Initialize the stack for the step bound, if the number of steps is bounded.
-                std::vector<uint_fast64_t> stepStack;
-                std::vector<uint_fast64_t> remainingSteps;
-                if (useStepBound) {
-                    stepStack.reserve(numberOfStates);
-                    stepStack.insert(stepStack.begin(), psiStates.getNumberOfSetBits(), maximalSteps);
-                    remainingSteps.resize(numberOfStates);
-                    for (auto state : psiStates) {
-                        remainingSteps[state] = maximalSteps;
-                    }
-                }
-                
-                // Perform the actual DFS.
-                uint_fast64_t currentState, currentStepBound;
-                while(!stack.empty()) {
-                    currentState = stack.back();
-                    stack.pop_back();
-                    
-                    if (useStepBound) {
-                        currentStepBound = stepStack.back();
-                        stepStack.pop_back();
-                        if (currentStepBound == 0) {
-                            continue;
+            namespace detail {
+                template <typename T>
+                storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint, storm::utility::ThreadPool* pool) {
+                    // A state is added if it has at least one choice (within the possibly given choiceConstraint) and every
+                    // such choice has at least one successor with positive probability.
+                    auto condition = [&] (uint64_t state, storm::storage::BitVector const& statesWithProbabilityGreater0) {
+                        uint_fast64_t row = nondeterministicChoiceIndices[state];
+                        uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[state + 1];
+                        if (choiceConstraint ? choiceConstraint->getNextSetIndex(row) >= endOfGroup : row == endOfGroup) {
+                            return false;
                         }
-                    }
-                    
-                    for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                        if (phiStates.get(predecessorEntryIt->getColumn())) {
-                            if (!statesWithProbabilityGreater0.get(predecessorEntryIt->getColumn())) {
-                                
-                                // Check whether the predecessor has at least one successor in the current state set for every
-                                // nondeterministic choice within the possibly given choiceConstraint.
-                                
-                                // Note: The backwards edge might be induced by a choice that violates the choiceConstraint.
-                                // However this is not problematic as long as there is at least one enabled choice for the predecessor.
-                                uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()];
-                                uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                                if (!choiceConstraint || choiceConstraint->getNextSetIndex(row) < endOfGroup) {
-                                    bool addToStatesWithProbabilityGreater0 = true;
-                                    for (; row < endOfGroup; ++row) {
-                                        if (!choiceConstraint || choiceConstraint->get(row)) {
-                                            bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
-                                            for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                                if (statesWithProbabilityGreater0.get(successorEntryIt->getColumn())) {
-                                                    hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
-                                                    break;
-                                                }
-                                            }
-                                            
-                                            if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
-                                                addToStatesWithProbabilityGreater0 = false;
-                                                break;
-                                            }
-                                        }
-                                    }
-                                    
-                                    // If we need to add the state, then actually add it and perform further search from the state.
-                                    if (addToStatesWithProbabilityGreater0) {
-                                        // If we don't have a bound on the number of steps to take, just add the state to the stack.
-                                        if (useStepBound) {
-                                            // If there is at least one more step to go, we need to push the state and the new number of steps.
-                                            remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                            stepStack.push_back(currentStepBound - 1);
-                                        }
-                                        statesWithProbabilityGreater0.set(predecessorEntryIt->getColumn(), true);
-                                        stack.push_back(predecessorEntryIt->getColumn());
-                                    }
-                                }
-                                
-                            } else if (useStepBound && remainingSteps[predecessorEntryIt->getColumn()] < currentStepBound - 1) {
-                                // We have found a shorter path to the predecessor. Hence, we need to explore it again.
-                                // If there is a choiceConstraint, we still need to check whether the backwards edge was induced by a valid action
-                                bool predecessorIsValid = true;
-                                if (choiceConstraint) {
-                                    predecessorIsValid = false;
-                                    uint_fast64_t row = choiceConstraint->getNextSetIndex(nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]);
-                                    uint_fast64_t const& endOfGroup = nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1];
-                                    for (; row < endOfGroup && !predecessorIsValid; row = choiceConstraint->getNextSetIndex(row + 1)) {
-                                        for (auto const& entry : transitionMatrix.getRow(row)) {
-                                            if (entry.getColumn() == currentState) {
-                                                predecessorIsValid = true;
-                                                break;
-                                            }
-                                        }
+                        for (; row < endOfGroup; ++row) {
+                            if (!choiceConstraint || choiceConstraint->get(row)) {
+                                bool hasAtLeastOneSuccessorWithProbabilityGreater0 = false;
+                                for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                    if (statesWithProbabilityGreater0.get(successorEntry.getColumn())) {
+                                        hasAtLeastOneSuccessorWithProbabilityGreater0 = true;
+                                        break;
                                     }
                                 }
-                                if (predecessorIsValid) {
-                                    remainingSteps[predecessorEntryIt->getColumn()] = currentStepBound - 1;
-                                    stepStack.push_back(currentStepBound - 1);
-                                    stack.push_back(predecessorEntryIt->getColumn());
+                                if (!hasAtLeastOneSuccessorWithProbabilityGreater0) {
+                                    return false;
                                 }
                             }
                         }
-                    }
-                }
+                        return true;
+                    };
                 
-                return statesWithProbabilityGreater0;
+                    return performBackwardSearch(&transitionMatrix, backwardTransitions, phiStates, psiStates, condition, pool, useStepBound ? boost::optional<uint_fast64_t>(maximalSteps) : boost::none);
+                }
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProbGreater0A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound, uint_fast64_t maximalSteps, boost::optional<storm::storage::BitVector> const& choiceConstraint) {
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                return detail::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, useStepBound, maximalSteps, choiceConstraint, pool.get());
             }
             
             template <typename T, typename RM>
@@ -877,78 +939,65 @@ namespace storm {
                 return performProb1A(model.getTransitionMatrix(), model.getNondeterministicChoiceIndices(), backwardTransitions, phiStates, psiStates);
             }
             
-            template <typename T>
-            storm::storage::BitVector performProb1A( storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
-                size_t numberOfStates = phiStates.size();
-                
-                // Initialize the environment for the iterative algorithm.
-                storm::storage::BitVector currentStates(numberOfStates, true);
-                std::vector<uint_fast64_t> stack;
-                stack.reserve(numberOfStates);
-                
-                // Perform the loop as long as the set of states gets smaller.
-                bool done = false;
-                uint_fast64_t currentState;
-                while (!done) {
-                    stack.clear();
-                    storm::storage::BitVector nextStates(psiStates);
-                    stack.insert(stack.end(), psiStates.begin(), psiStates.end());
-                    
-                    while (!stack.empty()) {
-                        currentState = stack.back();
-                        stack.pop_back();
-                        
-                        for(typename storm::storage::SparseMatrix<T>::const_iterator predecessorEntryIt = backwardTransitions.begin(currentState), predecessorEntryIte = backwardTransitions.end(currentState); predecessorEntryIt != predecessorEntryIte; ++predecessorEntryIt) {
-                            if (phiStates.get(predecessorEntryIt->getColumn()) && !nextStates.get(predecessorEntryIt->getColumn())) {
-                                // Check whether the predecessor has only successors in the current state set for all of the
-                                // nondeterminstic choices and that for each choice there exists a successor that is already
-                                // in the next states.
-                                bool addToStatesWithProbability1 = true;
-                                for (uint_fast64_t row = nondeterministicChoiceIndices[predecessorEntryIt->getColumn()]; row < nondeterministicChoiceIndices[predecessorEntryIt->getColumn() + 1]; ++row) {
-                                    bool hasAtLeastOneSuccessorWithProbability1 = false;
-                                    for (typename storm::storage::SparseMatrix<T>::const_iterator successorEntryIt = transitionMatrix.begin(row), successorEntryIte = transitionMatrix.end(row); successorEntryIt != successorEntryIte; ++successorEntryIt) {
-                                        if (!currentStates.get(successorEntryIt->getColumn())) {
-                                            addToStatesWithProbability1 = false;
-                                            goto afterCheckLoop;
-                                        }
-                                        if (nextStates.get(successorEntryIt->getColumn())) {
-                                            hasAtLeastOneSuccessorWithProbability1 = true;
-                                        }
-                                    }
-                                    
-                                    if (!hasAtLeastOneSuccessorWithProbability1) {
-                                        addToStatesWithProbability1 = false;
-                                        break;
-                                    }
+            namespace detail {
+                template <typename T>
+                storm::storage::BitVector performProb1A(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::utility::ThreadPool* pool) {
+                    size_t numberOfStates = phiStates.size();
+                
+                    // Initialize the environment for the iterative algorithm.
+                    storm::storage::BitVector currentStates(numberOfStates, true);
+                
+                    // A state is added if all of its nondeterministic choices have only successors in the current state set
+                    // and at least one successor in the states found so far.
+                    auto condition = [&] (uint64_t state, storm::storage::BitVector const& nextStates) {
+                        for (uint_fast64_t row = nondeterministicChoiceIndices[state]; row < nondeterministicChoiceIndices[state + 1]; ++row) {
+                            bool hasAtLeastOneSuccessorWithProbability1 = false;
+                            for (auto const& successorEntry : transitionMatrix.getRow(row)) {
+                                if (!currentStates.get(successorEntry.getColumn())) {
+                                    return false;
                                 }
-                                
-                            afterCheckLoop:
-                                // If all successors for all nondeterministic choices are in the current state set, we
-                                // add it to the set of states for the next iteration and perform a backward search from
-                                // that state.
-                                if (addToStatesWithProbability1) {
-                                    nextStates.set(predecessorEntryIt->getColumn(), true);
-                                    stack.push_back(predecessorEntryIt->getColumn());
+                                if (nextStates.get(successorEntry.getColumn())) {
+                                    hasAtLeastOneSuccessorWithProbability1 = true;
                                 }
                             }
+                            if (!hasAtLeastOneSuccessorWithProbability1) {
+                                return false;
+                            }
                         }
-                    }
+                        return true;
+                    };
+                
+                    // Perform the loop as long as the set of states gets smaller.
+                    bool done = false;
+                    while (!done) {
+                        storm::storage::BitVector nextStates = performBackwardSearch(&transitionMatrix, backwardTransitions, phiStates, psiStates, condition, pool);
                     
-                    // Check whether we need to perform an additional iteration.
-                    if (currentStates == nextStates) {
-                        done = true;
-                    } else {
-                        currentStates = std::move(nextStates);
+                        // Check whether we need to perform an additional iteration.
+                        if (currentStates == nextStates) {
+                            done = true;
+                        } else {
+                            currentStates = std::move(nextStates);
+                        }
                     }
+                    return currentStates;
                 }
-                return currentStates;
+            }
+            
+            template <typename T>
+            storm::storage::BitVector performProb1A( storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+                // All searches of the fixpoint loop share the threads.
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                return detail::performProb1A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, pool.get());
             }
             
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<T> const& transitionMatrix, std::vector<uint_fast64_t> const& nondeterministicChoiceIndices, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
                 std::pair<storm::storage::BitVector, storm::storage::BitVector> result;
-                result.first = performProb0E(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
-                result.second = performProb1A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates);
+                // Both analyses share the threads.
+                std::unique_ptr<storm::utility::ThreadPool> pool = detail::createSearchThreadPool(phiStates);
+                result.first = detail::performProbGreater0A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, false, 0, boost::none, pool.get());
+                result.first.complement();
+                result.second = detail::performProb1A(transitionMatrix, nondeterministicChoiceIndices, backwardTransitions, phiStates, psiStates, pool.get());
                 return result;
             }
             
@@ -1701,6 +1750,8 @@ namespace storm {
             
             
             template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+            template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
             
@@ -1712,6 +1763,8 @@ namespace storm {
             
             
             template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             
             
@@ -1725,6 +1778,8 @@ namespace storm {
             template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::Scheduler<double>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
             
             template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
+
+            template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<double> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
@@ -1780,6 +1835,8 @@ namespace storm {
             template std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& initialStates, boost::optional<storm::storage::BitVector> const& subsystem);
             
             template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+            template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
             
@@ -1788,6 +1845,8 @@ namespace storm {
             template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::models::sparse::DeterministicModel<storm::RationalNumber> const& model, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             template void computeSchedulerProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::Scheduler<storm::RationalNumber>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter);
             
@@ -1798,6 +1857,8 @@ namespace storm {
             template void computeSchedulerProb1E(storm::storage::BitVector const& prob1EStates, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::Scheduler<storm::RationalNumber>& scheduler, boost::optional<storm::storage::BitVector> const& rowFilter = boost::none);
             
             template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
+
+            template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
@@ -1840,6 +1901,8 @@ namespace storm {
             
             
             template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+
+            template storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb1(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, storm::storage::BitVector const& statesWithProbabilityGreater0);
             
@@ -1851,10 +1914,14 @@ namespace storm {
             
             
             template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+
+            template std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
             
             
             template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
+
+            template storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
             template storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<storm::RationalFunction> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
@@ -117,7 +117,7 @@ namespace storm {
             std::vector<uint_fast64_t> getDistances(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::BitVector const& initialStates, boost::optional<storm::storage::BitVector> const& subsystem = boost::none);
             
             /*!
-             * Performs a backward depth-first search trough the underlying graph structure
+             * Performs a backward search through the underlying graph structure
              * of the given model to determine which states of the model have a positive probability
              * of satisfying phi until psi. The resulting states are written to the given bit vector.
              *
@@ -131,6 +131,23 @@ namespace storm {
             template <typename T>
             storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
             
+            /*!
+             * Performs a backward search through the underlying graph structure
+             * of the given model to determine which states of the model have a positive probability
+             * of satisfying phi until psi. As the forward transitions are given, large searches are
+             * performed bottom-up and, if several threads are available, in parallel.
+             *
+             * @param transitionMatrix The transition relation of the graph structure to search.
+             * @param backwardTransitions The reversed transition relation of the graph structure to search.
+             * @param phiStates A bit vector of all states satisfying phi.
+             * @param psiStates A bit vector of all states satisfying psi.
+             * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
+             * @param maximalSteps The maximal number of steps to reach the psi states.
+             * @return A bit vector with all indices of states that have a probability greater than 0.
+             */
+            template <typename T>
+            storm::storage::BitVector performProbGreater0(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+            
             /*!
              * Computes the set of states of the given model for which all paths lead to
              * the given set of target states and only visit states from the filter set
@@ -189,6 +206,21 @@ namespace storm {
             template <typename T>
             std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
+            /*!
+             * Computes the sets of states that have probability 0 or 1, respectively, of satisfying phi until psi in a
+             * deterministic model. As the forward transitions are given, large searches are performed bottom-up and,
+             * if several threads are available, in parallel.
+             *
+             * @param transitionMatrix The transitions of the model whose graph structure to search.
+             * @param backwardTransitions The backward transitions of the model whose graph structure to search.
+             * @param phiStates The set of all states satisfying phi.
+             * @param psiStates The set of all states satisfying psi.
+             * @return A pair of bit vectors such that the first bit vector stores the indices of all states
+             * with probability 0 and the second stores all indices of states with probability 1.
+             */
+            template <typename T>
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
+            
             /*!
              * Computes the set of states that has a positive probability of reaching psi states after only passing
              * through phi states before.
@@ -344,6 +376,22 @@ namespace storm {
             template <typename T>
             storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0) ;
             
+            /*!
+             * Computes the sets of states that have probability greater 0 of satisfying phi until psi under at least
+             * one possible resolution of non-determinism in a non-deterministic model. As the forward transitions are
+             * given, large searches are performed bottom-up and, if several threads are available, in parallel.
+             *
+             * @param transitionMatrix The transition relation of the model.
+             * @param backwardTransitions The reversed transition relation of the model.
+             * @param phiStates The set of all states satisfying phi.
+             * @param psiStates The set of all states satisfying psi.
+             * @param useStepBound A flag that indicates whether or not to use the given number of maximal steps for the search.
+             * @param maximalSteps The maximal number of steps to reach the psi states.
+             * @return A bit vector that represents all states with probability greater 0.
+             */
+            template <typename T>
+            storm::storage::BitVector performProbGreater0E(storm::storage::SparseMatrix<T> const& transitionMatrix, storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool useStepBound = false, uint_fast64_t maximalSteps = 0);
+            
             template <typename T>
             storm::storage::BitVector performProb0A(storm::storage::SparseMatrix<T> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates);
             
@@ -0,0 +1,294 @@
+#include "storm/utility/simd.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+// The vectorized kernels are compiled with function-specific target attributes, so they are available regardless of
+// the flags the remaining code is compiled with. Whether they are actually used is decided at runtime.
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define STORM_SIMD_X86
+#if defined(__clang__) || __GNUC__ >= 7
+#define STORM_SIMD_AVX512
+#endif
+#include <immintrin.h>
+#define STORM_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define STORM_SIMD_TARGET_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            std::ostream& operator<<(std::ostream& out, InstructionSet const& instructionSet) {
+                switch (instructionSet) {
+                    case InstructionSet::None: out << "none"; break;
+                    case InstructionSet::Avx2: out << "AVX2"; break;
+                    case InstructionSet::Avx512: out << "AVX-512"; break;
+                }
+                return out;
+            }
+
+            InstructionSet getAvailableInstructionSet() {
+#ifdef STORM_SIMD_X86
+                static InstructionSet const instructionSet = [] {
+                    __builtin_cpu_init();
+#ifdef STORM_SIMD_AVX512
+                    if (__builtin_cpu_supports("avx512f")) {
+                        return InstructionSet::Avx512;
+                    }
+#endif
+                    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+                        return InstructionSet::Avx2;
+                    }
+                    return InstructionSet::None;
+                }();
+                return instructionSet;
+#else
+                return InstructionSet::None;
+#endif
+            }
+
+#ifdef STORM_SIMD_X86
+            namespace avx2 {
+                STORM_SIMD_TARGET_AVX2
+                static inline double multiplyRow(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector) {
+                    __m256d sum = _mm256_setzero_pd();
+                    uint_fast64_t entry = 0;
+                    for (; entry + 4 <= count; entry += 4) {
+                        __m128i indices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(columns + entry));
+                        sum = _mm256_fmadd_pd(_mm256_loadu_pd(values + entry), _mm256_i32gather_pd(vector, indices, 8), sum);
+                    }
+                    if (entry < count) {
+                        // Treat the remaining entries with masked loads, so we do not read beyond the row.
+                        __m128i indexMask = _mm_cmpgt_epi32(_mm_set1_epi32(static_cast<int>(count - entry)), _mm_setr_epi32(0, 1, 2, 3));
+                        __m256i valueMask = _mm256_cvtepi32_epi64(indexMask);
+                        __m128i indices = _mm_maskload_epi32(reinterpret_cast<int const*>(columns + entry), indexMask);
+                        __m256d gathered = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), vector, indices, _mm256_castsi256_pd(valueMask), 8);
+                        sum = _mm256_fmadd_pd(_mm256_maskload_pd(values + entry, valueMask), gathered, sum);
+                    }
+                    __m128d low = _mm_add_pd(_mm256_castpd256_pd128(sum), _mm256_extractf128_pd(sum, 1));
+                    return _mm_cvtsd_f64(_mm_add_sd(low, _mm_unpackhi_pd(low, low)));
+                }
+
+                /*!
+                 * Retrieves the index of the first optimal value among the four given values.
+                 */
+                template<bool minimize>
+                STORM_SIMD_TARGET_AVX2
+                static inline int getIndexOfOptimum(double const* chunk) {
+                    __m256d values = _mm256_load_pd(chunk);
+                    __m256d swapped = _mm256_permute2f128_pd(values, values, 1);
+                    __m256d optimum = minimize ? _mm256_min_pd(values, swapped) : _mm256_max_pd(values, swapped);
+                    swapped = _mm256_permute_pd(optimum, 5);
+                    optimum = minimize ? _mm256_min_pd(optimum, swapped) : _mm256_max_pd(optimum, swapped);
+                    return __builtin_ctz(static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(values, optimum, _CMP_EQ_OQ))));
+                }
+
+                STORM_SIMD_TARGET_AVX2
+                void multiplyWithVector(uint_fast64_t rowCount, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                    for (uint_fast64_t row = 0; row < rowCount; ++row) {
+                        uint_fast64_t rowStart = rowIndications[row];
+                        double rowValue = multiplyRow(columns + rowStart, values + rowStart, rowIndications[row + 1] - rowStart, vector);
+                        result[row] = summand ? summand[row] + rowValue : rowValue;
+                    }
+                }
+
+                template<bool minimize>
+                STORM_SIMD_TARGET_AVX2
+                void multiplyAndReduce(uint_fast64_t rowGroupCount, uint64_t const* rowGroupIndices, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    alignas(32) double chunk[4];
+                    for (uint_fast64_t group = 0; group < rowGroupCount; ++group) {
+                        uint64_t const groupStart = rowGroupIndices[group];
+                        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+
+                        // Only multiply and reduce if there is at least one row in the group.
+                        if (groupSize == 0) {
+                            continue;
+                        }
+
+                        double currentValue = 0.0;
+                        uint64_t selectedChoice = 0;
+                        double oldSelectedChoiceValue = 0.0;
+                        bool oldSelectedChoiceFound = false;
+                        for (uint64_t chunkStart = 0; chunkStart < groupSize; chunkStart += 4) {
+                            uint64_t chunkSize = std::min<uint64_t>(4, groupSize - chunkStart);
+                            for (uint64_t index = 0; index < chunkSize; ++index) {
+                                uint64_t row = groupStart + chunkStart + index;
+                                uint_fast64_t rowStart = rowIndications[row];
+                                double rowValue = multiplyRow(columns + rowStart, values + rowStart, rowIndications[row + 1] - rowStart, vector);
+                                chunk[index] = summand ? summand[row] + rowValue : rowValue;
+                            }
+                            if (groupSize == 1) {
+                                // Nothing to reduce.
+                                currentValue = chunk[0];
+                                break;
+                            }
+
+                            // Padding with the first value does not change the index of the (first) optimum.
+                            for (uint64_t index = chunkSize; index < 4; ++index) {
+                                chunk[index] = chunk[0];
+                            }
+                            int optimalIndex = getIndexOfOptimum<minimize>(chunk);
+                            if (chunkStart == 0 || (minimize ? chunk[optimalIndex] < currentValue : chunk[optimalIndex] > currentValue)) {
+                                currentValue = chunk[optimalIndex];
+                                selectedChoice = chunkStart + optimalIndex;
+                            }
+                            if (choices && choices[group] >= chunkStart && choices[group] < chunkStart + chunkSize) {
+                                oldSelectedChoiceValue = chunk[choices[group] - chunkStart];
+                                oldSelectedChoiceFound = true;
+                            }
+                        }
+
+                        result[group] = currentValue;
+                        if (choices && groupSize > 1 && (!oldSelectedChoiceFound || (minimize ? currentValue < oldSelectedChoiceValue : currentValue > oldSelectedChoiceValue))) {
+                            choices[group] = selectedChoice;
+                        }
+                    }
+                }
+            }
+
+#ifdef STORM_SIMD_AVX512
+            namespace avx512 {
+                STORM_SIMD_TARGET_AVX512
+                static inline double multiplyRow(uint32_t const* columns, double const* values, uint_fast64_t count, double const* vector) {
+                    __m512d sum = _mm512_setzero_pd();
+                    uint_fast64_t entry = 0;
+                    for (; entry + 8 <= count; entry += 8) {
+                        __m256i indices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(columns + entry));
+                        sum = _mm512_fmadd_pd(_mm512_loadu_pd(values + entry), _mm512_i32gather_pd(indices, vector, 8), sum);
+                    }
+                    if (entry < count) {
+                        // Treat the remaining entries with masked loads, so we do not read beyond the row.
+                        __mmask8 mask = static_cast<__mmask8>((1u << (count - entry)) - 1);
+                        __m256i indices = _mm512_castsi512_si256(_mm512_maskz_loadu_epi32(static_cast<__mmask16>(mask), columns + entry));
+                        __m512d gathered = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, indices, vector, 8);
+                        sum = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(mask, values + entry), gathered, sum);
+                    }
+                    return _mm512_reduce_add_pd(sum);
+                }
+
+                /*!
+                 * Retrieves the index of the first optimal value among the eight given values.
+                 */
+                template<bool minimize>
+                STORM_SIMD_TARGET_AVX512
+                static inline int getIndexOfOptimum(double const* chunk) {
+                    __m512d values = _mm512_load_pd(chunk);
+                    __m512d optimum = _mm512_set1_pd(minimize ? _mm512_reduce_min_pd(values) : _mm512_reduce_max_pd(values));
+                    return __builtin_ctz(static_cast<unsigned>(_mm512_cmp_pd_mask(values, optimum, _CMP_EQ_OQ)));
+                }
+
+                STORM_SIMD_TARGET_AVX512
+                void multiplyWithVector(uint_fast64_t rowCount, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                    for (uint_fast64_t row = 0; row < rowCount; ++row) {
+                        uint_fast64_t rowStart = rowIndications[row];
+                        double rowValue = multiplyRow(columns + rowStart, values + rowStart, rowIndications[row + 1] - rowStart, vector);
+                        result[row] = summand ? summand[row] + rowValue : rowValue;
+                    }
+                }
+
+                template<bool minimize>
+                STORM_SIMD_TARGET_AVX512
+                void multiplyAndReduce(uint_fast64_t rowGroupCount, uint64_t const* rowGroupIndices, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                    alignas(64) double chunk[8];
+                    for (uint_fast64_t group = 0; group < rowGroupCount; ++group) {
+                        uint64_t const groupStart = rowGroupIndices[group];
+                        uint64_t const groupSize = rowGroupIndices[group + 1] - groupStart;
+
+                        // Only multiply and reduce if there is at least one row in the group.
+                        if (groupSize == 0) {
+                            continue;
+                        }
+
+                        double currentValue = 0.0;
+                        uint64_t selectedChoice = 0;
+                        double oldSelectedChoiceValue = 0.0;
+                        bool oldSelectedChoiceFound = false;
+                        for (uint64_t chunkStart = 0; chunkStart < groupSize; chunkStart += 8) {
+                            uint64_t chunkSize = std::min<uint64_t>(8, groupSize - chunkStart);
+                            for (uint64_t index = 0; index < chunkSize; ++index) {
+                                uint64_t row = groupStart + chunkStart + index;
+                                uint_fast64_t rowStart = rowIndications[row];
+                                double rowValue = multiplyRow(columns + rowStart, values + rowStart, rowIndications[row + 1] - rowStart, vector);
+                                chunk[index] = summand ? summand[row] + rowValue : rowValue;
+                            }
+                            if (groupSize == 1) {
+                                // Nothing to reduce.
+                                currentValue = chunk[0];
+                                break;
+                            }
+
+                            // Padding with the first value does not change the index of the (first) optimum.
+                            for (uint64_t index = chunkSize; index < 8; ++index) {
+                                chunk[index] = chunk[0];
+                            }
+                            int optimalIndex = getIndexOfOptimum<minimize>(chunk);
+                            if (chunkStart == 0 || (minimize ? chunk[optimalIndex] < currentValue : chunk[optimalIndex] > currentValue)) {
+                                currentValue = chunk[optimalIndex];
+                                selectedChoice = chunkStart + optimalIndex;
+                            }
+                            if (choices && choices[group] >= chunkStart && choices[group] < chunkStart + chunkSize) {
+                                oldSelectedChoiceValue = chunk[choices[group] - chunkStart];
+                                oldSelectedChoiceFound = true;
+                            }
+                        }
+
+                        result[group] = currentValue;
+                        if (choices && groupSize > 1 && (!oldSelectedChoiceFound || (minimize ? currentValue < oldSelectedChoiceValue : currentValue > oldSelectedChoiceValue))) {
+                            choices[group] = selectedChoice;
+                        }
+                    }
+                }
+            }
+#endif
+#endif
+
+            void multiplyWithVector(InstructionSet instructionSet, uint_fast64_t rowCount, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result) {
+                switch (instructionSet) {
+#ifdef STORM_SIMD_X86
+                    case InstructionSet::Avx2:
+                        avx2::multiplyWithVector(rowCount, rowIndications, columns, values, vector, summand, result);
+                        return;
+#ifdef STORM_SIMD_AVX512
+                    case InstructionSet::Avx512:
+                        avx512::multiplyWithVector(rowCount, rowIndications, columns, values, vector, summand, result);
+                        return;
+#endif
+#endif
+                    default:
+                        break;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized kernels are not available for instruction set '" << instructionSet << "'.");
+            }
+
+            void multiplyAndReduce(InstructionSet instructionSet, bool minimize, uint_fast64_t rowGroupCount, uint64_t const* rowGroupIndices, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices) {
+                switch (instructionSet) {
+#ifdef STORM_SIMD_X86
+                    case InstructionSet::Avx2:
+                        if (minimize) {
+                            avx2::multiplyAndReduce<true>(rowGroupCount, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices);
+                        } else {
+                            avx2::multiplyAndReduce<false>(rowGroupCount, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices);
+                        }
+                        return;
+#ifdef STORM_SIMD_AVX512
+                    case InstructionSet::Avx512:
+                        if (minimize) {
+                            avx512::multiplyAndReduce<true>(rowGroupCount, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices);
+                        } else {
+                            avx512::multiplyAndReduce<false>(rowGroupCount, rowGroupIndices, rowIndications, columns, values, vector, summand, result, choices);
+                        }
+                        return;
+#endif
+#endif
+                    default:
+                        break;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Vectorized kernels are not available for instruction set '" << instructionSet << "'.");
+            }
+
+        }
+    }
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace storm {
+    namespace utility {
+        namespace simd {
+
+            /*!
+             * The instruction sets for which vectorized kernels are available.
+             */
+            enum class InstructionSet { None, Avx2, Avx512 };
+
+            std::ostream& operator<<(std::ostream& out, InstructionSet const& instructionSet);
+
+            /*!
+             * Retrieves the most powerful instruction set that is supported by both the compiler and the CPU that
+             * executes this program. The result is determined only once.
+             */
+            InstructionSet getAvailableInstructionSet();
+
+            /*!
+             * Multiplies the given matrix (in compressed row storage with separate column and value arrays) with the
+             * given vector.
+             *
+             * @param instructionSet The instruction set to use. This must be supported by the machine.
+             * @param rowCount The number of rows of the matrix.
+             * @param rowIndications The offsets at which the rows start (plus the number of entries).
+             * @param columns The column indices of the entries.
+             * @param values The values of the entries.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If not null, this summand is added to the result of the multiplication.
+             * @param result The result of the multiplication (must not overlap with the vector).
+             */
+            void multiplyWithVector(InstructionSet instructionSet, uint_fast64_t rowCount, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result);
+
+            /*!
+             * Multiplies the given matrix (in compressed row storage with separate column and value arrays) with the
+             * given vector and reduces the result over the given row groups. As for SparseMatrix::multiplyAndReduce,
+             * the first optimal row of a group is selected and a previous choice is only overwritten if the new choice
+             * is strictly better.
+             *
+             * @param instructionSet The instruction set to use. This must be supported by the machine.
+             * @param minimize If set, the minimum is taken for each group, otherwise the maximum.
+             * @param rowGroupCount The number of row groups.
+             * @param rowGroupIndices The rows at which the groups start (plus the number of rows).
+             * @param rowIndications The offsets at which the rows start (plus the number of entries).
+             * @param columns The column indices of the entries.
+             * @param values The values of the entries.
+             * @param vector The vector with which to multiply the matrix.
+             * @param summand If not null, this summand is added to the result of the multiplication.
+             * @param result The result of the multiplication (must not overlap with the vector).
+             * @param choices If not null, the selected choices are written to this array.
+             */
+            void multiplyAndReduce(InstructionSet instructionSet, bool minimize, uint_fast64_t rowGroupCount, uint64_t const* rowGroupIndices, uint_fast64_t const* rowIndications, uint32_t const* columns, double const* values, double const* vector, double const* summand, double* result, uint_fast64_t* choices);
+
+        }
+    }
+}
@@ -17,6 +17,7 @@
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/storage/jani/Property.h"
 
@@ -257,4 +258,59 @@ TEST(ModelInstantiatorTest, Consensus) {
     EXPECT_NEAR(0.3526577219, quantitativeChkResult[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+
+TEST(ModelInstantiatorTest, ReinstantiationInvalidatesAnalysisCache) {
+    carl::VariablePool::getInstance().clear();
+    
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+    
+    // Program and formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size()==1);
+    // Parametric model
+    storm::generator::NextStateGeneratorOptions options(*formulas.front());
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::builder::ExplicitModelBuilder<storm::RationalFunction>(program, options).build()->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> zeroValuation;
+    zeroValuation.insert(std::make_pair(pL, storm::utility::zero<storm::RationalFunctionCoefficient>()));
+    zeroValuation.insert(std::make_pair(pK, storm::utility::zero<storm::RationalFunctionCoefficient>()));
+    std::map<storm::RationalFunctionVariable, storm::RationalFunctionCoefficient> valuation;
+    valuation.insert(std::make_pair(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.5)));
+    valuation.insert(std::make_pair(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.5)));
+    
+    // Fill the analysis cache of the instantiated model with results for the first valuation.
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> modelInstantiator(*dtmc);
+    {
+        storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(zeroValuation));
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(instantiated);
+        modelchecker.check(*formulas[0]);
+        instantiated.getCachedBackwardTransitions();
+    }
+    
+    // The results for the second valuation must coincide with the ones of a fresh instantiation.
+    storm::models::sparse::Dtmc<double> const& instantiated(modelInstantiator.instantiate(valuation));
+    storm::utility::ModelInstantiator<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::models::sparse::Dtmc<double>> freshModelInstantiator(*dtmc);
+    storm::models::sparse::Dtmc<double> const& freshInstantiated(freshModelInstantiator.instantiate(valuation));
+    
+    EXPECT_EQ(freshInstantiated.getTransitionMatrix(), instantiated.getTransitionMatrix());
+    EXPECT_EQ(*freshInstantiated.getCachedBackwardTransitions(), *instantiated.getCachedBackwardTransitions());
+    
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> modelchecker(instantiated);
+    storm::storage::BitVector phiStates(instantiated.getNumberOfStates(), true);
+    storm::storage::BitVector psiStates = modelchecker.check(formulas[0]->asProbabilityOperatorFormula().getSubformula().asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+    EXPECT_EQ(freshInstantiated.getAnalysisCache().getProb01(freshInstantiated.getTransitionMatrix(), phiStates, psiStates), instantiated.getAnalysisCache().getProb01(instantiated.getTransitionMatrix(), phiStates, psiStates));
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> chkResult = modelchecker.check(*formulas[0]);
+    storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> freshModelchecker(freshInstantiated);
+    std::unique_ptr<storm::modelchecker::CheckResult> freshChkResult = freshModelchecker.check(*formulas[0]);
+    EXPECT_NEAR(freshChkResult->asExplicitQuantitativeCheckResult<double>()[*freshInstantiated.getInitialStates().begin()], chkResult->asExplicitQuantitativeCheckResult<double>()[*instantiated.getInitialStates().begin()], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
+}
+
 #endif
@@ -156,3 +156,34 @@ TEST(ExplicitJaniModelBuilderTest, unassignedVariables) {
     EXPECT_EQ(25ul, model->getNumberOfStates());
     EXPECT_EQ(81ul, model->getNumberOfTransitions());
 }
+
+TEST(ExplicitJaniModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    
+    for (std::string const& filename : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        storm::jani::Model janiModel = program.toJani().substituteConstantsFunctions();
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, sequentialOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(janiModel, generatorOptions, parallelOptions).build();
+        
+        // The state numbering must not depend on the number of threads.
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(nameRewardModelPair.first);
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
@@ -2,6 +2,14 @@
 #include "storm-config.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
+#include "storm-parsers/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 
@@ -125,3 +133,310 @@ TEST(ExplicitPrismModelBuilderTest, FailComposition) {
 
     STORM_SILENT_ASSERT_THROW(storm::builder::ExplicitModelBuilder<double>(program).build(), storm::exceptions::WrongFormatException);
 }
+
+TEST(ExplicitPrismModelBuilderTest, ParallelExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options sequentialOptions;
+    sequentialOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    sequentialOptions.numberOfThreads = 1;
+    storm::builder::ExplicitModelBuilder<double>::Options parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    generatorOptions.setBuildChoiceLabels();
+    
+    for (std::string const& filename : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        std::shared_ptr<storm::models::sparse::Model<double>> sequentialModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, sequentialOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> parallelModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, parallelOptions).build();
+        
+        // The state numbering must not depend on the number of threads.
+        ASSERT_EQ(sequentialModel->getType(), parallelModel->getType());
+        EXPECT_TRUE(sequentialModel->getTransitionMatrix() == parallelModel->getTransitionMatrix());
+        EXPECT_TRUE(sequentialModel->getStateLabeling() == parallelModel->getStateLabeling());
+        ASSERT_EQ(sequentialModel->hasChoiceLabeling(), parallelModel->hasChoiceLabeling());
+        if (sequentialModel->hasChoiceLabeling()) {
+            EXPECT_TRUE(sequentialModel->getChoiceLabeling() == parallelModel->getChoiceLabeling());
+        }
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(nameRewardModelPair.first);
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+        if (sequentialModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            EXPECT_EQ(sequentialModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates(), parallelModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates());
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, ExternalExploration) {
+    storm::builder::ExplicitModelBuilder<double>::Options inMemoryOptions;
+    inMemoryOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    storm::builder::ExplicitModelBuilder<double>::Options externalOptions = inMemoryOptions;
+    // The limit is small enough to split every layer into several chunks.
+    externalOptions.memoryLimit = 4096;
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    generatorOptions.setBuildChoiceLabels();
+    generatorOptions.setBuildStateValuations();
+    
+    for (std::string const& filename : {"/dtmc/crowds-5-5.pm", "/mdp/csma2-2.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        std::shared_ptr<storm::models::sparse::Model<double>> inMemoryModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, inMemoryOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> externalModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, externalOptions).build();
+        
+        // The state numbering must not depend on where the states are stored.
+        ASSERT_EQ(inMemoryModel->getType(), externalModel->getType());
+        EXPECT_TRUE(inMemoryModel->getTransitionMatrix() == externalModel->getTransitionMatrix());
+        EXPECT_TRUE(inMemoryModel->getStateLabeling() == externalModel->getStateLabeling());
+        ASSERT_EQ(inMemoryModel->hasChoiceLabeling(), externalModel->hasChoiceLabeling());
+        if (inMemoryModel->hasChoiceLabeling()) {
+            EXPECT_TRUE(inMemoryModel->getChoiceLabeling() == externalModel->getChoiceLabeling());
+        }
+        ASSERT_EQ(inMemoryModel->getNumberOfRewardModels(), externalModel->getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : inMemoryModel->getRewardModels()) {
+            auto const& externalRewardModel = externalModel->getRewardModel(nameRewardModelPair.first);
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), externalRewardModel.getStateRewardVector());
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), externalRewardModel.getStateActionRewardVector());
+            }
+        }
+        ASSERT_TRUE(externalModel->hasStateValuations());
+        for (uint64_t state = 0; state < inMemoryModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(inMemoryModel->getStateValuations().getStateInfo(state), externalModel->getStateValuations().getStateInfo(state));
+        }
+        if (inMemoryModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            EXPECT_EQ(inMemoryModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates(), externalModel->as<storm::models::sparse::MarkovAutomaton<double>>()->getMarkovianStates());
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, StateCompression) {
+    storm::builder::ExplicitModelBuilder<double>::Options uncompressedOptions;
+    storm::builder::ExplicitModelBuilder<double>::Options compressedOptions = uncompressedOptions;
+    compressedOptions.compressStates = true;
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    generatorOptions.setBuildChoiceLabels();
+    generatorOptions.setBuildStateValuations();
+    
+    // All models consist of several modules.
+    for (std::string const& filename : {"/dtmc/leader-3-5.pm", "/mdp/csma2-2.nm", "/mdp/wlan0-2-2.nm"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        std::shared_ptr<storm::models::sparse::Model<double>> uncompressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, uncompressedOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> compressedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, compressedOptions).build();
+        
+        // The state numbering must not depend on how the states are stored.
+        ASSERT_EQ(uncompressedModel->getType(), compressedModel->getType());
+        EXPECT_EQ(uncompressedModel->getNumberOfStates(), compressedModel->getNumberOfStates());
+        EXPECT_EQ(uncompressedModel->getNumberOfTransitions(), compressedModel->getNumberOfTransitions());
+        EXPECT_TRUE(uncompressedModel->getTransitionMatrix() == compressedModel->getTransitionMatrix());
+        EXPECT_TRUE(uncompressedModel->getStateLabeling() == compressedModel->getStateLabeling());
+        ASSERT_EQ(uncompressedModel->hasChoiceLabeling(), compressedModel->hasChoiceLabeling());
+        if (uncompressedModel->hasChoiceLabeling()) {
+            EXPECT_TRUE(uncompressedModel->getChoiceLabeling() == compressedModel->getChoiceLabeling());
+        }
+        ASSERT_EQ(uncompressedModel->getNumberOfRewardModels(), compressedModel->getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : uncompressedModel->getRewardModels()) {
+            auto const& compressedRewardModel = compressedModel->getRewardModel(nameRewardModelPair.first);
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), compressedRewardModel.getStateRewardVector());
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), compressedRewardModel.getStateActionRewardVector());
+            }
+        }
+        ASSERT_TRUE(compressedModel->hasStateValuations());
+        for (uint64_t state = 0; state < uncompressedModel->getNumberOfStates(); ++state) {
+            EXPECT_EQ(uncompressedModel->getStateValuations().getStateInfo(state), compressedModel->getStateValuations().getStateInfo(state));
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, CompiledExpressions) {
+    storm::generator::NextStateGeneratorOptions interpretedOptions(true, true);
+    interpretedOptions.setBuildChoiceLabels();
+    storm::generator::NextStateGeneratorOptions compiledOptions = interpretedOptions;
+    compiledOptions.setCompiledExpressions();
+    
+    for (std::string const& filename : {"/dtmc/crowds-5-5.pm", "/ctmc/embedded2.sm", "/mdp/csma2-2.nm", "/mdp/two_dice.nm", "/ma/stream2.ma"}) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        std::shared_ptr<storm::models::sparse::Model<double>> interpretedModel = storm::builder::ExplicitModelBuilder<double>(program, interpretedOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> compiledModel = storm::builder::ExplicitModelBuilder<double>(program, compiledOptions).build();
+        
+        ASSERT_EQ(interpretedModel->getType(), compiledModel->getType());
+        EXPECT_EQ(interpretedModel->getNumberOfStates(), compiledModel->getNumberOfStates());
+        EXPECT_EQ(interpretedModel->getNumberOfTransitions(), compiledModel->getNumberOfTransitions());
+        EXPECT_TRUE(interpretedModel->getTransitionMatrix() == compiledModel->getTransitionMatrix());
+        EXPECT_TRUE(interpretedModel->getStateLabeling() == compiledModel->getStateLabeling());
+        ASSERT_EQ(interpretedModel->hasChoiceLabeling(), compiledModel->hasChoiceLabeling());
+        if (interpretedModel->hasChoiceLabeling()) {
+            EXPECT_TRUE(interpretedModel->getChoiceLabeling() == compiledModel->getChoiceLabeling());
+        }
+        ASSERT_EQ(interpretedModel->getNumberOfRewardModels(), compiledModel->getNumberOfRewardModels());
+        for (auto const& nameRewardModelPair : interpretedModel->getRewardModels()) {
+            auto const& compiledRewardModel = compiledModel->getRewardModel(nameRewardModelPair.first);
+            if (nameRewardModelPair.second.hasStateRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateRewardVector(), compiledRewardModel.getStateRewardVector());
+            }
+            if (nameRewardModelPair.second.hasStateActionRewards()) {
+                EXPECT_EQ(nameRewardModelPair.second.getStateActionRewardVector(), compiledRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, PartialOrderReduction) {
+    // The steps of module b are independent of module a and invisible to the label, so they do not need to be
+    // interleaved with the steps of module a.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(R"(mdp
+module a
+    x : [0..3] init 0;
+    [] x<3 -> 0.5 : (x'=x+1) + 0.5 : (x'=x);
+endmodule
+module b
+    y : [0..3] init 0;
+    [] y<3 -> (y'=y+1);
+endmodule
+label "done" = x=3;
+)", "partial_order_reduction.nm");
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.addLabel("done");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(16ul, model->getNumberOfStates());
+    EXPECT_EQ(4ul, model->getStates("done").getNumberOfSetBits());
+    
+    generatorOptions.setPartialOrderReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(7ul, reducedModel->getNumberOfStates());
+    EXPECT_EQ(1ul, reducedModel->getStates("done").getNumberOfSetBits());
+    
+    // The reduction preserves the minimal and maximal probabilities of (stutter-invariant) properties.
+    double const precision = 1e-6;
+    auto computeValue = [] (std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& formulaString) {
+        storm::Environment env;
+        storm::parser::FormulaParser formulaParser;
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*model->as<storm::models::sparse::Mdp<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    };
+    for (std::string const& formulaString : {"Pmin=? [F \"done\"]", "Pmax=? [F \"done\"]"}) {
+        EXPECT_NEAR(computeValue(model, formulaString), computeValue(reducedModel, formulaString), precision);
+    }
+    
+    // The coin is invisible and independent of the choice of y, but it must not be used as an ample set, as it is
+    // probabilistic: the full model allows choosing y before the outcome of the coin is known.
+    program = storm::parser::PrismParser::parseFromString(R"(mdp
+module coin
+    z : [0..2] init 0;
+    [] z=0 -> 0.5 : (z'=1) + 0.5 : (z'=2);
+endmodule
+module copy
+    x : [0..2] init 0;
+    [] x=0 & z>0 -> (x'=z);
+endmodule
+module choose
+    y : [0..2] init 0;
+    [] y=0 -> (y'=1);
+    [] y=0 -> (y'=2);
+endmodule
+label "target" = x>0 & x=y;
+)", "partial_order_reduction_coin.nm");
+    
+    generatorOptions = storm::generator::NextStateGeneratorOptions();
+    generatorOptions.addLabel("target");
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    generatorOptions.setPartialOrderReduction();
+    reducedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    for (std::string const& formulaString : {"Pmin=? [F \"target\"]", "Pmax=? [F \"target\"]"}) {
+        EXPECT_NEAR(computeValue(model, formulaString), computeValue(reducedModel, formulaString), precision);
+    }
+}
+
+TEST(ExplicitPrismModelBuilderTest, LumpingOnTheFly) {
+    storm::builder::ExplicitModelBuilder<double>::Options fullOptions;
+    fullOptions.lumpStates = false;
+    storm::builder::ExplicitModelBuilder<double>::Options lumpingOptions = fullOptions;
+    lumpingOptions.lumpStates = true;
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions(true, true);
+    
+    // The (absorbing) final states for the values four to six are merged, as no label distinguishes them.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, lumpingOptions).build();
+    EXPECT_EQ(11ul, model->getNumberOfStates());
+    EXPECT_EQ(17ul, model->getNumberOfTransitions());
+    EXPECT_EQ(1ul, model->getInitialStates().getNumberOfSetBits());
+    EXPECT_EQ(4ul, model->getStates("done").getNumberOfSetBits());
+    
+    auto computeQuotient = [] (std::shared_ptr<storm::models::sparse::Model<double>> const& model) {
+        storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Dtmc<double>> bisimulation(*model->as<storm::models::sparse::Dtmc<double>>());
+        bisimulation.computeBisimulationDecomposition();
+        return bisimulation.getQuotient();
+    };
+    
+    // Merging states while exploring them does not change the coarsest quotient.
+    for (std::string const& filename : {"/dtmc/die.pm", "/dtmc/crowds-5-5.pm"}) {
+        program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR + filename);
+        std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, fullOptions).build();
+        std::shared_ptr<storm::models::sparse::Model<double>> lumpedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, lumpingOptions).build();
+        EXPECT_LT(lumpedModel->getNumberOfStates(), fullModel->getNumberOfStates());
+        
+        std::shared_ptr<storm::models::sparse::Model<double>> fullQuotient = computeQuotient(fullModel);
+        std::shared_ptr<storm::models::sparse::Model<double>> lumpedQuotient = computeQuotient(lumpedModel);
+        EXPECT_EQ(fullQuotient->getNumberOfStates(), lumpedQuotient->getNumberOfStates());
+        EXPECT_EQ(fullQuotient->getNumberOfTransitions(), lumpedQuotient->getNumberOfTransitions());
+    }
+    
+    // The probabilities and rewards are preserved.
+    auto computeValue = [] (std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& formulaString) {
+        storm::parser::FormulaParser formulaParser;
+        std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString(formulaString);
+        storm::Environment env;
+        storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<double>> checker(*model->as<storm::models::sparse::Dtmc<double>>());
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *formula);
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    };
+    double const precision = 1e-6;
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, fullOptions).build();
+    std::shared_ptr<storm::models::sparse::Model<double>> lumpedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, lumpingOptions).build();
+    ASSERT_TRUE(lumpedModel->hasRewardModel("coin_flips"));
+    EXPECT_NEAR(1.0 / 6.0, computeValue(lumpedModel, "P=? [F \"two\"]"), precision);
+    EXPECT_NEAR(computeValue(fullModel, "P=? [F \"two\"]"), computeValue(lumpedModel, "P=? [F \"two\"]"), precision);
+    EXPECT_NEAR(11.0 / 3.0, computeValue(lumpedModel, "R{\"coin_flips\"}=? [F \"done\"]"), precision);
+    EXPECT_NEAR(computeValue(fullModel, "R{\"coin_flips\"}=? [F \"done\"]"), computeValue(lumpedModel, "R{\"coin_flips\"}=? [F \"done\"]"), precision);
+    
+    program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    fullModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, fullOptions).build();
+    lumpedModel = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions, lumpingOptions).build();
+    EXPECT_NEAR(computeValue(fullModel, "P=? [F \"observe0Greater1\"]"), computeValue(lumpedModel, "P=? [F \"observe0Greater1\"]"), precision);
+    EXPECT_NEAR(computeValue(fullModel, "P=? [F \"observeIGreater1\"]"), computeValue(lumpedModel, "P=? [F \"observeIGreater1\"]"), precision);
+}
+
+#ifdef STORM_HAVE_Z3
+TEST(ExplicitPrismModelBuilderTest, SymmetryReduction) {
+    // The two dice are obtained from each other by swapping their variables.
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    
+    storm::generator::NextStateGeneratorOptions generatorOptions;
+    generatorOptions.addLabel("two");
+    generatorOptions.setSymmetryReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(91ul, model->getNumberOfStates());
+    EXPECT_EQ(1ul, model->getStates("two").getNumberOfSetBits());
+    
+    // A label that distinguishes the dice prevents the reduction.
+    generatorOptions.addLabel(program.getManager().getVariableExpression("d1") == program.getManager().integer(1));
+    model = storm::builder::ExplicitModelBuilder<double>(program, generatorOptions).build();
+    EXPECT_EQ(169ul, model->getNumberOfStates());
+}
+#endif
@@ -0,0 +1,60 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <algorithm>
+
+#include "storm/generator/GuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+TEST(GuardIndexTest, Candidates) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+
+    // Pack x into bit 0, y in [-3, 12] into bits 1-4 and z in [0, 6] into bits 5-7.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0, true, true);
+    variableInformation.integerVariables.emplace_back(y, -3, 12, 1, 4);
+    variableInformation.integerVariables.emplace_back(z, 0, 6, 5, 3);
+    variableInformation.totalBitOffset = 8;
+
+    std::vector<storm::expressions::Expression> guards = {
+        x && y == manager->integer(3),
+        y > manager->integer(5) && z < manager->integer(3),
+        !x && manager->integer(0) >= y,
+        manager->integer(-1) < y && (y <= manager->integer(1) || z == manager->integer(4)),
+        y == manager->integer(20),
+        manager->boolean(true),
+        y + z == manager->integer(7)
+    };
+
+    storm::generator::GuardIndex guardIndex(variableInformation, guards);
+    EXPECT_TRUE(guardIndex.isDiscriminating());
+
+    storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+    uint64_t numberOfCandidates = 0;
+    uint64_t numberOfStates = 0;
+    for (uint64_t stateAsInt = 0; stateAsInt < 256; ++stateAsInt) {
+        storm::generator::CompressedState state(64);
+        state.setFromInt(0, 8, stateAsInt);
+        if (state.getAsInt(5, 3) > 6) {
+            continue;
+        }
+        storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+
+        std::vector<uint64_t> const& candidates = guardIndex.getCandidates(state);
+        EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end()));
+        for (uint64_t position = 0; position < guards.size(); ++position) {
+            if (evaluator.asBool(guards[position])) {
+                EXPECT_TRUE(std::binary_search(candidates.begin(), candidates.end(), position)) << guards[position];
+            }
+        }
+        numberOfCandidates += candidates.size();
+        ++numberOfStates;
+    }
+    EXPECT_LT(numberOfCandidates, numberOfStates * guards.size());
+}
@@ -0,0 +1,58 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/modelchecker/exploration/LazyModel.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm-parsers/parser/PrismParser.h"
+
+#include "storm/storage/expressions/ExpressionManager.h"
+
+TEST(LazyModelTest, EvictedRowsAreRegenerated) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm").substituteConstantsFormulas();
+    storm::expressions::Expression conditionExpression = program.getManager().boolean(true);
+    storm::expressions::Expression targetExpression = program.getLabelToExpressionMapping().at("two");
+
+    // One model caches the rows of all states, the other one only those of a single state.
+    storm::modelchecker::exploration_detail::LazyModel<uint32_t, double> cachingModel(std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program), conditionExpression, targetExpression, 1000);
+    storm::modelchecker::exploration_detail::LazyModel<uint32_t, double> evictingModel(std::make_shared<storm::generator::PrismNextStateGenerator<double, uint32_t>>(program), conditionExpression, targetExpression, 1);
+    ASSERT_EQ(1ul, cachingModel.getInitialStates().size());
+    ASSERT_EQ(cachingModel.getInitialStates(), evictingModel.getInitialStates());
+
+    // Expand both models in the same order, so the states get the same indices.
+    std::vector<uint32_t> expandedStates;
+    std::vector<bool> discovered(1, true);
+    expandedStates.push_back(cachingModel.getInitialStates().front());
+    for (uint64_t position = 0; position < expandedStates.size(); ++position) {
+        auto const& cachedRows = cachingModel.getRows(expandedStates[position]);
+        auto const& evictedRows = evictingModel.getRows(expandedStates[position]);
+        ASSERT_EQ(cachedRows.rowIndications, evictedRows.rowIndications);
+        ASSERT_EQ(cachedRows.entries, evictedRows.entries);
+        discovered.resize(cachingModel.getNumberOfDiscoveredStates(), false);
+        for (auto const& entry : cachedRows.entries) {
+            if (!discovered[entry.getColumn()]) {
+                discovered[entry.getColumn()] = true;
+                if (!cachingModel.isTerminalState(entry.getColumn())) {
+                    expandedStates.push_back(entry.getColumn());
+                }
+            }
+        }
+    }
+    EXPECT_EQ(cachingModel.getNumberOfDiscoveredStates(), evictingModel.getNumberOfDiscoveredStates());
+    EXPECT_LT(expandedStates.size(), cachingModel.getNumberOfDiscoveredStates());
+
+    // Requesting the rows again regenerates the evicted ones without discovering new states.
+    uint64_t numberOfStates = evictingModel.getNumberOfDiscoveredStates();
+    for (auto state : expandedStates) {
+        auto const& cachedRows = cachingModel.getRows(state);
+        auto const& evictedRows = evictingModel.getRows(state);
+        EXPECT_EQ(cachedRows.entries, evictedRows.entries);
+        for (std::size_t row = 0; row < evictedRows.getNumberOfRows(); ++row) {
+            double probabilitySum = 0;
+            for (auto entryIt = evictedRows.begin(row); entryIt != evictedRows.end(row); ++entryIt) {
+                probabilitySum += entryIt->getValue();
+            }
+            EXPECT_NEAR(1.0, probabilitySum, 1e-9);
+        }
+    }
+    EXPECT_EQ(numberOfStates, evictingModel.getNumberOfDiscoveredStates());
+}
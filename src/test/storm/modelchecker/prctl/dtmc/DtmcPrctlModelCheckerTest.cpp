@@ -3,6 +3,7 @@
 #include "storm-config.h"
 
 #include "storm/api/builder.h"
+#include "storm/api/verification.h"
 #include "storm-conv/api/storm-conv.h"
 #include "storm-parsers/api/model_descriptions.h"
 #include "storm/api/properties.h"
@@ -19,6 +20,7 @@
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
@@ -311,6 +313,24 @@ namespace {
         }
     };
 
+    class SparseTopologicalParallelNativeJacobiEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // unused for sparse models
+        static const DtmcEngine engine = DtmcEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Dtmc<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Topological);
+            env.solver().topological().setUnderlyingEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().topological().setNumberOfThreads(4);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+
     class HybridSylvanGmmxxGmresEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -556,6 +576,7 @@ namespace {
             SparseNativeIntervalIterationEnvironment,
             SparseNativeRationalSearchEnvironment,
             SparseTopologicalEigenLUEnvironment,
+            SparseTopologicalParallelNativeJacobiEnvironment,
             HybridSylvanGmmxxGmresEnvironment,
             HybridCuddNativeJacobiEnvironment,
             HybridCuddNativeSoundValueIterationEnvironment,
@@ -698,4 +719,59 @@ namespace {
         EXPECT_NEAR(0, result[12], 1e-6);
     }
 
+    TEST(DtmcPrctlModelCheckerTest, UntilProbabilitiesBatch) {
+        std::string formulasString = "P=? [F \"one\"]";
+        formulasString += "; P=? [F \"two\"]";
+        formulasString += "; P=? [F \"three\"]";
+
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::Dtmc<double>>();
+        uint64_t initialState = *model->getInitialStates().begin();
+
+        // The maybe states of the second and the third query coincide, so these are solved simultaneously.
+        std::vector<storm::storage::BitVector> phiStates(3, storm::storage::BitVector(model->getNumberOfStates(), true));
+        std::vector<storm::storage::BitVector> psiStates = {model->getStates("one"), model->getStates("two"), model->getStates("three")};
+
+        storm::Environment powerEnv;
+        powerEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        powerEnv.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        powerEnv.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+        storm::Environment jacobiEnv = powerEnv;
+        jacobiEnv.solver().native().setPowerMethodMultiplicationStyle(storm::solver::MultiplicationStyle::Regular);
+        storm::Environment gmmxxEnv;
+        gmmxxEnv.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Gmmxx);
+
+        for (auto const& env : {powerEnv, jacobiEnv, gmmxxEnv}) {
+            std::vector<std::vector<double>> results = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeUntilProbabilitiesBatch(env, std::vector<storm::solver::SolveGoal<double>>(3), model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates, psiStates);
+            ASSERT_EQ(3ul, results.size());
+            for (uint64_t query = 0; query < 3; ++query) {
+                EXPECT_NEAR(1.0/6, results[query][initialState], 1e-8);
+                std::vector<double> singleResult = storm::modelchecker::helper::SparseDtmcPrctlHelper<double>::computeUntilProbabilities(env, storm::solver::SolveGoal<double>(), model->getTransitionMatrix(), model->getBackwardTransitions(), phiStates[query], psiStates[query], false);
+                for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+                    EXPECT_NEAR(singleResult[state], results[query][state], 1e-8);
+                }
+            }
+        }
+        
+        // Check the formulas through the API, together with a bounded formula and a formula that is not batched.
+        auto allFormulas = formulas;
+        allFormulas.push_back(storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P>0.1 [F \"one\"]", program)).front());
+        allFormulas.push_back(storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F<=3 \"done\"]", program)).front());
+        std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+        for (auto const& formula : allFormulas) {
+            tasks.push_back(storm::api::createTask<double>(formula, true));
+        }
+        for (auto const& env : {powerEnv, gmmxxEnv}) {
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = storm::api::verifyWithSparseEngine(env, model, tasks);
+            ASSERT_EQ(tasks.size(), results.size());
+            for (uint64_t query = 0; query < 3; ++query) {
+                EXPECT_NEAR(1.0/6, results[query]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-8);
+            }
+            EXPECT_TRUE(results[3]->asExplicitQualitativeCheckResult()[initialState]);
+            std::unique_ptr<storm::modelchecker::CheckResult> singleResult = storm::api::verifyWithSparseEngine(env, model, tasks[4]);
+            EXPECT_NEAR(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], results[4]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-8);
+        }
+    }
+
 }
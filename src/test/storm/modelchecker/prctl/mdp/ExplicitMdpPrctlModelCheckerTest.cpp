@@ -6,6 +6,7 @@
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpSolverCache.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
@@ -197,3 +198,46 @@ TEST(ExplicitMdpPrctlModelCheckerTest, AsynchronousLeader) {
     EXPECT_NEAR(30.0/7.0, quantitativeResult6[0], precision);
 }
 
+TEST(ExplicitMdpPrctlModelCheckerTest, SolverCache) {
+    std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(STORM_TEST_RESOURCES_DIR "/tra/two_dice.tra", STORM_TEST_RESOURCES_DIR "/lab/two_dice.lab", "", "");
+    storm::Environment env;
+    double const precision = 1e-6;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+    
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = abstractModel->as<storm::models::sparse::Mdp<double>>();
+    
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    auto solverCache = std::make_shared<storm::modelchecker::helper::SparseMdpSolverCache<double>>();
+    checker.setSolverCache(solverCache);
+    
+    std::shared_ptr<storm::logic::Formula const> minFormula = formulaParser.parseSingleFormulaFromString("Pmin=? [F \"three\"]");
+    std::shared_ptr<storm::logic::Formula const> maxFormula = formulaParser.parseSingleFormulaFromString("Pmax=? [F \"three\"]");
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, *minFormula);
+    EXPECT_NEAR(2.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    result = checker.check(env, *maxFormula);
+    EXPECT_NEAR(2.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(2ull, solverCache->getNumberOfEntries());
+    EXPECT_EQ(0ull, solverCache->getNumberOfHits());
+    
+    // Checking the same formulas again (also with a fresh checker for the same model) reuses the cached results.
+    result = checker.check(env, *minFormula);
+    EXPECT_NEAR(2.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> otherChecker(*mdp);
+    otherChecker.setSolverCache(solverCache);
+    result = otherChecker.check(env, *maxFormula);
+    EXPECT_NEAR(2.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(2ull, solverCache->getNumberOfEntries());
+    EXPECT_EQ(2ull, solverCache->getNumberOfHits());
+    
+    // A small cache evicts the least recently used entry.
+    solverCache = std::make_shared<storm::modelchecker::helper::SparseMdpSolverCache<double>>(1);
+    checker.setSolverCache(solverCache);
+    checker.check(env, *minFormula);
+    checker.check(env, *maxFormula);
+    result = checker.check(env, *minFormula);
+    EXPECT_NEAR(2.0/36.0, result->asExplicitQuantitativeCheckResult<double>()[0], precision);
+    EXPECT_EQ(1ull, solverCache->getNumberOfEntries());
+    EXPECT_EQ(0ull, solverCache->getNumberOfHits());
+}
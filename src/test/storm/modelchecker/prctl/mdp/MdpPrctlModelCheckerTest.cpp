@@ -120,6 +120,25 @@ namespace {
             storm::Environment env;
             env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
             env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setNumberOfThreads(1);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().minMax().setRelativeTerminationCriterion(false);
+            return env;
+        }
+    };
+    
+    class SparseDoubleTopologicalParallelValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan; // Unused for sparse models
+        static const MdpEngine engine = MdpEngine::PrismSparse;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::sparse::Mdp<ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::Topological);
+            env.solver().topological().setUnderlyingMinMaxMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().topological().setNumberOfThreads(4);
             env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
             env.solver().minMax().setRelativeTerminationCriterion(false);
             return env;
@@ -419,6 +438,7 @@ namespace {
             SparseDoubleIntervalIterationEnvironment,
             SparseDoubleSoundValueIterationEnvironment,
             SparseDoubleTopologicalValueIterationEnvironment,
+            SparseDoubleTopologicalParallelValueIterationEnvironment,
             SparseDoubleTopologicalSoundValueIterationEnvironment,
             SparseRationalPolicyIterationEnvironment,
             SparseRationalViToPiEnvironment,
@@ -6,8 +6,10 @@
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/TerminationCondition.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace {
@@ -23,6 +25,20 @@ namespace {
             return env;
         }
     };
+    class DoubleMixedPrecisionViEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setMixedPrecision(true);
+            env.solver().multiplier().setMixedPrecisionRefinement(true);
+            return env;
+        }
+    };
     class DoubleSoundViEnvironment {
     public:
         typedef double ValueType;
@@ -122,6 +138,7 @@ namespace {
   
     typedef ::testing::Types<
             DoubleViEnvironment,
+            DoubleMixedPrecisionViEnvironment,
             DoubleSoundViEnvironment,
             DoubleIntervalIterationEnvironment,
             DoubleTopologicalViEnvironment,
@@ -160,7 +177,43 @@ namespace {
         ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
         EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
     }
+    
+    TEST(MinMaxLinearEquationSolverMixedPrecisionTest, SolveEquationsWithGuarantee) {
+        // The second choice is an end component, so the maximal solution is only obtained when approaching it from below.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        ASSERT_NO_THROW(builder.newRowGroup(0));
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, 0.9));
+        ASSERT_NO_THROW(builder.addNextValue(1, 0, 1.0));
+        
+        storm::storage::SparseMatrix<double> A;
+        ASSERT_NO_THROW(A = builder.build(2));
+        std::vector<double> b = {0.099, 0.0};
+        
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+        env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        env.solver().multiplier().setMixedPrecision(true);
+        env.solver().multiplier().setMixedPrecisionRefinement(true);
+        
+        auto factory = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>();
+        auto solver = factory.create(env, A);
+        solver->setHasUniqueSolution(false);
+        solver->setBounds(0.0, 1.0);
+        storm::solver::MinMaxLinearEquationSolverRequirements req = solver->getRequirements(env, storm::OptimizationDirection::Maximize);
+        req.clearBounds();
+        ASSERT_FALSE(req.hasEnabledRequirement());
+        
+        // The single precision iterates do not provide the guarantee, but still converge to the solution.
+        std::vector<double> x(1);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_NEAR(x[0], 0.99, 1e-6);
+        
+        // A termination condition that requires the guarantee makes the solver use full precision, so the early result is a lower bound.
+        solver->setTerminationCondition(std::make_unique<storm::solver::TerminateIfFilteredExtremumExceedsThreshold<double>>(storm::storage::BitVector(1, true), false, 0.5, true));
+        x = std::vector<double>(1);
+        ASSERT_NO_THROW(solver->solveEquations(env, storm::OptimizationDirection::Maximize, x, b));
+        EXPECT_GE(x[0], 0.5);
+        EXPECT_LE(x[0], 0.99);
+    }
 }
-
-
-
@@ -3,10 +3,12 @@
 #include "test/storm_gtest.h"
 
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/SplitSparseMatrix.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/environment/solver/MultiplierEnvironment.h"
 
 #include "storm/utility/vector.h"
+#include "storm/utility/simd.h"
 namespace {
     
     class NativeEnvironment {
@@ -20,6 +22,41 @@ namespace {
         }
     };
     
+    class NativeSplitEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+            env.solver().multiplier().setSplitStorage(true);
+            return env;
+        }
+    };
+    
+    class NativeParallelEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::NativeParallel);
+            env.solver().multiplier().setNumberOfThreads(2);
+            return env;
+        }
+    };
+    
+    class NativeSimdEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::NativeSimd);
+            return env;
+        }
+    };
+    
     class GmmxxEnvironment {
     public:
         typedef double ValueType;
@@ -45,6 +82,9 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
+            NativeSplitEnvironment,
+            NativeParallelEnvironment,
+            NativeSimdEnvironment,
             GmmxxEnvironment
     > TestingTypes;
     
@@ -120,4 +160,228 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, multiplyBatchTest) {
+        typedef typename TestFixture::ValueType ValueType;
+        storm::storage::SparseMatrixBuilder<ValueType> builder;
+        ASSERT_NO_THROW(builder.addNextValue(0, 0, this->parseNumber("0.25")));
+        ASSERT_NO_THROW(builder.addNextValue(0, 1, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(1, 2, this->parseNumber("0.75")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 0, this->parseNumber("0.5")));
+        ASSERT_NO_THROW(builder.addNextValue(2, 2, this->parseNumber("0.5")));
+        
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+        
+        std::vector<ValueType> x1 = {this->parseNumber("1"), this->parseNumber("0.5"), this->parseNumber("0")};
+        std::vector<ValueType> x2 = {this->parseNumber("0"), this->parseNumber("0.25"), this->parseNumber("1")};
+        std::vector<ValueType> b1 = {this->parseNumber("0.125"), this->parseNumber("0"), this->parseNumber("0.25")};
+        std::vector<ValueType> b2 = {this->parseNumber("0"), this->parseNumber("0.5"), this->parseNumber("0")};
+        
+        // Interleave the vectors.
+        std::vector<ValueType> x, b;
+        for (uint64_t row = 0; row < 3; ++row) {
+            x.push_back(x1[row]);
+            x.push_back(x2[row]);
+            b.push_back(b1[row]);
+            b.push_back(b2[row]);
+        }
+        
+        auto factory = storm::solver::MultiplierFactory<ValueType>();
+        auto multiplier = factory.create(this->env(), A);
+        
+        std::vector<ValueType> result(6);
+        ASSERT_NO_THROW(multiplier->multiplyBatch(this->env(), 2, x, &b, result));
+        std::vector<ValueType> result1(3), result2(3);
+        multiplier->multiply(this->env(), x1, &b1, result1);
+        multiplier->multiply(this->env(), x2, &b2, result2);
+        for (uint64_t row = 0; row < 3; ++row) {
+            EXPECT_NEAR(result1[row], result[2 * row], this->precision());
+            EXPECT_NEAR(result2[row], result[2 * row + 1], this->precision());
+        }
+        
+        // Aliased input and output.
+        std::vector<ValueType> inPlace = x;
+        ASSERT_NO_THROW(multiplier->multiplyBatch(this->env(), 2, inPlace, &b, inPlace));
+        for (uint64_t index = 0; index < 6; ++index) {
+            EXPECT_NEAR(result[index], inPlace[index], this->precision());
+        }
+        
+        inPlace = x;
+        ASSERT_NO_THROW(multiplier->multiplyBatchGaussSeidel(this->env(), 2, inPlace, &b));
+        multiplier->multiplyGaussSeidel(this->env(), x1, &b1);
+        multiplier->multiplyGaussSeidel(this->env(), x2, &b2);
+        for (uint64_t row = 0; row < 3; ++row) {
+            EXPECT_NEAR(x1[row], inPlace[2 * row], this->precision());
+            EXPECT_NEAR(x2[row], inPlace[2 * row + 1], this->precision());
+        }
+    }
+    
+    storm::storage::SparseMatrix<double> buildLargeMatrix(uint64_t numberOfGroups, double scaling) {
+        // Build a matrix that is large enough such that the multiplication is actually split among several threads.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            builder.newRowGroup(row);
+            uint64_t numberOfChoices = 1 + group % 3;
+            for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                uint64_t firstColumn = (group + choice) % numberOfGroups;
+                uint64_t secondColumn = (group * 7 + choice + 1) % numberOfGroups;
+                if (firstColumn == secondColumn) {
+                    builder.addNextValue(row, firstColumn, scaling);
+                } else {
+                    builder.addNextValue(row, std::min(firstColumn, secondColumn), 0.25 * scaling);
+                    builder.addNextValue(row, std::max(firstColumn, secondColumn), 0.75 * scaling);
+                }
+            }
+        }
+        return builder.build();
+    }
+    
+    TEST(NativeParallelMultiplierTest, LargeMatrix) {
+        uint64_t const numberOfGroups = 20000;
+        storm::storage::SparseMatrix<double> A = buildLargeMatrix(numberOfGroups, 1.0);
+        
+        std::vector<double> x(numberOfGroups);
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            x[group] = static_cast<double>(group % 100) / 100.0;
+        }
+        std::vector<double> b(A.getRowCount(), 0.125);
+        
+        storm::Environment sequentialEnv;
+        sequentialEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        storm::Environment parallelEnv;
+        parallelEnv.solver().multiplier().setType(storm::solver::MultiplierType::NativeParallel);
+        parallelEnv.solver().multiplier().setNumberOfThreads(4);
+        
+        auto sequentialMultiplier = storm::solver::MultiplierFactory<double>().create(sequentialEnv, A);
+        auto parallelMultiplier = storm::solver::MultiplierFactory<double>().create(parallelEnv, A);
+        
+        std::vector<double> sequentialResult(A.getRowCount());
+        std::vector<double> parallelResult(A.getRowCount());
+        sequentialMultiplier->multiply(sequentialEnv, x, &b, sequentialResult);
+        parallelMultiplier->multiply(parallelEnv, x, &b, parallelResult);
+        EXPECT_EQ(sequentialResult, parallelResult);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> sequentialReduced(numberOfGroups);
+            std::vector<double> parallelReduced(numberOfGroups);
+            std::vector<uint_fast64_t> sequentialChoices(numberOfGroups, 0);
+            std::vector<uint_fast64_t> parallelChoices(numberOfGroups, 0);
+            sequentialMultiplier->multiplyAndReduce(sequentialEnv, dir, x, &b, sequentialReduced, &sequentialChoices);
+            parallelMultiplier->multiplyAndReduce(parallelEnv, dir, x, &b, parallelReduced, &parallelChoices);
+            EXPECT_EQ(sequentialReduced, parallelReduced);
+            EXPECT_EQ(sequentialChoices, parallelChoices);
+        }
+    }
+    
+    TEST(NativeParallelMultiplierTest, GaussSeidel) {
+        // As the matrix is substochastic, the iteration converges to a unique fixed point, regardless of how the blocks are combined.
+        uint64_t const numberOfGroups = 20000;
+        storm::storage::SparseMatrix<double> A = buildLargeMatrix(numberOfGroups, 0.9);
+        std::vector<double> b(A.getRowCount());
+        for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+            b[row] = static_cast<double>(row % 10) / 100.0;
+        }
+        
+        storm::Environment sequentialEnv;
+        sequentialEnv.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+        storm::Environment parallelEnv;
+        parallelEnv.solver().multiplier().setType(storm::solver::MultiplierType::NativeParallel);
+        parallelEnv.solver().multiplier().setNumberOfThreads(4);
+        
+        auto sequentialMultiplier = storm::solver::MultiplierFactory<double>().create(sequentialEnv, A);
+        auto parallelMultiplier = storm::solver::MultiplierFactory<double>().create(parallelEnv, A);
+        
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<double> sequentialX(numberOfGroups, 0.0);
+            std::vector<double> parallelX(numberOfGroups, 0.0);
+            std::vector<uint_fast64_t> sequentialChoices(numberOfGroups, 0);
+            std::vector<uint_fast64_t> parallelChoices(numberOfGroups, 0);
+            for (uint64_t iteration = 0; iteration < 300; ++iteration) {
+                sequentialMultiplier->multiplyAndReduceGaussSeidel(sequentialEnv, dir, sequentialX, &b, &sequentialChoices);
+                parallelMultiplier->multiplyAndReduceGaussSeidel(parallelEnv, dir, parallelX, &b, &parallelChoices);
+            }
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                EXPECT_NEAR(sequentialX[group], parallelX[group], 1e-8);
+            }
+            // Since the values converge, the parallel iteration yields the same values as the sequential one after one more step.
+            std::vector<double> sequentialResult(numberOfGroups);
+            sequentialMultiplier->multiplyAndReduce(sequentialEnv, dir, parallelX, &b, sequentialResult);
+            for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                EXPECT_NEAR(sequentialResult[group], parallelX[group], 1e-8);
+            }
+        }
+        
+        // Gauss-Seidel iteration without reduction.
+        storm::storage::SparseMatrix<double> dtmcMatrix = A.selectRowsFromRowGroups(std::vector<uint_fast64_t>(numberOfGroups, 0), false);
+        std::vector<double> dtmcB(numberOfGroups, 0.05);
+        sequentialMultiplier = storm::solver::MultiplierFactory<double>().create(sequentialEnv, dtmcMatrix);
+        parallelMultiplier = storm::solver::MultiplierFactory<double>().create(parallelEnv, dtmcMatrix);
+        std::vector<double> sequentialX(numberOfGroups, 0.0);
+        std::vector<double> parallelX(numberOfGroups, 0.0);
+        for (uint64_t iteration = 0; iteration < 300; ++iteration) {
+            sequentialMultiplier->multiplyGaussSeidel(sequentialEnv, sequentialX, &dtmcB);
+            parallelMultiplier->multiplyGaussSeidel(parallelEnv, parallelX, &dtmcB);
+        }
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            EXPECT_NEAR(sequentialX[group], parallelX[group], 1e-8);
+        }
+    }
+    
+    TEST(NativeSimdMultiplierTest, ChoiceTracking) {
+        // Use values that are multiples of 1/8 such that all sums are exact and ties are actually ties.
+        uint64_t const numberOfGroups = 500;
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+        uint64_t row = 0;
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            builder.newRowGroup(row);
+            uint64_t numberOfChoices = 1 + group % 11;
+            for (uint64_t choice = 0; choice < numberOfChoices; ++choice, ++row) {
+                uint64_t numberOfSuccessors = 1 + (group + choice) % 13;
+                for (uint64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+                    builder.addNextValue(row, (group + successor * 37) % numberOfGroups, static_cast<double>((choice + successor) % 3) / 8.0);
+                }
+            }
+        }
+        storm::storage::SparseMatrix<double> A = builder.build();
+        std::vector<double> x(numberOfGroups);
+        for (uint64_t group = 0; group < numberOfGroups; ++group) {
+            x[group] = static_cast<double>(group % 5) / 8.0;
+        }
+        std::vector<double> b(A.getRowCount());
+        for (uint64_t row = 0; row < A.getRowCount(); ++row) {
+            b[row] = static_cast<double>(row % 2) / 4.0;
+        }
+        
+        storm::storage::SplitSparseMatrix<double> splitA(A);
+        std::vector<storm::utility::simd::InstructionSet> instructionSets = {storm::utility::simd::InstructionSet::None};
+        if (storm::utility::simd::getAvailableInstructionSet() != storm::utility::simd::InstructionSet::None) {
+            instructionSets.push_back(storm::utility::simd::InstructionSet::Avx2);
+        }
+        if (storm::utility::simd::getAvailableInstructionSet() == storm::utility::simd::InstructionSet::Avx512) {
+            instructionSets.push_back(storm::utility::simd::InstructionSet::Avx512);
+        }
+        
+        for (auto instructionSet : instructionSets) {
+            std::vector<double> expected(A.getRowCount());
+            std::vector<double> actual(A.getRowCount());
+            A.multiplyWithVector(x, expected, &b);
+            splitA.multiplyWithVectorSimd(instructionSet, x, actual, &b);
+            EXPECT_EQ(expected, actual);
+            
+            for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+                std::vector<double> expectedReduced(numberOfGroups);
+                std::vector<double> actualReduced(numberOfGroups);
+                std::vector<uint_fast64_t> expectedChoices(numberOfGroups);
+                for (uint64_t group = 0; group < numberOfGroups; ++group) {
+                    expectedChoices[group] = group % A.getRowGroupSize(group);
+                }
+                std::vector<uint_fast64_t> actualChoices = expectedChoices;
+                A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, expectedReduced, &expectedChoices);
+                splitA.multiplyAndReduceSimd(instructionSet, dir, A.getRowGroupIndices(), x, &b, actualReduced, &actualChoices);
+                EXPECT_EQ(expectedReduced, actualReduced);
+                EXPECT_EQ(expectedChoices, actualChoices);
+            }
+        }
+    }
+}
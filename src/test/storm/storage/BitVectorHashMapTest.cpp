@@ -1,9 +1,11 @@
 #include "test/storm_gtest.h"
 
 #include <cstdint>
+#include <memory>
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
+#include "storm/storage/BitVectorTreeCompression.h"
 
 TEST(BitVectorHashMapTest, FindOrAdd) {
     storm::storage::BitVectorHashMap<uint64_t> map(64, 3);
@@ -67,3 +69,48 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, CompressedKeys) {
+    // Segments of 5, 15, 70, 10 and 92 bits.
+    auto compression = std::make_shared<storm::storage::BitVectorTreeCompression>(192, std::vector<uint64_t>({0, 5, 20, 90, 100}));
+    storm::storage::BitVectorHashMap<uint64_t> map(192, 3, 0.75, compression);
+
+    auto createKey = [] (uint64_t index) {
+        storm::storage::BitVector key(192);
+        key.setFromInt(0, 5, index % 7);
+        key.setFromInt(5, 15, index % 13);
+        key.setFromInt(20, 64, (index % 5) * 0x123456789ull);
+        key.setFromInt(100, 30, index);
+        key.setFromInt(130, 62, index / 3);
+        return key;
+    };
+
+    uint64_t const numberOfKeys = 1000;
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_FALSE(map.contains(createKey(index)));
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), index));
+    }
+    EXPECT_EQ(numberOfKeys, map.size());
+
+    // Compressing a key that was compressed before yields the same compressed key.
+    storm::storage::BitVector compressedKey;
+    ASSERT_TRUE(compression->find(createKey(17), compressedKey));
+    EXPECT_EQ(compressedKey, compression->compress(createKey(17)));
+    EXPECT_EQ(createKey(17), compression->decompress(compressedKey));
+    EXPECT_FALSE(compression->find(createKey(numberOfKeys), compressedKey));
+
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        EXPECT_TRUE(map.contains(createKey(index)));
+        EXPECT_EQ(index, map.getValue(createKey(index)));
+        EXPECT_EQ(index, map.findOrAdd(createKey(index), numberOfKeys));
+    }
+    EXPECT_FALSE(map.contains(createKey(numberOfKeys)));
+
+    // Iterating the map yields the original keys.
+    storm::storage::BitVector visitedKeys(numberOfKeys);
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(createKey(keyValuePair.second), keyValuePair.first);
+        visitedKeys.set(keyValuePair.second);
+    }
+    EXPECT_TRUE(visitedKeys.full());
+}
@@ -0,0 +1,105 @@
+#include "test/storm_gtest.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ConcurrentBitVectorHashMap.h"
+
+TEST(ConcurrentBitVectorHashMapTest, FindOrAdd) {
+    storm::storage::ConcurrentBitVectorHashMap<uint64_t> map(64, 3);
+
+    storm::storage::BitVector first(64);
+    first.set(4);
+    first.set(47);
+    ASSERT_NO_THROW(map.findOrAdd(first, 1));
+
+    storm::storage::BitVector second(64);
+    second.set(8);
+    second.set(18);
+    ASSERT_NO_THROW(map.findOrAdd(second, 2));
+
+    EXPECT_EQ(1ul, map.findOrAdd(first, 3));
+    EXPECT_EQ(2ul, map.findOrAdd(second, 3));
+
+    storm::storage::BitVector third(64);
+    third.set(10);
+    third.set(63);
+
+    EXPECT_FALSE(map.contains(third));
+    ASSERT_NO_THROW(map.findOrAdd(third, 3));
+    EXPECT_TRUE(map.contains(third));
+
+    // Trigger several increases of the storage.
+    for (uint64_t index = 0; index < 100; ++index) {
+        storm::storage::BitVector key(64);
+        key.setFromInt(0, 64, index + 1000);
+        EXPECT_EQ(index + 4, map.findOrAdd(key, index + 4));
+    }
+
+    EXPECT_EQ(103ul, map.size());
+    EXPECT_EQ(1ul, map.getValue(first));
+    EXPECT_EQ(2ul, map.getValue(second));
+    EXPECT_EQ(3ul, map.findOrAdd(third, 1));
+
+    uint64_t numberOfIteratedElements = 0;
+    for (auto const& keyValuePair : map) {
+        EXPECT_EQ(keyValuePair.second, map.getValue(keyValuePair.first));
+        ++numberOfIteratedElements;
+    }
+    EXPECT_EQ(103ul, numberOfIteratedElements);
+
+    map.remap([] (uint64_t const& value) { return value + 1; });
+    EXPECT_EQ(2ul, map.getValue(first));
+    EXPECT_EQ(4ul, map.getValue(third));
+}
+
+TEST(ConcurrentBitVectorHashMapTest, ConcurrentFindOrAdd) {
+    // Several threads insert overlapping sets of keys into a map that starts small, so the storage is increased while
+    // the threads insert. Every key must be mapped to exactly one value.
+    uint64_t const numberOfThreads = 4;
+    uint64_t const numberOfKeys = 20011;
+    storm::storage::ConcurrentBitVectorHashMap<uint32_t> map(128, 16);
+    std::atomic<uint32_t> nextValue(0);
+    std::vector<std::vector<uint32_t>> foundValues(numberOfThreads, std::vector<uint32_t>(numberOfKeys));
+
+    std::vector<std::thread> threads;
+    for (uint64_t thread = 0; thread < numberOfThreads; ++thread) {
+        threads.emplace_back([&, thread] () {
+            uint32_t reservedValue = nextValue++;
+            for (uint64_t step = 0; step < numberOfKeys; ++step) {
+                // Each thread visits the keys in a different order (as the number of keys is prime).
+                uint64_t index = (step * (2 * thread + 1)) % numberOfKeys;
+                storm::storage::BitVector key(128);
+                key.setFromInt(0, 64, index);
+                key.setFromInt(64, 64, index % 7);
+                uint32_t value = map.findOrAdd(key, reservedValue);
+                if (value == reservedValue) {
+                    reservedValue = nextValue++;
+                }
+                foundValues[thread][index] = value;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(numberOfKeys, map.size());
+    std::vector<bool> valueUsed(nextValue.load(), false);
+    for (uint64_t index = 0; index < numberOfKeys; ++index) {
+        uint32_t value = foundValues[0][index];
+        for (uint64_t thread = 1; thread < numberOfThreads; ++thread) {
+            EXPECT_EQ(value, foundValues[thread][index]);
+        }
+        EXPECT_FALSE(valueUsed[value]);
+        valueUsed[value] = true;
+
+        storm::storage::BitVector key(128);
+        key.setFromInt(0, 64, index);
+        key.setFromInt(64, 64, index % 7);
+        EXPECT_EQ(value, map.getValue(key));
+    }
+}
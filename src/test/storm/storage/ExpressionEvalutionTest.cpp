@@ -3,6 +3,10 @@
 #include "storm/storage/expressions/ExpressionManager.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/storage/expressions/ExprtkExpressionEvaluator.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+#include "storm/generator/CompiledStateExpression.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 TEST(ExpressionEvaluation, NaiveEvaluation) {
     std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
@@ -60,3 +64,59 @@ TEST(ExpressionEvaluation, ExprTkEvaluation) {
         EXPECT_NEAR(3 * zValue, eval.asRational(iteExpression), 1e-6);
     }
 }
+
+TEST(ExpressionEvaluation, CompiledStateExpressionEvaluation) {
+    std::shared_ptr<storm::expressions::ExpressionManager> manager(new storm::expressions::ExpressionManager());
+
+    storm::expressions::Variable x = manager->declareBooleanVariable("x");
+    storm::expressions::Variable y = manager->declareIntegerVariable("y");
+    storm::expressions::Variable z = manager->declareIntegerVariable("z");
+
+    // Pack x into bit 0, y in [-3, 12] into bits 1-4 and z in [0, 6] into bits 5-7.
+    storm::generator::VariableInformation variableInformation;
+    variableInformation.booleanVariables.emplace_back(x, 0, true, true);
+    variableInformation.integerVariables.emplace_back(y, -3, 12, 1, 4);
+    variableInformation.integerVariables.emplace_back(z, 0, 6, 5, 3);
+    variableInformation.totalBitOffset = 8;
+
+    std::vector<storm::expressions::Expression> expressions = {
+        storm::expressions::ite(x, y + z, manager->integer(3) * z),
+        (y > manager->integer(2) && !x) || (z == manager->integer(4)),
+        storm::expressions::implies(x, y <= z) && storm::expressions::xclusiveor(x, z >= manager->integer(3)),
+        storm::expressions::iff(x, y != manager->integer(0)),
+        storm::expressions::maximum(y, z) - storm::expressions::minimum(y, z) * manager->rational(0.3),
+        (y % manager->integer(4)) + (z ^ manager->integer(2)),
+        storm::expressions::floor(y / manager->rational(2.5)) + storm::expressions::ceil(-z / manager->integer(4)),
+        storm::expressions::ite(y < manager->integer(0), storm::expressions::ite(x, manager->integer(1), manager->integer(2)), z)
+    };
+
+    storm::generator::StateExpressionCompiler compiler(variableInformation);
+    std::vector<storm::generator::CompiledStateExpression> compiledExpressions;
+    for (auto const& expression : expressions) {
+        compiledExpressions.push_back(compiler.compile(expression));
+    }
+
+    storm::expressions::ExpressionEvaluator<double> evaluator(*manager);
+    for (uint64_t stateAsInt = 0; stateAsInt < 256; ++stateAsInt) {
+        storm::generator::CompressedState state(64);
+        state.setFromInt(0, 8, stateAsInt);
+        if (state.getAsInt(5, 3) > 6) {
+            continue;
+        }
+        storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+
+        for (uint64_t index = 0; index < expressions.size(); ++index) {
+            if (expressions[index].hasBooleanType()) {
+                EXPECT_EQ(evaluator.asBool(expressions[index]), compiledExpressions[index].evaluateAsBool(state)) << expressions[index];
+            } else if (expressions[index].hasIntegerType()) {
+                EXPECT_EQ(evaluator.asInt(expressions[index]), compiledExpressions[index].evaluateAsInt(state)) << expressions[index];
+            } else {
+                EXPECT_EQ(evaluator.asRational(expressions[index]), compiledExpressions[index].evaluateAsDouble(state)) << expressions[index];
+            }
+        }
+    }
+
+    // Expressions over variables that are not part of the state cannot be compiled.
+    storm::expressions::Variable w = manager->declareRationalVariable("w");
+    EXPECT_THROW(compiler.compile(w + y), storm::exceptions::NotSupportedException);
+}
@@ -0,0 +1,87 @@
+#include "test/storm_gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/ExternalBitVectorMap.h"
+
+TEST(ExternalBitVectorMapTest, FindAndAdd) {
+    storm::storage::ExternalBitVectorMap<uint64_t> map(128, boost::filesystem::temp_directory_path().string());
+    uint64_t const notFound = 12345678;
+
+    // Add the keys (i, 3 * i) with value i in batches of growing size to create and merge several runs.
+    uint64_t numberOfKeys = 0;
+    for (uint64_t batchSize = 1; batchSize <= 1000; batchSize *= 3) {
+        std::vector<uint64_t> keyWords;
+        std::vector<uint64_t> values;
+        for (uint64_t key = numberOfKeys + batchSize; key > numberOfKeys; --key) {
+            keyWords.push_back(key - 1);
+            keyWords.push_back(3 * (key - 1));
+            values.push_back(key - 1);
+        }
+        map.sort(keyWords, values);
+        EXPECT_EQ(numberOfKeys, values.front());
+
+        // The keys of the batch are not contained yet.
+        std::vector<uint64_t> foundValues;
+        map.find(keyWords, foundValues, notFound);
+        ASSERT_EQ(batchSize, foundValues.size());
+        for (auto const& value : foundValues) {
+            EXPECT_EQ(notFound, value);
+        }
+
+        map.add(keyWords, values);
+        numberOfKeys += batchSize;
+        EXPECT_EQ(numberOfKeys, map.size());
+    }
+
+    // Look up every second key as well as some keys that are not contained.
+    std::vector<uint64_t> keyWords;
+    std::vector<uint64_t> values;
+    for (uint64_t key = 0; key < numberOfKeys + 10; key += 2) {
+        keyWords.push_back(key);
+        keyWords.push_back(3 * key + (key % 4 == 0 ? 0 : 1));
+        values.push_back(key);
+    }
+    map.sort(keyWords, values);
+    std::vector<uint64_t> foundValues;
+    map.find(keyWords, foundValues, notFound);
+    for (uint64_t position = 0; position < values.size(); ++position) {
+        uint64_t key = values[position];
+        if (key < numberOfKeys && key % 4 == 0) {
+            EXPECT_EQ(key, foundValues[position]);
+        } else {
+            EXPECT_EQ(notFound, foundValues[position]);
+        }
+    }
+
+    storm::storage::BitVector visitedKeys(numberOfKeys);
+    map.forEach([&] (storm::storage::BitVector const& key, uint64_t const& value) {
+        EXPECT_EQ(value, key.getAsInt(0, 64));
+        EXPECT_EQ(3 * value, key.getAsInt(64, 64));
+        EXPECT_FALSE(visitedKeys.get(value));
+        visitedKeys.set(value);
+    });
+    EXPECT_TRUE(visitedKeys.full());
+}
+
+TEST(ExternalBitVectorMapTest, List) {
+    storm::storage::ExternalBitVectorList list(64, boost::filesystem::temp_directory_path().string());
+    EXPECT_TRUE(list.empty());
+
+    storm::storage::BitVector bitVector(64);
+    for (uint64_t value = 0; value < 100; ++value) {
+        bitVector.setFromInt(0, 64, value * value);
+        list.push_back(bitVector);
+    }
+    EXPECT_EQ(100ul, list.size());
+
+    for (uint64_t value = 0; value < 100; ++value) {
+        ASSERT_TRUE(list.readNext(bitVector));
+        EXPECT_EQ(value * value, bitVector.getAsInt(0, 64));
+    }
+    EXPECT_FALSE(list.readNext(bitVector));
+}
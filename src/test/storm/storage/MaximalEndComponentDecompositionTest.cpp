@@ -176,3 +176,48 @@ TEST(MaximalEndComponentDecomposition, Example2) {
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0, 1}));
     EXPECT_TRUE((mecDecomposition[1].getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{3}));
 }
+
+TEST(MaximalEndComponentDecomposition, RemovalSplitsCandidate) {
+    // States 0 to 4 form an SCC. However, the only choice of state 2 may lead to state 5, so state 2 is not part of
+    // any MEC. Removing it splits the remaining states into two MECs.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(9, 6, 13, true, true);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 0, 0.5);
+    matrixBuilder.addNextValue(0, 1, 0.5);
+    matrixBuilder.newRowGroup(1);
+    matrixBuilder.addNextValue(1, 0, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 1, 0.5);
+    matrixBuilder.addNextValue(3, 3, 0.25);
+    matrixBuilder.addNextValue(3, 5, 0.25);
+    matrixBuilder.newRowGroup(4);
+    matrixBuilder.addNextValue(4, 4, 1.0);
+    matrixBuilder.addNextValue(5, 2, 1.0);
+    matrixBuilder.newRowGroup(6);
+    matrixBuilder.addNextValue(6, 3, 0.5);
+    matrixBuilder.addNextValue(6, 5, 0.5);
+    matrixBuilder.addNextValue(7, 3, 1.0);
+    matrixBuilder.newRowGroup(8);
+    matrixBuilder.addNextValue(8, 5, 1.0);
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build();
+
+    storm::storage::MaximalEndComponentDecomposition<double> mecDecomposition(matrix, matrix.transpose(true));
+    ASSERT_EQ(3ul, mecDecomposition.size());
+
+    // Because there is no ordering we have to check the contents of the MECs in a symmetrical way.
+    for (auto const& mec : mecDecomposition) {
+        if (mec.containsState(0)) {
+            ASSERT_TRUE((mec.getStateSet() == storm::storage::MaximalEndComponent::set_type{0, 1}));
+            EXPECT_TRUE((mec.getChoicesForState(0) == storm::storage::MaximalEndComponent::set_type{0}));
+            EXPECT_TRUE((mec.getChoicesForState(1) == storm::storage::MaximalEndComponent::set_type{1}));
+        } else if (mec.containsState(3)) {
+            ASSERT_TRUE((mec.getStateSet() == storm::storage::MaximalEndComponent::set_type{3, 4}));
+            EXPECT_TRUE((mec.getChoicesForState(3) == storm::storage::MaximalEndComponent::set_type{4}));
+            EXPECT_TRUE((mec.getChoicesForState(4) == storm::storage::MaximalEndComponent::set_type{7}));
+        } else {
+            ASSERT_TRUE((mec.getStateSet() == storm::storage::MaximalEndComponent::set_type{5}));
+            EXPECT_TRUE((mec.getChoicesForState(5) == storm::storage::MaximalEndComponent::set_type{8}));
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/sparse/ModelAnalysisCache.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/graph.h"
+
+namespace {
+    storm::storage::SparseMatrix<double> buildTestMdp() {
+        // State 0 can stay or move to states 1 and 2, state 1 moves to states 0 and 1 and state 2 is absorbing.
+        storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true, 3);
+        builder.newRowGroup(0);
+        builder.addNextValue(0, 0, 1.0);
+        builder.addNextValue(1, 1, 0.5);
+        builder.addNextValue(1, 2, 0.5);
+        builder.newRowGroup(2);
+        builder.addNextValue(2, 0, 0.5);
+        builder.addNextValue(2, 1, 0.5);
+        builder.newRowGroup(3);
+        builder.addNextValue(3, 2, 1.0);
+        return builder.build();
+    }
+}
+
+TEST(ModelAnalysisCacheTest, CachedResultsMatch) {
+    storm::storage::SparseMatrix<double> transitionMatrix = buildTestMdp();
+    storm::storage::sparse::ModelAnalysisCache<double> cache(1024 * 1024);
+
+    auto backwardTransitionsPointer = cache.getBackwardTransitions(transitionMatrix);
+    storm::storage::SparseMatrix<double> const& backwardTransitions = *backwardTransitionsPointer;
+    EXPECT_EQ(transitionMatrix.transpose(true), backwardTransitions);
+    EXPECT_EQ(backwardTransitionsPointer, cache.getBackwardTransitions(transitionMatrix));
+    EXPECT_EQ(1ull, cache.getNumberOfHits());
+    EXPECT_LT(0ull, cache.getSizeInBytes());
+
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+    auto expectedMin = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    auto expectedMax = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(expectedMin, cache.getProb01Min(transitionMatrix, phiStates, psiStates));
+    EXPECT_EQ(expectedMax, cache.getProb01Max(transitionMatrix, phiStates, psiStates));
+    // Both analyses found the backward transitions in the cache.
+    EXPECT_EQ(3ull, cache.getNumberOfHits());
+
+    // Equal (but distinct) argument sets are found in the cache.
+    storm::storage::BitVector otherPsiStates(3);
+    otherPsiStates.set(2);
+    EXPECT_EQ(expectedMin, cache.getProb01Min(transitionMatrix, phiStates, otherPsiStates));
+    EXPECT_EQ(4ull, cache.getNumberOfHits());
+
+    auto mecDecomposition = cache.getMaximalEndComponents(transitionMatrix);
+    EXPECT_EQ(2ull, mecDecomposition->size());
+    EXPECT_EQ(mecDecomposition, cache.getMaximalEndComponents(transitionMatrix));
+    EXPECT_EQ(6ull, cache.getNumberOfHits());
+
+    cache.clear();
+    EXPECT_EQ(0ull, cache.getSizeInBytes());
+    EXPECT_EQ(0ull, cache.getNumberOfHits());
+    EXPECT_EQ(expectedMax, cache.getProb01Max(transitionMatrix, phiStates, psiStates));
+    EXPECT_EQ(0ull, cache.getNumberOfHits());
+}
+
+TEST(ModelAnalysisCacheTest, EvictsLeastRecentlyUsed) {
+    storm::storage::SparseMatrix<double> transitionMatrix = buildTestMdp();
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+
+    // Determine the size of the backward transitions and a single qualitative result and make room for just these.
+    storm::storage::sparse::ModelAnalysisCache<double> probeCache(1024 * 1024);
+    probeCache.getProb01Min(transitionMatrix, phiStates, psiStates);
+    uint64_t entrySize = probeCache.getSizeInBytes();
+    ASSERT_LT(0ull, entrySize);
+
+    storm::storage::sparse::ModelAnalysisCache<double> cache(entrySize);
+    auto expectedMin = cache.getProb01Min(transitionMatrix, phiStates, psiStates);
+    cache.getProb01Max(transitionMatrix, phiStates, psiStates);
+    EXPECT_LE(cache.getSizeInBytes(), entrySize);
+
+    // The minimizing result was evicted and is recomputed. Only the backward transitions were found in the cache.
+    EXPECT_EQ(expectedMin, cache.getProb01Min(transitionMatrix, phiStates, psiStates));
+    EXPECT_EQ(2ull, cache.getNumberOfHits());
+
+    // Results that do not fit into the cache at all are not stored.
+    storm::storage::sparse::ModelAnalysisCache<double> emptyCache(0);
+    emptyCache.getProb01Min(transitionMatrix, phiStates, psiStates);
+    EXPECT_EQ(0ull, emptyCache.getSizeInBytes());
+
+    // The backward transitions count against the bound as well, but the returned matrix is valid nonetheless.
+    auto backwardTransitions = emptyCache.getBackwardTransitions(transitionMatrix);
+    EXPECT_EQ(0ull, emptyCache.getSizeInBytes());
+    EXPECT_EQ(transitionMatrix.transpose(true), *backwardTransitions);
+}
+
+TEST(ModelAnalysisCacheTest, ModelCopiesHaveOwnCache) {
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 3);
+    builder.addNextValue(0, 0, 0.5);
+    builder.addNextValue(0, 1, 0.5);
+    builder.addNextValue(1, 1, 1.0);
+    storm::models::sparse::Dtmc<double> dtmc(builder.build(), storm::models::sparse::StateLabeling(2));
+    auto backwardTransitions = dtmc.getCachedBackwardTransitions();
+    EXPECT_LT(0ull, dtmc.getAnalysisCache().getSizeInBytes());
+
+    // Modifying the copy must not affect the results cached for the original.
+    storm::models::sparse::Dtmc<double> copy(dtmc);
+    EXPECT_NE(&dtmc.getAnalysisCache(), &copy.getAnalysisCache());
+    EXPECT_EQ(0ull, copy.getAnalysisCache().getSizeInBytes());
+    copy.getTransitionMatrix().getRow(0).begin()->setValue(0.25);
+    (copy.getTransitionMatrix().getRow(0).begin() + 1)->setValue(0.75);
+    EXPECT_EQ(backwardTransitions, dtmc.getCachedBackwardTransitions());
+    EXPECT_EQ(copy.getTransitionMatrix().transpose(true), *copy.getCachedBackwardTransitions());
+}
@@ -1,10 +1,14 @@
 #include "test/storm_gtest.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/ChunkedSparseMatrixBuilder.h"
+#include "storm/storage/ExternalSparseMatrixBuilder.h"
 #include "storm/storage/BitVector.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
 
+#include <boost/filesystem.hpp>
+
 TEST(SparseMatrixBuilder, CreationWithDimensions) {
     storm::storage::SparseMatrixBuilder<double> matrixBuilder(3, 4, 5);
     ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
@@ -148,6 +152,75 @@ TEST(SparseMatrix, Build) {
     ASSERT_EQ(5ul, matrix5.getEntryCount());
 }
 
+TEST(SparseMatrix, BuildExternally) {
+    std::string directory = boost::filesystem::temp_directory_path().string();
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    storm::storage::ExternalSparseMatrixBuilder<double> externalMatrixBuilder(directory, true);
+    for (uint64_t row = 0; row < 1000; ++row) {
+        if (row % 3 == 0) {
+            ASSERT_NO_THROW(matrixBuilder.newRowGroup(row));
+            ASSERT_NO_THROW(externalMatrixBuilder.newRowGroup(row));
+        }
+        for (uint64_t column = row % 7; column < 1000; column += 100 + row % 13) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, column, 0.5));
+            ASSERT_NO_THROW(externalMatrixBuilder.addNextValue(row, column, 0.5));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, 999, 0.25));
+        ASSERT_NO_THROW(externalMatrixBuilder.addNextValue(row, 999, 0.25));
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(0, 1000, 400);
+    storm::storage::SparseMatrix<double> externalMatrix;
+    ASSERT_NO_THROW(externalMatrix = externalMatrixBuilder.build(0, 1000, 400));
+    ASSERT_EQ(400ul, externalMatrix.getRowGroupCount());
+    ASSERT_TRUE(matrix == externalMatrix);
+
+    storm::storage::ExternalSparseMatrixBuilder<double> externalMatrixBuilder2(directory);
+    ASSERT_NO_THROW(externalMatrixBuilder2.addNextValue(0, 2, 1.0));
+    STORM_SILENT_ASSERT_THROW(externalMatrixBuilder2.addNextValue(0, 1, 1.0), storm::exceptions::InvalidArgumentException);
+}
+
+TEST(SparseMatrix, BuildChunked) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, 0, 0, false, true);
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedMatrixBuilder(true, 100);
+    for (uint64_t row = 0; row < 1000; ++row) {
+        if (row % 3 == 0) {
+            ASSERT_NO_THROW(matrixBuilder.newRowGroup(row));
+            ASSERT_NO_THROW(chunkedMatrixBuilder.newRowGroup(row));
+        }
+        for (uint64_t column = row % 7; column < 1000; column += 100 + row % 13) {
+            ASSERT_NO_THROW(matrixBuilder.addNextValue(row, column, 0.5));
+            ASSERT_NO_THROW(chunkedMatrixBuilder.addNextValue(row, column, 0.5));
+        }
+        ASSERT_NO_THROW(matrixBuilder.addNextValue(row, 999, 0.25));
+        ASSERT_NO_THROW(chunkedMatrixBuilder.addNextValue(row, 999, 0.25));
+    }
+
+    // Reverse the columns.
+    std::vector<uint_fast64_t> replacements(1000);
+    for (uint64_t column = 0; column < 1000; ++column) {
+        replacements[column] = 999 - column;
+    }
+    matrixBuilder.replaceColumns(replacements, 0);
+    ASSERT_NO_THROW(chunkedMatrixBuilder.replaceColumns(replacements, 0));
+
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(0, 1000, 400);
+    storm::storage::SparseMatrix<double> chunkedMatrix;
+    ASSERT_NO_THROW(chunkedMatrix = chunkedMatrixBuilder.build(0, 1000, 400));
+    ASSERT_EQ(400ul, chunkedMatrix.getRowGroupCount());
+    ASSERT_TRUE(matrix == chunkedMatrix);
+
+    storm::storage::ChunkedSparseMatrixBuilder<double> chunkedMatrixBuilder2;
+    ASSERT_NO_THROW(chunkedMatrixBuilder2.addNextValue(0, 2, 1.0));
+    ASSERT_NO_THROW(chunkedMatrixBuilder2.addNextValue(0, 2, 1.0));
+    STORM_SILENT_ASSERT_THROW(chunkedMatrixBuilder2.addNextValue(0, 1, 1.0), storm::exceptions::InvalidArgumentException);
+    ASSERT_NO_THROW(chunkedMatrixBuilder2.addNextValue(2, 0, 1.0));
+    EXPECT_EQ(3ul, chunkedMatrixBuilder2.getCurrentRowGroupCount());
+    storm::storage::SparseMatrix<double> matrix2 = chunkedMatrixBuilder2.build();
+    ASSERT_EQ(3ul, matrix2.getRowCount());
+    ASSERT_EQ(2ul, matrix2.getEntryCount());
+    EXPECT_EQ(2.0, matrix2.getRow(0).begin()->getValue());
+}
+
 TEST(SparseMatrix, CreationWithMovingContents) {
     std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> columnsAndValues;
     columnsAndValues.emplace_back(1, 1.0);
@@ -6,6 +6,9 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 
+#include <map>
+#include <random>
+
 TEST(StronglyConnectedComponentDecomposition, SmallSystemFromMatrix) {
 	storm::storage::SparseMatrixBuilder<double> matrixBuilder(6, 6);
 	ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 0, 0.3));
@@ -86,3 +89,97 @@ TEST(StronglyConnectedComponentDecomposition, FullSystem2) {
 
     markovAutomaton = nullptr;
 }
+
+TEST(StronglyConnectedComponentDecomposition, ParallelMatchesSequential) {
+    // Build a system with two choices per state that consists of cycles of random length which are connected in an
+    // acyclic fashion, with a few additional edges that merge some of the cycles.
+    uint64_t const numberOfStates = 50000;
+    std::mt19937 generator(42);
+    std::vector<std::vector<std::vector<uint64_t>>> successors(numberOfStates, std::vector<std::vector<uint64_t>>(2));
+    for (uint64_t start = 0; start < numberOfStates;) {
+        uint64_t size = generator() % 3 == 0 ? 1 : std::min<uint64_t>(numberOfStates - start, 1 + generator() % 700);
+        for (uint64_t state = start; state < start + size; ++state) {
+            if (size > 1) {
+                successors[state][0].push_back(state + 1 == start + size ? start : state + 1);
+            }
+            if (state + 1 < numberOfStates) {
+                successors[state][generator() % 2].push_back(state + 1 + generator() % std::min<uint64_t>(numberOfStates - state - 1, 5000));
+            }
+            if (generator() % 10 == 0) {
+                successors[state][0].push_back(state);
+            }
+            if (state > 0 && generator() % 5000 == 0) {
+                successors[state][1].push_back(generator() % state);
+            }
+        }
+        start += size;
+    }
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(0, numberOfStates, 0, false, true, numberOfStates);
+    uint64_t row = 0;
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        matrixBuilder.newRowGroup(row);
+        for (auto& choice : successors[state]) {
+            std::sort(choice.begin(), choice.end());
+            choice.erase(std::unique(choice.begin(), choice.end()), choice.end());
+            for (auto const& successor : choice) {
+                matrixBuilder.addNextValue(row, successor, 1.0);
+            }
+            ++row;
+        }
+    }
+    storm::storage::SparseMatrix<double> matrix = matrixBuilder.build(row, numberOfStates, numberOfStates);
+    
+    storm::storage::BitVector subsystem(numberOfStates);
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        subsystem.set(state, generator() % 20 != 0);
+    }
+    storm::storage::BitVector choices(matrix.getRowCount());
+    for (uint64_t choice = 0; choice < matrix.getRowCount(); ++choice) {
+        choices.set(choice, generator() % 4 != 0);
+    }
+    
+    std::vector<storm::storage::StronglyConnectedComponentDecompositionOptions> optionsList = {
+        storm::storage::StronglyConnectedComponentDecompositionOptions().forceTopologicalSort().computeSccDepths(),
+        storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs().computeSccDepths(),
+        storm::storage::StronglyConnectedComponentDecompositionOptions().onlyBottomSccs(),
+        storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&subsystem).choices(&choices).computeSccDepths()
+    };
+    for (auto options : optionsList) {
+        storm::storage::StronglyConnectedComponentDecomposition<double> sequentialDecomposition(matrix, options.numberOfThreads(1));
+        storm::storage::StronglyConnectedComponentDecomposition<double> parallelDecomposition(matrix, options.numberOfThreads(4));
+        ASSERT_EQ(sequentialDecomposition.size(), parallelDecomposition.size());
+        
+        // Both decompositions have to consist of the same SCCs.
+        std::map<uint64_t, uint64_t> stateToParallelScc;
+        for (uint64_t sccIndex = 0; sccIndex < parallelDecomposition.size(); ++sccIndex) {
+            for (auto const& state : parallelDecomposition[sccIndex]) {
+                stateToParallelScc[state] = sccIndex;
+            }
+        }
+        for (uint64_t sccIndex = 0; sccIndex < sequentialDecomposition.size(); ++sccIndex) {
+            auto const& scc = sequentialDecomposition[sccIndex];
+            ASSERT_EQ(1ul, stateToParallelScc.count(*scc.begin()));
+            uint64_t parallelSccIndex = stateToParallelScc[*scc.begin()];
+            EXPECT_EQ(scc, parallelDecomposition[parallelSccIndex]);
+            EXPECT_EQ(scc.isTrivial(), parallelDecomposition[parallelSccIndex].isTrivial());
+            if (options.isComputeSccDepthsSet) {
+                EXPECT_EQ(sequentialDecomposition.getSccDepth(sccIndex), parallelDecomposition.getSccDepth(parallelSccIndex));
+            }
+        }
+        
+        // The SCCs have to be sorted topologically, i.e., an SCC can only reach SCCs with a lower index.
+        for (auto const& stateSccPair : stateToParallelScc) {
+            for (uint64_t choice = matrix.getRowGroupIndices()[stateSccPair.first]; choice < matrix.getRowGroupIndices()[stateSccPair.first + 1]; ++choice) {
+                if (options.choicesPtr && !options.choicesPtr->get(choice)) {
+                    continue;
+                }
+                for (auto const& entry : matrix.getRow(choice)) {
+                    auto successorIt = stateToParallelScc.find(entry.getColumn());
+                    if (successorIt != stateToParallelScc.end()) {
+                        EXPECT_LE(successorIt->second, stateSccPair.second);
+                    }
+                }
+            }
+        }
+    }
+}
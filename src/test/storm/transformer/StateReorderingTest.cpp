@@ -0,0 +1,123 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/transformer/StateReordering.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+    uint64_t getBandwidth(storm::storage::SparseMatrix<double> const& matrix) {
+        uint64_t bandwidth = 0;
+        for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+            for (auto const& entry : matrix.getRowGroup(state)) {
+                bandwidth = std::max(bandwidth, entry.getColumn() > state ? entry.getColumn() - state : state - entry.getColumn());
+            }
+        }
+        return bandwidth;
+    }
+
+    TEST(StateReorderingTest, ShuffledChain) {
+        // A chain whose states are numbered in a scattered order.
+        uint64_t const numberOfStates = 100;
+        std::vector<uint64_t> chain(numberOfStates);
+        for (uint64_t position = 0; position < numberOfStates; ++position) {
+            chain[position] = (position * 37) % numberOfStates;
+        }
+        std::vector<uint64_t> successor(numberOfStates);
+        for (uint64_t position = 0; position < numberOfStates; ++position) {
+            successor[chain[position]] = chain[std::min(position + 1, numberOfStates - 1)];
+        }
+        storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates, numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            builder.addNextValue(state, successor[state], 1.0);
+        }
+        storm::models::sparse::StateLabeling labeling(numberOfStates);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", chain.front());
+        labeling.addLabel("target");
+        labeling.addLabelToState("target", chain.back());
+        storm::models::sparse::Dtmc<double> dtmc(builder.build(), std::move(labeling));
+        EXPECT_LT(10ul, getBandwidth(dtmc.getTransitionMatrix()));
+
+        for (auto method : {storm::transformer::StateReorderingMethod::Bfs, storm::transformer::StateReorderingMethod::ReverseCuthillMcKee}) {
+            auto result = storm::transformer::reorderStates(dtmc, method);
+            ASSERT_EQ(numberOfStates, result.model->getNumberOfStates());
+            EXPECT_EQ(1ul, getBandwidth(result.model->getTransitionMatrix()));
+            for (uint64_t newState = 0; newState < numberOfStates; ++newState) {
+                EXPECT_EQ(newState, result.oldToNewStateIndexMapping[result.newToOldStateIndexMapping[newState]]);
+            }
+            EXPECT_TRUE(result.model->getInitialStates().get(result.oldToNewStateIndexMapping[chain.front()]));
+            EXPECT_TRUE(result.model->getStates("target").get(result.oldToNewStateIndexMapping[chain.back()]));
+        }
+
+        std::vector<uint64_t> notAPermutation(numberOfStates, 0);
+        STORM_SILENT_EXPECT_THROW(storm::transformer::reorderStates(dtmc, notAPermutation), storm::exceptions::InvalidArgumentException);
+    }
+
+    TEST(StateReorderingTest, TwoDice) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        std::string formulasString = "Pmin=? [F \"two\"];Rmax=? [F \"done\"]";
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+        storm::builder::BuilderOptions options(formulas);
+        options.setBuildStateValuations();
+        options.setBuildChoiceLabels();
+        options.setBuildChoiceOrigins();
+        auto model = storm::api::buildSparseModel<double>(program, options)->template as<storm::models::sparse::Mdp<double>>();
+
+        auto result = storm::transformer::reorderStates(*model, storm::transformer::StateReorderingMethod::ReverseCuthillMcKee);
+        auto reorderedModel = result.model->template as<storm::models::sparse::Mdp<double>>();
+        EXPECT_EQ(model->getNumberOfStates(), reorderedModel->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfChoices(), reorderedModel->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), reorderedModel->getNumberOfTransitions());
+        ASSERT_TRUE(reorderedModel->hasStateValuations());
+        ASSERT_TRUE(reorderedModel->hasChoiceLabeling());
+        ASSERT_TRUE(reorderedModel->hasChoiceOrigins());
+        for (uint64_t newState = 0; newState < reorderedModel->getNumberOfStates(); ++newState) {
+            uint64_t oldState = result.newToOldStateIndexMapping[newState];
+            EXPECT_EQ(model->getStateValuations().getStateInfo(oldState), reorderedModel->getStateValuations().getStateInfo(newState));
+            EXPECT_EQ(model->getStateLabeling().getLabelsOfState(oldState), reorderedModel->getStateLabeling().getLabelsOfState(newState));
+        }
+        for (uint64_t newChoice = 0; newChoice < reorderedModel->getNumberOfChoices(); ++newChoice) {
+            uint64_t oldChoice = result.newToOldChoiceIndexMapping[newChoice];
+            EXPECT_EQ(model->getChoiceLabeling().getLabelsOfChoice(oldChoice), reorderedModel->getChoiceLabeling().getLabelsOfChoice(newChoice));
+            EXPECT_EQ(model->getChoiceOrigins()->getChoiceInfo(oldChoice), reorderedModel->getChoiceOrigins()->getChoiceInfo(newChoice));
+        }
+
+        // The results for the reordered model coincide with the original results after mapping them back.
+        for (auto const& formula : formulas) {
+            auto originalResult = storm::api::verifyWithSparseEngine(model, storm::api::createTask<double>(formula, false));
+            auto reorderedResult = storm::api::verifyWithSparseEngine(reorderedModel, storm::api::createTask<double>(formula, false));
+            std::vector<double> mappedValues = storm::transformer::mapStateValuesToOriginalModel(reorderedResult->asExplicitQuantitativeCheckResult<double>().getValueVector(), result.newToOldStateIndexMapping);
+            std::vector<double> const& originalValues = originalResult->asExplicitQuantitativeCheckResult<double>().getValueVector();
+            ASSERT_EQ(originalValues.size(), mappedValues.size());
+            for (uint64_t state = 0; state < originalValues.size(); ++state) {
+                EXPECT_NEAR(originalValues[state], mappedValues[state], 1e-6);
+            }
+        }
+
+        // A scheduler for the reordered model selects the same actions after mapping it back.
+        auto task = storm::api::createTask<double>(formulas.front(), false);
+        task.setProduceSchedulers(true);
+        auto reorderedResult = storm::api::verifyWithSparseEngine(reorderedModel, task);
+        ASSERT_TRUE(reorderedResult->asExplicitQuantitativeCheckResult<double>().hasScheduler());
+        auto const& reorderedScheduler = reorderedResult->asExplicitQuantitativeCheckResult<double>().getScheduler();
+        storm::storage::Scheduler<double> mappedScheduler = storm::transformer::mapSchedulerToOriginalModel(reorderedScheduler, result.newToOldStateIndexMapping);
+        for (uint64_t newState = 0; newState < reorderedModel->getNumberOfStates(); ++newState) {
+            uint64_t oldState = result.newToOldStateIndexMapping[newState];
+            ASSERT_EQ(reorderedScheduler.getChoice(newState).isDefined(), mappedScheduler.getChoice(oldState).isDefined());
+            if (!reorderedScheduler.getChoice(newState).isDefined()) {
+                continue;
+            }
+            uint64_t localChoice = mappedScheduler.getChoice(oldState).getDeterministicChoice();
+            EXPECT_EQ(reorderedScheduler.getChoice(newState).getDeterministicChoice(), localChoice);
+            EXPECT_EQ(model->getChoiceLabeling().getLabelsOfChoice(model->getTransitionMatrix().getRowGroupIndices()[oldState] + localChoice), reorderedModel->getChoiceLabeling().getLabelsOfChoice(reorderedModel->getTransitionMatrix().getRowGroupIndices()[newState] + localChoice));
+        }
+    }
+}
@@ -615,6 +615,63 @@ TEST(GraphTest, ExplicitProb01) {
     EXPECT_EQ(1032ull, statesWithProbability01.second.getNumberOfSetBits());
 }
 
+TEST(GraphTest, ExplicitProb01WithTransitionMatrix) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    
+    storm::storage::SparseMatrix<double> const& transitionMatrix = model->getTransitionMatrix();
+    storm::storage::SparseMatrix<double> backwardTransitions = model->getBackwardTransitions();
+    storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+    
+    // The searches with the forward transitions (which may process levels bottom-up) agree with the ones without.
+    for (std::string const& label : {"observe0Greater1", "observeIGreater1", "observeOnlyTrueSender"}) {
+        storm::storage::BitVector psiStates = model->getStates(label);
+        EXPECT_EQ(storm::utility::graph::performProb01(backwardTransitions, allStates, psiStates), storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, allStates, psiStates));
+        EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, allStates, psiStates), storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, allStates, psiStates));
+        EXPECT_EQ(storm::utility::graph::performProbGreater0E(backwardTransitions, allStates, psiStates), storm::utility::graph::performProbGreater0E(transitionMatrix, backwardTransitions, allStates, psiStates));
+        for (uint_fast64_t steps : {0, 1, 5, 20}) {
+            EXPECT_EQ(storm::utility::graph::performProbGreater0(backwardTransitions, allStates, psiStates, true, steps), storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, allStates, psiStates, true, steps));
+        }
+    }
+    
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 = storm::utility::graph::performProb01(transitionMatrix, backwardTransitions, allStates, model->getStates("observe0Greater1"));
+    EXPECT_EQ(4409ull, statesWithProbability01.first.getNumberOfSetBits());
+    EXPECT_EQ(1316ull, statesWithProbability01.second.getNumberOfSetBits());
+}
+
+TEST(GraphTest, ExplicitProbGreater0StepBound) {
+    // State 1 reaches the target state 2 via state 0 and thus needs two steps. The zero entry from state 3 is ignored.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 4, 5);
+    matrixBuilder.addNextValue(0, 2, 1.0);
+    matrixBuilder.addNextValue(1, 0, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    matrixBuilder.addNextValue(3, 2, 0.0);
+    matrixBuilder.addNextValue(3, 3, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+    
+    storm::storage::BitVector phiStates(4, true);
+    storm::storage::BitVector psiStates(4);
+    psiStates.set(2);
+    
+    storm::storage::BitVector result = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates, true, 1);
+    EXPECT_TRUE(result.get(0));
+    EXPECT_FALSE(result.get(1));
+    EXPECT_TRUE(result.get(2));
+    EXPECT_FALSE(result.get(3));
+    
+    result = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates, true, 2);
+    EXPECT_EQ(3ull, result.getNumberOfSetBits());
+    EXPECT_FALSE(result.get(3));
+    
+    result = storm::utility::graph::performProbGreater0(transitionMatrix, backwardTransitions, phiStates, psiStates);
+    EXPECT_EQ(3ull, result.getNumberOfSetBits());
+    EXPECT_FALSE(result.get(3));
+}
+
 TEST(GraphTest, ExplicitProb01MinMax) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
     storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
@@ -668,3 +725,32 @@ TEST(GraphTest, ExplicitProb01MinMax) {
     EXPECT_EQ(993ull, statesWithProbability01.first.getNumberOfSetBits());
     EXPECT_EQ(16ull, statesWithProbability01.second.getNumberOfSetBits());
 }
+
+TEST(GraphTest, ExplicitProbGreater0AStepBound) {
+    // State 0 reaches the target state 2 in one step. State 1 may move to state 0 first and thus needs two steps.
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 4, true, true);
+    matrixBuilder.newRowGroup(0);
+    matrixBuilder.addNextValue(0, 2, 1.0);
+    matrixBuilder.newRowGroup(1);
+    matrixBuilder.addNextValue(1, 0, 1.0);
+    matrixBuilder.addNextValue(2, 2, 1.0);
+    matrixBuilder.newRowGroup(3);
+    matrixBuilder.addNextValue(3, 2, 1.0);
+    storm::storage::SparseMatrix<double> transitionMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<double> backwardTransitions = transitionMatrix.transpose(true);
+
+    storm::storage::BitVector phiStates(3, true);
+    storm::storage::BitVector psiStates(3);
+    psiStates.set(2);
+
+    storm::storage::BitVector result = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates, true, 1);
+    EXPECT_TRUE(result.get(0));
+    EXPECT_FALSE(result.get(1));
+    EXPECT_TRUE(result.get(2));
+
+    result = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates, true, 2);
+    EXPECT_TRUE(result.full());
+
+    result = storm::utility::graph::performProbGreater0A(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    EXPECT_TRUE(result.full());
+}